@@ -29,11 +29,15 @@
 #
 #   ZLIB      -- zlib compression library
 #   BZip2     -- libbz2 compression library
+#   ZSTD      -- zstd compression library
 #   Cereal    -- Serialisation library
 #   Lemon     -- Graph library
 #
 # If you don't wish for these to be detected (and used), you may define SEQAN3_NO_ZLIB,
-# SEQAN3_NO_BZIP2, SEQAN3_NO_CEREAL and SEQAN3_NO_LEMON respectively.
+# SEQAN3_NO_BZIP2, SEQAN3_NO_ZSTD, SEQAN3_NO_CEREAL and SEQAN3_NO_LEMON respectively.
+#
+# If you define SEQAN3_LIBDEFLATE, the BGZF blocks (.gz, .bgzf and .bam files) are compressed and decompressed
+# with libdeflate instead of ZLIB, which is considerably faster. The compressed output differs from ZLIB's.
 #
 # If you wish to require the presence of ZLIB or BZip2, just check for the module before
 # finding SeqAn3, e.g. "find_package (ZLIB REQUIRED)".
@@ -209,6 +213,9 @@ endif ()
 # If you want to force-require these, just do find_package (zlib REQUIRED) before find_package (seqan3)
 option (SEQAN3_NO_ZLIB  "Don't use ZLIB, even if present." OFF)
 option (SEQAN3_NO_BZIP2 "Don't use BZip2, even if present." OFF)
+option (SEQAN3_NO_ZSTD  "Don't use ZSTD, even if present." OFF)
+# libdeflate is "opt-in", because it changes the compressed output
+option (SEQAN3_LIBDEFLATE "Use libdeflate instead of ZLIB for BGZF blocks." OFF)
 
 # ----------------------------------------------------------------------------
 # Require C++17
@@ -462,6 +469,61 @@ else ()
     seqan3_config_print ("Optional dependency:        BZip2 not found.")
 endif ()
 
+# ----------------------------------------------------------------------------
+# ZSTD dependency
+# ----------------------------------------------------------------------------
+
+# CMake does not ship a find module for zstd.
+if (NOT SEQAN3_NO_ZSTD)
+    find_path (ZSTD_INCLUDE_DIR NAMES zstd.h)
+    find_library (ZSTD_LIBRARY NAMES zstd)
+
+    if (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+        set (ZSTD_FOUND TRUE)
+    endif ()
+endif ()
+
+if (ZSTD_FOUND)
+    set (SEQAN3_LIBRARIES         ${SEQAN3_LIBRARIES}         ${ZSTD_LIBRARY})
+    set (SEQAN3_DEPENDENCY_INCLUDE_DIRS      ${SEQAN3_DEPENDENCY_INCLUDE_DIRS}      ${ZSTD_INCLUDE_DIR})
+    set (SEQAN3_DEFINITIONS       ${SEQAN3_DEFINITIONS}       "-DSEQAN3_HAS_ZSTD=1")
+    seqan3_config_print ("Optional dependency:        ZSTD found.")
+else ()
+    seqan3_config_print ("Optional dependency:        ZSTD not found.")
+endif ()
+
+# ----------------------------------------------------------------------------
+# libdeflate dependency
+# ----------------------------------------------------------------------------
+
+# CMake does not ship a find module for libdeflate.
+if (SEQAN3_LIBDEFLATE)
+    find_path (LIBDEFLATE_INCLUDE_DIR NAMES libdeflate.h)
+    find_library (LIBDEFLATE_LIBRARY NAMES deflate libdeflate)
+
+    if (LIBDEFLATE_INCLUDE_DIR AND LIBDEFLATE_LIBRARY)
+        set (LIBDEFLATE_FOUND TRUE)
+    endif ()
+endif ()
+
+if (SEQAN3_LIBDEFLATE AND NOT LIBDEFLATE_FOUND)
+    seqan3_config_error ("libdeflate was requested via SEQAN3_LIBDEFLATE but could not be found.")
+endif ()
+
+# NOTE: libdeflate only replaces zlib for the BGZF blocks, the streams themselves still depend on zlib.
+if (SEQAN3_LIBDEFLATE AND NOT ZLIB_FOUND)
+    seqan3_config_error ("libdeflate was requested via SEQAN3_LIBDEFLATE but ZLIB was not found.")
+endif ()
+
+if (LIBDEFLATE_FOUND)
+    set (SEQAN3_LIBRARIES         ${SEQAN3_LIBRARIES}         ${LIBDEFLATE_LIBRARY})
+    set (SEQAN3_DEPENDENCY_INCLUDE_DIRS      ${SEQAN3_DEPENDENCY_INCLUDE_DIRS}      ${LIBDEFLATE_INCLUDE_DIR})
+    set (SEQAN3_DEFINITIONS       ${SEQAN3_DEFINITIONS}       "-DSEQAN3_HAS_LIBDEFLATE=1")
+    seqan3_config_print ("Optional dependency:        libdeflate found.")
+elseif (NOT SEQAN3_LIBDEFLATE)
+    seqan3_config_print ("Optional dependency:        libdeflate not requested.")
+endif ()
+
 # ----------------------------------------------------------------------------
 # System dependencies
 # ----------------------------------------------------------------------------
@@ -558,6 +620,8 @@ if (SEQAN3_FIND_DEBUG)
   message ("  ${CMAKE_FIND_PACKAGE_NAME}_FOUND                ${${CMAKE_FIND_PACKAGE_NAME}_FOUND}")
   message ("  SEQAN3_HAS_ZLIB             ${ZLIB_FOUND}")
   message ("  SEQAN3_HAS_BZIP2            ${BZIP2_FOUND}")
+  message ("  SEQAN3_HAS_ZSTD             ${ZSTD_FOUND}")
+  message ("  SEQAN3_HAS_LIBDEFLATE       ${LIBDEFLATE_FOUND}")
   message ("")
   message ("  SEQAN3_INCLUDE_DIRS         ${SEQAN3_INCLUDE_DIRS}")
   message ("  SEQAN3_LIBRARIES            ${SEQAN3_LIBRARIES}")
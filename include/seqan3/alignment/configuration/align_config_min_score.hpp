@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::min_score configuration.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Sets the minimal score an alignment must reach to be reported.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This configuration can be used with the standard dynamic programming algorithm for global, semi-global and
+ * local alignments with affine gaps. After every computed column the algorithm checks if the minimal score can still
+ * be reached, assuming that every remaining column contributes the maximal score of the scoring scheme.
+ * If this is not the case, the computation of this sequence pair stops early. A typical use case is the verification
+ * of candidate regions where all alignments below a known threshold are discarded anyway.
+ *
+ * If the alignment of a sequence pair does not reach the minimal score, no traceback is computed and the result
+ * is marked as invalid: the score is set to the lowest value representable by the score type, the front and back
+ * coordinates are set to the end of both sequences and the alignment is empty.
+ *
+ * This configuration cannot be used for the \ref seqan3::align_cfg::edit "edit distance", which can be
+ * restricted with seqan3::align_cfg::max_error instead, nor for the vectorised alignment. If it is used for the
+ * edit distance, a seqan3::invalid_alignment_configuration exception will be thrown.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_min_score_example.cpp
+ */
+struct min_score : public pipeable_config_element<min_score, int32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::min_score};
+};
+
+} // namespace seqan3::align_cfg
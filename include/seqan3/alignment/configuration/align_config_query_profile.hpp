@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::query_profile configuration.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A tag to enable the query profile for the scoring of the alignment algorithm.
+ * \ingroup alignment_configuration
+ */
+struct query_profile_tag : public pipeable_config_element<query_profile_tag, empty_type>
+{
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::query_profile};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Enables the query profile for aligning one sequence against many other sequences.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In a one-vs-many scenario, e.g. a database search, the first sequence of every sequence pair is the same query,
+ * which is aligned against a range of target sequences. With this configuration the alignment algorithm precomputes
+ * a query profile, i.e. for every position of the first sequence the scores against all letters of the
+ * second sequence's alphabet. The inner loop of the alignment algorithm then only needs a single table lookup with
+ * the rank of the target letter instead of converting both letters to the alphabet of the scoring scheme.
+ * The profile is kept between the alignments of the same algorithm instance and only rebuilt if the first sequence
+ * changes. Accordingly, you should pass all targets in one call to seqan3::align_pairwise, where the first sequence
+ * of every pair is the query. The results are still returned per sequence pair.
+ *
+ * This configuration only affects the standard scalar dynamic programming algorithm. It cannot be combined with
+ * seqan3::align_cfg::vectorise and it has no effect if the edit distance is computed.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_query_profile_example.cpp
+ */
+inline constexpr detail::query_profile_tag query_profile{};
+
+} // namespace seqan3::align_cfg
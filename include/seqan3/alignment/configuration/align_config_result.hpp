@@ -61,6 +61,17 @@ struct with_alignment_type
     static constexpr int8_t rank = 3;
 };
 
+/*!\brief Triggers score computation and determines the begin and end position of the sequence alignment as well as
+ *        the full traceback, which is returned as a CIGAR sequence instead of the aligned sequences.
+ * \ingroup alignment_configuration
+ */
+struct with_cigar_type
+{
+    //!\privatesection
+    //!\brief An internal rank used for an ordered access of seqan3::align_cfg::result options.
+    static constexpr int8_t rank = 3;
+};
+
 /*!\brief Helper type to configure the score type of the alignment algorithm.
  * \ingroup alignment_configuration
  */
@@ -85,6 +96,9 @@ inline constexpr detail::with_front_coordinate_type with_front_coordinate{};
 //!\brief Helper Variable used to select trace computation.
 //!\relates seqan3::align_cfg::result
 inline constexpr detail::with_alignment_type with_alignment{};
+//!\brief Helper Variable used to select trace computation returning a CIGAR sequence.
+//!\relates seqan3::align_cfg::result
+inline constexpr detail::with_cigar_type with_cigar{};
 /*!\brief Helper variable used to configure the score type for the alignment algorithm.
  * \relates seqan3::align_cfg::result
  * \tparam t The type to use for the computed alignment score; must model seqan3::arithmetic.
@@ -106,17 +120,24 @@ namespace seqan3::align_cfg
  *
  * The output of the pairwise alignment can be configured using this result configuration element. Depending on the
  * settings, the most efficient implementation is chosen to compute the result.
- * Currently four different modes can be configured (first constructor parameter):
+ * Currently five different modes can be configured (first constructor parameter):
  *
  * 1. computing only the \ref seqan3::align_cfg::result::with_score "score",
  * 2. computing in addition the \ref seqan3::align_cfg::result::with_back_coordinate "end position",
  * 3. computing in addition the \ref seqan3::align_cfg::result::with_front_coordinate "begin position",
  * 4. and finally also computing the \ref seqan3::align_cfg::result::with_alignment "alignment".
+ * 5. Alternatively to 4., computing the alignment as a \ref seqan3::align_cfg::result::with_cigar "CIGAR sequence".
  *
  * These settings will directly affect the contents of the seqan3::alignment_result object which is returned by the
  * alignment algorithm. For example, if you chose the \ref seqan3::align_cfg::result::with_alignment "alignment"
  * feature, your result object will contain the score, end point, begin point and the alignment.
  *
+ * If the alignment is only needed to write it to a SAM/BAM file, you can choose the
+ * \ref seqan3::align_cfg::result::with_cigar "CIGAR" feature instead. The CIGAR sequence (a std::vector over
+ * seqan3::cigar) is built directly from the traceback, such that the aligned sequences are never materialised. It
+ * describes the alignment of the second sequence (the query) against the first sequence (the reference) and only uses
+ * the operations 'M', 'I' and 'D'. It is accessible via seqan3::alignment_result::cigar_sequence.
+ *
  * In addition, you can specify the \ref seqan3::align_cfg::result::using_score_type "score type"
  * with the second constructor argument (see example).
  *
@@ -131,7 +152,8 @@ template <typename alignment_result_tag_t = detail::with_score_type, typename sc
     requires std::same_as<alignment_result_tag_t, detail::with_score_type> ||
              std::same_as<alignment_result_tag_t, detail::with_back_coordinate_type> ||
              std::same_as<alignment_result_tag_t, detail::with_front_coordinate_type> ||
-             std::same_as<alignment_result_tag_t, detail::with_alignment_type>
+             std::same_as<alignment_result_tag_t, detail::with_alignment_type> ||
+             std::same_as<alignment_result_tag_t, detail::with_cigar_type>
 //!\endcond
 class result : public pipeable_config_element<result<alignment_result_tag_t, score_t>, alignment_result_tag_t>
 {
@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes a single alignment of two long sequences in parallel.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In contrast to seqan3::align_cfg::parallel, which distributes independent sequence pairs over multiple threads,
+ * this configuration parallelises the computation of every single sequence pair. The dynamic programming matrix is
+ * divided into square tiles. A tile only depends on its left and its upper neighbour, such that all tiles on the same
+ * anti-diagonal can be computed concurrently. The tiles are processed by the given number of threads as soon as their
+ * dependencies are resolved, i.e. the computation moves like a wavefront through the matrix.
+ * This pays off for long sequences, e.g. the alignment of two genomic regions, where the matrix consists of many
+ * tiles. For short sequences use seqan3::align_cfg::parallel instead.
+ *
+ * The value represents the number of threads to be used and must be greater than `0`.
+ *
+ * Currently, only global alignments with affine gaps are supported, optionally restricted to a
+ * seqan3::align_cfg::band that contains the begin and the end of both sequences. The result can be configured with
+ * seqan3::with_score or seqan3::with_back_coordinate. Any other setting will throw a
+ * seqan3::invalid_alignment_configuration exception.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_wavefront_example.cpp
+ */
+struct wavefront : public pipeable_config_element<wavefront, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::align_cfg
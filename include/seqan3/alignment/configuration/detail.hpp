@@ -22,18 +22,21 @@ namespace seqan3::detail
  */
 enum struct align_config_id : uint8_t
 {
-    aligned_ends, //!< ID for the \ref seqan3::align_cfg::aligned_ends "aligned_ends" option.
-    band,         //!< ID for the \ref seqan3::align_cfg::band "band" option.
-    debug,        //!< ID for the \ref seqan3::align_cfg::debug "debug" option.
-    gap,          //!< ID for the \ref seqan3::align_cfg::gap "gap" option.
-    global,       //!< ID for the \ref seqan3::global_alignment "global alignment" option.
-    local,        //!< ID for the \ref seqan3::local_alignment "local alignment" option.
-    max_error,    //!< ID for the \ref seqan3::align_cfg::max_error "max_error" option.
-    parallel,     //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
-    result,       //!< ID for the \ref seqan3::align_cfg::result "result" option.
-    scoring,      //!< ID for the \ref seqan3::align_cfg::scoring "scoring" option.
-    vectorise,    //!< ID for the \ref seqan3::align_cfg::vectorise "vectorise" option.
-    SIZE          //!< Represents the number of configuration elements.
+    aligned_ends,  //!< ID for the \ref seqan3::align_cfg::aligned_ends "aligned_ends" option.
+    band,          //!< ID for the \ref seqan3::align_cfg::band "band" option.
+    debug,         //!< ID for the \ref seqan3::align_cfg::debug "debug" option.
+    gap,           //!< ID for the \ref seqan3::align_cfg::gap "gap" option.
+    global,        //!< ID for the \ref seqan3::global_alignment "global alignment" option.
+    local,         //!< ID for the \ref seqan3::local_alignment "local alignment" option.
+    max_error,     //!< ID for the \ref seqan3::align_cfg::max_error "max_error" option.
+    min_score,     //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
+    parallel,      //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
+    query_profile, //!< ID for the \ref seqan3::align_cfg::query_profile "query_profile" option.
+    result,        //!< ID for the \ref seqan3::align_cfg::result "result" option.
+    scoring,       //!< ID for the \ref seqan3::align_cfg::scoring "scoring" option.
+    vectorise,     //!< ID for the \ref seqan3::align_cfg::vectorise "vectorise" option.
+    wavefront,     //!< ID for the \ref seqan3::align_cfg::wavefront "wavefront" option.
+    SIZE           //!< Represents the number of configuration elements.
 };
 
 // ----------------------------------------------------------------------------
@@ -49,18 +52,21 @@ template <>
 inline constexpr std::array<std::array<bool, static_cast<uint8_t>(align_config_id::SIZE)>,
                             static_cast<uint8_t>(align_config_id::SIZE)> compatibility_table<align_config_id>
 {
-    {   //0  1  2  3  4  5  6  7  8  9 10
-        { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, //  0: aligned_ends
-        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  1: band
-        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, //  2: debug
-        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, //  3: gap
-        { 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1}, //  4: global
-        { 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1}, //  5: local
-        { 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1}, //  6: max_error
-        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, //  7: parallel
-        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, //  8: result
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, //  9: scoring
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // 10: vectorise
+    {   //0  1  2  3  4  5  6  7  8  9 10 11 12 13
+        { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0}, //  0: aligned_ends
+        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  1: band
+        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}, //  2: debug
+        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: gap
+        { 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1}, //  4: global
+        { 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0}, //  5: local
+        { 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 0}, //  6: max_error
+        { 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0}, //  7: min_score
+        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0}, //  8: parallel
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0}, //  9: query_profile
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // 10: result
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, // 11: scoring
+        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0}, // 12: vectorise
+        { 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0}  // 13: wavefront
     }
 };
 
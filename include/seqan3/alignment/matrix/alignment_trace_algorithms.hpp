@@ -19,9 +19,11 @@
 #include <seqan3/alignment/matrix/alignment_coordinate.hpp>
 #include <seqan3/alignment/matrix/matrix_concept.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/range/views/slice.hpp>
+#include <seqan3/std/algorithm>
 
 namespace seqan3::detail
 {
@@ -164,4 +166,85 @@ inline alignment_t alignment_trace(database_t && database,
     return aligned_seq;
 }
 
+/*!\brief Compute the CIGAR sequence from a trace matrix.
+ * \ingroup alignment_matrix
+ * \tparam    trace_matrix_t  The type of the trace matrix.
+ * \param[in] matrix          The trace matrix.
+ * \param[in] back_coordinate Where the trace in the matrix ends.
+ * \returns A std::vector over seqan3::cigar describing the alignment of the query against the database.
+ *
+ * \details
+ *
+ * Follows the same trace as seqan3::detail::alignment_trace, but run-length encodes the trace directions instead of
+ * building the aligned sequences. A gap in the database is reported as 'I', a gap in the query as 'D' and all other
+ * columns as 'M'.
+ */
+template <typename trace_matrix_t>
+//!\cond
+    requires matrix<remove_cvref_t<trace_matrix_t>> &&
+             std::same_as<typename remove_cvref_t<trace_matrix_t>::value_type, trace_directions>
+//!\endcond
+inline std::vector<cigar> alignment_cigar_sequence(trace_matrix_t && matrix,
+                                                   alignment_coordinate const back_coordinate)
+{
+    constexpr auto D = trace_directions::diagonal;
+    constexpr auto L = trace_directions::left;
+    constexpr auto U = trace_directions::up;
+
+    matrix_coordinate coordinate{row_index_type{back_coordinate.second}, column_index_type{back_coordinate.first}};
+
+    assert(coordinate.row < matrix.rows());
+    assert(coordinate.col < matrix.cols());
+
+    std::vector<cigar> cigar_sequence{};
+    cigar_op operation{};
+    uint32_t count{0};
+    auto append = [&] (cigar_op const next_operation)
+    {
+        if (count > 0 && operation != next_operation)
+        {
+            cigar_sequence.emplace_back(count, operation);
+            count = 0;
+        }
+
+        operation = next_operation;
+        ++count;
+    };
+
+    while (true)
+    {
+        trace_directions dir = matrix.at(coordinate);
+        if ((dir & L) == L)
+        {
+            coordinate.col = std::max<size_t>(coordinate.col, 1) - 1;
+            append('D'_cigar_op);
+        }
+        else if ((dir & U) == U)
+        {
+            coordinate.row = std::max<size_t>(coordinate.row, 1) - 1;
+            append('I'_cigar_op);
+        }
+        else if ((dir & D) == D)
+        {
+            coordinate.row = std::max<size_t>(coordinate.row, 1) - 1;
+            coordinate.col = std::max<size_t>(coordinate.col, 1) - 1;
+            append('M'_cigar_op);
+        }
+        else
+        {
+#ifndef NDEBUG
+            if (!(coordinate.row == 0 || coordinate.col == 0))
+                throw std::logic_error{"Unknown seqan3::trace_direction in an inner cell of the trace matrix."};
+#endif
+            break;
+        }
+    }
+
+    if (count > 0) // append last cigar element
+        cigar_sequence.emplace_back(count, operation);
+
+    std::ranges::reverse(cigar_sequence);
+    return cigar_sequence;
+}
+
 } // namespace seqan3::detail
@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::cigar_sequence_builder.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Builds the CIGAR sequence for a given trace path.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * In contrast to the seqan3::detail::aligned_sequence_builder this class does not build the aligned sequences but
+ * run-length encodes the trace path directly into a std::vector over seqan3::cigar. The first sequence is considered
+ * to be the reference and the second sequence to be the query, i.e. a trace segment that consumes only the second
+ * sequence is an insertion ('I') and a trace segment that consumes only the first sequence is a deletion ('D').
+ * Diagonal segments are reported as 'M'.
+ * Use the interface seqan3::detail::cigar_sequence_builder::operator() to get the CIGAR sequence together with the
+ * slice positions of the first and the second sequence covered by the trace path.
+ */
+class cigar_sequence_builder
+{
+public:
+    //!\brief The result type when building the CIGAR sequence.
+    struct [[nodiscard]] result_type
+    {
+        //!\brief The slice positions of the first sequence.
+        std::pair<size_t, size_t> first_sequence_slice_positions{};
+        //!\brief The slice positions of the second sequence.
+        std::pair<size_t, size_t> second_sequence_slice_positions{};
+        //!\brief The CIGAR sequence corresponding to the given trace path.
+        std::vector<cigar> cigar_sequence{};
+    };
+
+    /*!\brief Builds the CIGAR sequence from the given trace path.
+     * \tparam trace_path_t The type of the trace path; must model std::ranges::input_range and
+     *                      std::same_as<value_type_t<trace_path_t>, seqan::detail::trace_directions> must evaluate to
+     *                      `true`.
+     * \param[in] trace_path The trace path.
+     * \returns seqan3::detail::cigar_sequence_builder::result_type with the built CIGAR sequence.
+     *
+     * \details
+     *
+     * The trace path is traversed from the sink to the source of the trace matrix, hence the CIGAR operations are
+     * collected in reverse order and reversed once at the end.
+     */
+    template <std::ranges::input_range trace_path_t>
+    result_type operator()(trace_path_t && trace_path) const
+    {
+        static_assert(std::same_as<value_type_t<trace_path_t>, trace_directions>,
+                      "The value type of the trace path must be seqan3::detail::trace_directions");
+
+        result_type res{};
+        auto trace_it = std::ranges::begin(trace_path);
+        std::tie(res.first_sequence_slice_positions.second, res.second_sequence_slice_positions.second) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        while (trace_it != std::ranges::end(trace_path))
+        {
+            trace_directions last_dir = *trace_it;
+            uint32_t span = 0;
+            for (; trace_it != std::ranges::end(trace_path) && *trace_it == last_dir; ++trace_it, ++span)
+            {}
+
+            res.cigar_sequence.emplace_back(span, to_cigar_op(last_dir));
+        }
+
+        std::tie(res.first_sequence_slice_positions.first, res.second_sequence_slice_positions.first) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        std::ranges::reverse(res.cigar_sequence);
+
+        return res;
+    }
+
+    /*!\brief Converts a single trace direction into the corresponding CIGAR operation.
+     * \param[in] dir The trace direction to convert.
+     * \returns 'I' for seqan3::detail::trace_directions::up, 'D' for seqan3::detail::trace_directions::left and
+     *          'M' otherwise.
+     */
+    static constexpr cigar_op to_cigar_op(trace_directions const dir) noexcept
+    {
+        if (dir == trace_directions::up)
+            return 'I'_cigar_op;
+        else if (dir == trace_directions::left)
+            return 'D'_cigar_op;
+        else
+            return 'M'_cigar_op;
+    }
+};
+
+} // namespace seqan3::detail
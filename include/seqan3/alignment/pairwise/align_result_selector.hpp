@@ -14,6 +14,7 @@
 
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_result.hpp>
@@ -21,6 +22,7 @@
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/algorithm/configuration.hpp>
 #include <seqan3/core/type_traits/basic.hpp>
@@ -111,6 +113,17 @@ private:
                                                alignment_coordinate,
                                                detail::transformation_trait_or_t<decorator_t, fallback_t>>{};
         }
+        else if constexpr (configuration_t::template exists<align_cfg::result<with_cigar_type, score_type>>())
+        {
+            return alignment_result_value_type<uint32_t,
+                                               score_type,
+                                               alignment_coordinate,
+                                               alignment_coordinate,
+                                               std::nullopt_t *,
+                                               std::nullopt_t *,
+                                               std::nullopt_t *,
+                                               std::vector<cigar>>{};
+        }
         else
         {
             return alignment_result_value_type<uint32_t, score_type>{};
@@ -131,7 +144,9 @@ private:
                                                           std::allocator<std::optional<trace_directions>>,
                                                           matrix_major_order::column>;
 
-            if constexpr (configuration_t::template exists<align_cfg::result<with_alignment_type>>())
+            // The trace matrix is stored if the traceback is computed.
+            using traits_t = alignment_configuration_traits<configuration_t>;
+            if constexpr (traits_t::result_type_rank == with_alignment_type::rank)
             {
                 using with_score_t = list_traits::replace_at<score_matrix_t, 5, as_type_list>;
                 return transfer_template_args_onto_t<list_traits::replace_at<trace_matrix_t, 6, with_score_t>,
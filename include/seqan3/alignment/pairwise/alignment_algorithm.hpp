@@ -12,11 +12,13 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <optional>
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring.hpp>
 #include <seqan3/alignment/configuration/align_config_result.hpp>
 #include <seqan3/alignment/exception.hpp>
@@ -25,6 +27,7 @@
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_sequence_builder.hpp>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/simd/concept.hpp>
@@ -102,6 +105,11 @@ private:
                                                   std::allocator<std::optional<trace_directions>>,
                                                   matrix_major_order::column>,
                            empty_type>;
+    //!\brief The type used to check if the minimal score can still be reached.
+    using min_score_bound_t =
+        std::conditional_t<traits_t::with_min_score,
+                           std::common_type_t<typename traits_t::original_score_t, int64_t>,
+                           empty_type>;
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -126,6 +134,9 @@ public:
     {
         this->scoring_scheme = seqan3::get<align_cfg::scoring>(*cfg_ptr).value;
         this->initialise_alignment_state(*cfg_ptr);
+
+        if constexpr (traits_t::with_min_score)
+            initialise_min_score_bound();
     }
     //!\}
 
@@ -393,10 +404,14 @@ private:
         // Recursion phase: compute column-wise the alignment matrix.
         // ----------------------------------------------------------------------------
 
-        for (auto const & seq1_value : sequence1)
+        size_t remaining_columns = std::ranges::distance(sequence1);
+        for (auto const & seq1_value : scoring_sequence1(sequence1, sequence2))
         {
             compute_alignment_column<true>(seq1_value, sequence2);
             finalise_last_cell_in_column(true);
+
+            if (is_min_score_unreachable(--remaining_columns))
+                return;
         }
 
         // ----------------------------------------------------------------------------
@@ -427,11 +442,16 @@ private:
         // ----------------------------------------------------------------------------
 
         size_t sequence2_size = std::ranges::distance(sequence2);
-        for (auto const & seq1_value : sequence1 | views::take(this->score_matrix.band_col_index))
+        size_t remaining_columns = std::ranges::distance(sequence1);
+        auto && scored_sequence1 = scoring_sequence1(sequence1, sequence2);
+        for (auto const & seq1_value : scored_sequence1 | views::take(this->score_matrix.band_col_index))
         {
             compute_alignment_column<true>(seq1_value, sequence2 | views::take(++last_row_index));
             // Only if band reached last row of matrix the last cell might be tracked.
             finalise_last_cell_in_column(last_row_index >= sequence2_size);
+
+            if (is_min_score_unreachable(--remaining_columns))
+                return;
         }
 
         // ----------------------------------------------------------------------------
@@ -439,12 +459,15 @@ private:
         // ----------------------------------------------------------------------------
 
         size_t first_row_index = 0;
-        for (auto const & seq1_value : sequence1 | views::drop(this->score_matrix.band_col_index))
+        for (auto const & seq1_value : scored_sequence1 | views::drop(this->score_matrix.band_col_index))
         {
             // In the second phase the band moves in every column one base down on the second sequence.
             compute_alignment_column<false>(seq1_value, sequence2 | views::slice(first_row_index++, ++last_row_index));
             // Only if band reached last row of matrix the last cell might be tracked.
             finalise_last_cell_in_column(last_row_index >= sequence2_size);
+
+            if (is_min_score_unreachable(--remaining_columns))
+                return;
         }
 
         // ----------------------------------------------------------------------------
@@ -454,6 +477,44 @@ private:
         finalise_alignment();
     }
 
+    /*!\brief Returns the range that is iterated column-wise to score the first sequence.
+     * \tparam sequence1_t The type of the first sequence.
+     * \tparam sequence2_t The type of the second sequence.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns The query profile of the first sequence if seqan3::align_cfg::query_profile is enabled, otherwise
+     *          the first sequence itself.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    constexpr decltype(auto) scoring_sequence1(sequence1_t & sequence1, [[maybe_unused]] sequence2_t & sequence2)
+    {
+        if constexpr (traits_t::with_query_profile)
+            return this->query_profile(sequence1, sequence2);
+        else
+            return (sequence1);
+    }
+
+    /*!\brief Scores the current value of the first sequence with the current value of the second sequence.
+     * \tparam sequence1_value_t The value type of the range returned by
+     *                           seqan3::detail::alignment_algorithm::scoring_sequence1.
+     * \tparam sequence2_value_t The value type of the second sequence.
+     *
+     * \param[in] seq1_value The current value of the first sequence or the current query profile column.
+     * \param[in] seq2_value The current value of the second sequence.
+     *
+     * \returns The score of both values.
+     */
+    template <typename sequence1_value_t, typename sequence2_value_t>
+    constexpr auto score(sequence1_value_t const & seq1_value, sequence2_value_t const & seq2_value) const noexcept
+    {
+        if constexpr (traits_t::with_query_profile)
+            return seq1_value[seqan3::to_rank(seq2_value)];
+        else
+            return this->scoring_scheme.score(seq1_value, seq2_value);
+    }
+
     /*!\brief Initialises the first column of the alignment matrix.
      * \tparam sequence2_t The type of the second sequence.
      *
@@ -521,14 +582,14 @@ private:
         {
             this->compute_first_band_cell(*alignment_column_it,
                                           this->alignment_state,
-                                          this->scoring_scheme.score(seq1_value, *seq2_it));
+                                          score(seq1_value, *seq2_it));
             ++seq2_it;
         }
 
         for (; seq2_it != std::ranges::end(sequence2); ++seq2_it)
             this->compute_cell(*++alignment_column_it,
                                this->alignment_state,
-                               this->scoring_scheme.score(seq1_value, *seq2_it));
+                               score(seq1_value, *seq2_it));
     }
 
     /*!\brief Finalises the last cell of the current alignment column.
@@ -561,6 +622,70 @@ private:
         this->check_score_of_last_cell(*alignment_column_it, this->alignment_state);
     }
 
+    //!\brief Initialises the minimal score and the maximal score a single column can add to an alignment.
+    constexpr void initialise_min_score_bound() noexcept
+    {
+        using alphabet_t = typename traits_t::scoring_scheme_alphabet_t;
+
+        min_score = seqan3::get<align_cfg::min_score>(*cfg_ptr).value;
+
+        // A column can add at most the best match score; gaps never increase the score.
+        max_column_score = 0;
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                alphabet_t value1{};
+                alphabet_t value2{};
+                seqan3::assign_rank_to(rank1, value1);
+                seqan3::assign_rank_to(rank2, value2);
+                max_column_score = std::max<min_score_bound_t>(max_column_score,
+                                                               this->scoring_scheme.score(value1, value2));
+            }
+        }
+    }
+
+    /*!\brief Checks whether the minimal score can still be reached after the current alignment column.
+     * \param[in] remaining_columns The number of columns that still need to be computed.
+     *
+     * \returns `true` if seqan3::align_cfg::min_score is configured and can not be reached anymore, `false` otherwise.
+     *
+     * \details
+     *
+     * Every alignment ending in one of the remaining columns passes a cell of the current column or, in case of a
+     * local alignment, starts with score 0 in a later column. Its score is hence bounded by the best score within
+     * the current column plus the maximal score every remaining column can add. If this bound is below the minimal
+     * score and no optimum reaching the minimal score was found so far, the computation can stop.
+     * The check is linear in the size of the current column and is skipped as long as the remaining columns alone
+     * can reach the minimal score.
+     */
+    constexpr bool is_min_score_unreachable([[maybe_unused]] size_t const remaining_columns) noexcept
+    {
+        if constexpr (traits_t::with_min_score)
+        {
+            using std::get;
+
+            if (static_cast<min_score_bound_t>(this->alignment_state.optimum.score) >= min_score)
+                return false;
+
+            min_score_bound_t const remaining_score = max_column_score *
+                                                      static_cast<min_score_bound_t>(remaining_columns);
+            min_score_bound_t column_max = traits_t::is_local ? 0 : std::numeric_limits<int32_t>::lowest();
+
+            if (column_max + remaining_score >= min_score)
+                return false;
+
+            for (auto const & cell : alignment_column)
+                column_max = std::max<min_score_bound_t>(column_max, get<0>(cell).current);
+
+            return column_max + remaining_score < min_score;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     /*!\brief Creates a new alignment result from the current alignment optimum and for the given pair of sequences.
      * \tparam index_t The type of the index.
      * \tparam sequence1_t The type of the first sequence.
@@ -605,6 +730,28 @@ private:
 
         res.id = idx;
 
+        if constexpr (traits_t::with_min_score)
+        {
+            // Alignments below the minimal score are reported as invalid without computing the traceback.
+            if (static_cast<min_score_bound_t>(this->alignment_state.optimum.score) < min_score)
+            {
+                size_t const sequence1_size = std::ranges::distance(sequence1);
+                size_t const sequence2_size = std::ranges::distance(sequence2);
+                alignment_coordinate invalid_coordinate{column_index_type{sequence1_size},
+                                                        row_index_type{sequence2_size}};
+
+                res.score = std::numeric_limits<typename traits_t::original_score_t>::lowest();
+
+                if constexpr (traits_t::result_type_rank >= 1)
+                    res.back_coordinate = invalid_coordinate;
+
+                if constexpr (traits_t::result_type_rank >= 2)
+                    res.front_coordinate = invalid_coordinate;
+
+                return res;
+            }
+        }
+
         // Choose what needs to be computed.
         if constexpr (traits_t::result_type_rank >= 0)  // compute score
             res.score = this->alignment_state.optimum.score;
@@ -620,23 +767,34 @@ private:
 
         if constexpr (traits_t::result_type_rank >= 2) // compute front coordinate
         {
-            // Get a aligned sequence builder for banded or un-banded case.
-            aligned_sequence_builder builder{sequence1, sequence2};
             auto optimum_coordinate = alignment_coordinate{column_index_type{this->alignment_state.optimum.column_index},
                                                            row_index_type{this->alignment_state.optimum.row_index}};
-            auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
-            res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
-            res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
 
-            if constexpr (traits_t::result_type_rank == 3) // compute alignment
-                res.alignment = std::move(trace_res.alignment);
+            if constexpr (traits_t::with_cigar) // compute cigar sequence directly from the trace path.
+            {
+                auto trace_res = cigar_sequence_builder{}(this->trace_matrix.trace_path(optimum_coordinate));
+                res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
+                res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
+                res.cigar_sequence = std::move(trace_res.cigar_sequence);
+            }
+            else
+            {
+                // Get a aligned sequence builder for banded or un-banded case.
+                aligned_sequence_builder builder{sequence1, sequence2};
+                auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
+                res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
+                res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
+
+                if constexpr (traits_t::result_type_rank == 3) // compute alignment
+                    res.alignment = std::move(trace_res.alignment);
+            }
         }
 
         // Store the matrices in debug mode.
         if constexpr (traits_t::is_debug)
         {
             res.score_debug_matrix = std::move(score_debug_matrix);
-            if constexpr (traits_t::result_type_rank == 3) // compute alignment
+            if constexpr (traits_t::result_type_rank == 3) // compute alignment or cigar sequence
                 res.trace_debug_matrix = std::move(trace_debug_matrix);
         }
 
@@ -732,7 +890,7 @@ private:
         }), score_debug_matrix.begin() + offset);
 
         // if traceback is enabled.
-        if constexpr (config_t::template exists<align_cfg::result<with_alignment_type>>())
+        if constexpr (traits_t::result_type_rank == 3)
         {
             auto trace_matrix_it = trace_debug_matrix.begin() + offset;
             std::ranges::copy(column | std::views::transform([] (auto const & tpl)
@@ -753,6 +911,10 @@ private:
     score_debug_matrix_t score_debug_matrix{};
     //!\brief The debug matrix for the traces.
     trace_debug_matrix_t trace_debug_matrix{};
+    //!\brief The minimal score an alignment must reach (only used with seqan3::align_cfg::min_score).
+    min_score_bound_t min_score{};
+    //!\brief The maximal score a single column can add to an alignment (only used with seqan3::align_cfg::min_score).
+    min_score_bound_t max_column_score{};
     //!\brief The maximal size within the first and the second sequence collection.
     std::pair<size_t, size_t> max_size_in_collection{};
 };
@@ -29,6 +29,7 @@
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_algorithm.hpp>
+#include <seqan3/alignment/pairwise/wavefront_alignment_algorithm.hpp>
 #include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/simd/simd.hpp>
@@ -288,44 +289,86 @@ public:
             // Configure the algorithm
             // ----------------------------------------------------------------------------
 
-            // Use default edit distance if gaps are not set.
-            auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
-            auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
-            auto align_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
-
-            if constexpr (config_t::template exists<align_cfg::mode<detail::global_alignment_type>>())
+            // Compute every single alignment in parallel if the wavefront alignment is requested.
+            if constexpr (config_t::template exists<align_cfg::wavefront>())
+            {
+                return std::pair{configure_wavefront<function_wrapper_t>(cfg), cfg};
+            }
+            else
             {
-                // Only use edit distance if ...
-                if (gaps.get_gap_open_score() == 0 &&  // gap open score is not set,
-                    !(align_ends_cfg[2] || align_ends_cfg[3]) && // none of the free end gaps are set for second seq,
-                    align_ends_cfg[0] == align_ends_cfg[1]) // free ends for leading and trailing gaps are equal in first seq.
+                // Use default edit distance if gaps are not set.
+                auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+                auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
+                auto align_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
+
+                if constexpr (config_t::template exists<align_cfg::mode<detail::global_alignment_type>>())
                 {
-                    // TODO: Instead of relying on nucleotide scoring schemes we need to be able to determine the edit distance
-                    //       option via the scheme.
-                    if constexpr (is_type_specialisation_of_v<remove_cvref_t<decltype(scoring_scheme)>,
-                                                              nucleotide_scoring_scheme>)
+                    // Only use edit distance if ...
+                    // * gap open score is not set,
+                    // * none of the free end gaps are set for second seq,
+                    // * free ends for leading and trailing gaps are equal in first seq.
+                    if (gaps.get_gap_open_score() == 0 &&
+                        !(align_ends_cfg[2] || align_ends_cfg[3]) &&
+                        align_ends_cfg[0] == align_ends_cfg[1])
                     {
-                        if ((scoring_scheme.score('A'_dna15, 'A'_dna15) == 0) &&
-                            (scoring_scheme.score('A'_dna15, 'C'_dna15)) == -1)
-                            return std::pair{configure_edit_distance<function_wrapper_t>(cfg), cfg};
+                        // TODO: Instead of relying on nucleotide scoring schemes we need to be able to determine the
+                        //       edit distance option via the scheme.
+                        if constexpr (is_type_specialisation_of_v<remove_cvref_t<decltype(scoring_scheme)>,
+                                                                  nucleotide_scoring_scheme>)
+                        {
+                            if ((scoring_scheme.score('A'_dna15, 'A'_dna15) == 0) &&
+                                (scoring_scheme.score('A'_dna15, 'C'_dna15)) == -1)
+                            {
+                                // Do not allow min score configuration for the edit distance computation.
+                                if constexpr (config_t::template exists<align_cfg::min_score>())
+                                    throw invalid_alignment_configuration{"The align_cfg::min_score configuration "
+                                                                          "is not allowed for the edit distance "
+                                                                          "computation. Use align_cfg::max_error "
+                                                                          "instead."};
+                                else
+                                    return std::pair{configure_edit_distance<function_wrapper_t>(cfg), cfg};
+                            }
+                        }
                     }
                 }
-            }
 
-            // ----------------------------------------------------------------------------
-            // Check if invalid configuration was used.
-            // ----------------------------------------------------------------------------
+                // ----------------------------------------------------------------------------
+                // Check if invalid configuration was used.
+                // ----------------------------------------------------------------------------
 
-            // Do not allow max error configuration for alignments not computing the edit distance.
-            if (config_t::template exists<align_cfg::max_error>())
-                throw invalid_alignment_configuration{"The align_cfg::max_error configuration is only allowed for "
-                                                      "the specific edit distance computation."};
-            // Configure the alignment algorithm.
-            return std::pair{configure_scoring_scheme<function_wrapper_t>(cfg), cfg};
+                // Do not allow max error configuration for alignments not computing the edit distance.
+                if (config_t::template exists<align_cfg::max_error>())
+                    throw invalid_alignment_configuration{"The align_cfg::max_error configuration is only allowed for "
+                                                          "the specific edit distance computation."};
+                // Configure the alignment algorithm.
+                return std::pair{configure_scoring_scheme<function_wrapper_t>(cfg), cfg};
+            }
         }
     }
 
 private:
+    /*!\brief Configures the wavefront alignment algorithm.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the configuration is not supported by the wavefront
+     *         alignment.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_wavefront(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (!traits_t::is_global)
+            throw invalid_alignment_configuration{"The wavefront alignment can only compute global alignments."};
+        else if constexpr (traits_t::result_type_rank > 1)
+            throw invalid_alignment_configuration{"The wavefront alignment can only compute the score and the back "
+                                                  "coordinate."};
+        else
+            return function_wrapper_t{wavefront_alignment_algorithm<config_t>{cfg}};
+    }
+
     /*!\brief Configures the edit distance algorithm.
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
      * \tparam config_t           The alignment configuration type.
@@ -453,6 +496,8 @@ private:
      * scoring scheme is the one configured in seqan3::align_config::scoring. If vectorisation is enabled, then the
      * appropriate scoring scheme for the vectorised alignment algorithm is selected. This involves checking whether the
      * passed scoring scheme is a matrix or a simple scoring scheme, which has only mismatch and match costs.
+     * If seqan3::align_cfg::query_profile is set, the seqan3::detail::scoring_scheme_profile_policy is selected which
+     * additionally precomputes the scores of the first sequence against the alphabet of the second sequence.
      */
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
@@ -496,7 +541,10 @@ constexpr function_wrapper_t alignment_configurator::configure_scoring_scheme(co
                                 typename traits_t::alignment_mode_t>,
                            typename traits_t::scoring_scheme_t>;
 
-    using scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>;
+    using scoring_scheme_policy_t =
+        std::conditional_t<traits_t::with_query_profile,
+                           deferred_crtp_base<scoring_scheme_profile_policy, alignment_scoring_scheme_t>,
+                           deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>>;
     return configure_free_ends_initialisation<function_wrapper_t, scoring_scheme_policy_t>(cfg);
 }
 
@@ -26,6 +26,7 @@ namespace seqan3::detail
  * \tparam alignment_t           The type for the alignment, can be omitted.
  * \tparam score_debug_matrix_t  The type for the score matrix. Only present if seqan3::align_cfg::debug is enabled.
  * \tparam trace_debug_matrix_t  The type for the trace matrix. Only present if seqan3::align_cfg::debug is enabled.
+ * \tparam cigar_sequence_t      The type for the CIGAR sequence, can be omitted.
  */
 template <typename id_t,
           typename score_t,
@@ -33,7 +34,8 @@ template <typename id_t,
           typename front_coord_t = std::nullopt_t *,
           typename alignment_t = std::nullopt_t *,
           typename score_debug_matrix_t = std::nullopt_t *,
-          typename trace_debug_matrix_t = std::nullopt_t *>
+          typename trace_debug_matrix_t = std::nullopt_t *,
+          typename cigar_sequence_t = std::nullopt_t *>
 struct alignment_result_value_type
 {
     //! \brief The alignment identifier.
@@ -51,6 +53,9 @@ struct alignment_result_value_type
     score_debug_matrix_t score_debug_matrix{};
     //!\brief The trace matrix. Only accessible with seqan3::align_cfg::debug.
     trace_debug_matrix_t trace_debug_matrix{};
+
+    //!\brief The alignment represented as CIGAR sequence. Only accessible with seqan3::with_cigar.
+    cigar_sequence_t cigar_sequence{};
 };
 
 /*!\name Type deduction guides
@@ -123,6 +128,8 @@ private:
     using front_coord_t = decltype(data.front_coordinate);
     //! \brief The type for the alignment.
     using alignment_t   = decltype(data.alignment);
+    //! \brief The type for the CIGAR sequence.
+    using cigar_sequence_t = decltype(data.cigar_sequence);
     //!\}
 
 public:
@@ -212,6 +219,25 @@ public:
                       "Trying to access the alignment, although it was not requested in the alignment configuration.");
         return data.alignment;
     }
+
+    /*!\brief Returns the alignment as CIGAR sequence.
+     * \return A std::vector over seqan3::cigar describing the alignment of the second sequence against the first one.
+     *
+     * \details
+     *
+     * The CIGAR sequence only uses the operations 'M' (aligned), 'I' (gap in the first sequence) and
+     * 'D' (gap in the second sequence) and covers the region between the front and the back coordinate.
+     *
+     * \note This function is only available if seqan3::with_cigar was requested via the alignment configuration
+     * (see seqan3::align_cfg::result).
+     */
+    constexpr cigar_sequence_t const & cigar_sequence() const noexcept
+    {
+        static_assert(!std::is_same_v<cigar_sequence_t, std::nullopt_t *>,
+                      "Trying to access the CIGAR sequence, although it was not requested in the alignment "
+                      "configuration.");
+        return data.cigar_sequence;
+    }
     //!\}
 
     //!\cond DEV
@@ -75,6 +75,11 @@ struct alignment_configuration_traits
     static constexpr bool is_banded = config_t::template exists<align_cfg::band>();
     //!\brief Flag indicating whether debug mode is enabled.
     static constexpr bool is_debug = config_t::template exists<detail::debug_mode>();
+    //!\brief Flag indicating whether a minimal score is required.
+    static constexpr bool with_min_score = config_t::template exists<align_cfg::min_score>();
+    //!\brief Flag indicating whether the query profile is used for scoring.
+    static constexpr bool with_query_profile =
+        config_t::template exists<remove_cvref_t<decltype(align_cfg::query_profile)>>();
 
     //!\brief The configured alignment mode.
     using alignment_mode_t = decltype(get<align_cfg::mode>(std::declval<config_t>()).value);
@@ -101,6 +106,8 @@ struct alignment_configuration_traits
                                                     }();
     //!\brief The rank of the selected result type.
     static constexpr int8_t result_type_rank = static_cast<int8_t>(decltype(std::declval<result_t>().value)::rank);
+    //!\brief Flag indicating whether the alignment is returned as CIGAR sequence.
+    static constexpr bool with_cigar = std::same_as<decltype(std::declval<result_t>().value), with_cigar_type>;
     //!\brief The padding symbol to use for the computation of the alignment.
     static constexpr original_score_t padding_symbol =
         static_cast<original_score_t>(1u << (sizeof_bits<original_score_t> - 1));
@@ -104,10 +104,15 @@ struct default_edit_distance_trait_type
     //!\brief Whether the alignment configuration indicates to compute and/or store the alignment of the sequences.
     static constexpr bool compute_sequence_alignment = !std::same_as<decltype(result_value_type{}.alignment),
                                                                   std::nullopt_t *>;
+    //!\brief Whether the alignment configuration indicates to compute and/or store the CIGAR sequence.
+    static constexpr bool compute_cigar_sequence = !std::same_as<decltype(result_value_type{}.cigar_sequence),
+                                                              std::nullopt_t *>;
     //!\brief Whether the alignment configuration indicates to compute and/or store the score matrix.
     static constexpr bool compute_score_matrix = false;
     //!\brief Whether the alignment configuration indicates to compute and/or store the trace matrix.
-    static constexpr bool compute_trace_matrix = compute_front_coordinate || compute_sequence_alignment;
+    static constexpr bool compute_trace_matrix = compute_front_coordinate ||
+                                                 compute_sequence_alignment ||
+                                                 compute_cigar_sequence;
     //!\brief Whether the alignment configuration indicates to compute and/or store the score or trace matrix.
     static constexpr bool compute_matrix = compute_score_matrix || compute_trace_matrix;
 
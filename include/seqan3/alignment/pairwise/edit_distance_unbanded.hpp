@@ -744,6 +744,7 @@ private:
     using edit_traits::compute_back_coordinate;
     using edit_traits::compute_front_coordinate;
     using edit_traits::compute_sequence_alignment;
+    using edit_traits::compute_cigar_sequence;
     using edit_traits::compute_score_matrix;
     using edit_traits::compute_trace_matrix;
     using edit_traits::compute_matrix;
@@ -1074,6 +1075,12 @@ public:
                                                                 res_vt.front_coordinate);
             }
         }
+
+        if constexpr (compute_cigar_sequence)
+        {
+            if (this->is_valid())
+                res_vt.cigar_sequence = alignment_cigar_sequence(this->trace_matrix(), res_vt.back_coordinate);
+        }
         return alignment_result<result_value_type>{std::move(res_vt)};
     }
 };
@@ -19,6 +19,7 @@
 #include <seqan3/alignment/pairwise/policy/alignment_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/find_optimum_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/scoring_scheme_policy.hpp>
+#include <seqan3/alignment/pairwise/policy/scoring_scheme_profile_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/simd_affine_gap_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/simd_find_optimum_policy.hpp>
 
@@ -137,5 +138,16 @@
  * ### Existing optimum policies:
  *
  *  - seqan3::detail::find_optimum_policy
+ *
+ * # Scoring scheme policies
+ *
+ * These policies store the scoring scheme used to score two letters of the first and the second sequence.
+ * The seqan3::detail::scoring_scheme_profile_policy additionally provides the function `query_profile` which returns
+ * a precomputed profile over the first sequence that is used instead of the letters of the first sequence.
+ *
+ * ### Existing scoring scheme policies:
+ *
+ *  - seqan3::detail::scoring_scheme_policy
+ *  - seqan3::detail::scoring_scheme_profile_policy
  */
 //!\endcond
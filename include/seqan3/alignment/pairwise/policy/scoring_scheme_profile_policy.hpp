@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::scoring_scheme_profile_policy.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3::detail
+{
+
+/*!\brief The CRTP-policy that stores the scoring scheme and a query profile over the first sequence.
+ * \ingroup alignment_policy
+ * \tparam alignment_algorithm_t The derived type (seqan3::detail::alignment_algorithm) to be augmented with this
+ *                               CRTP-policy.
+ * \tparam scoring_scheme_t The type of the scoring scheme.
+ *
+ * \details
+ *
+ * In addition to the scoring scheme, this policy maintains a query profile for the first sequence. The profile stores
+ * for every position of the first sequence one column with the scores against all letters of the alphabet of the
+ * second sequence. Instead of iterating over the letters of the first sequence, the alignment algorithm iterates
+ * over the profile columns and obtains the score of a cell by accessing the current column with the rank of the
+ * letter of the second sequence. The profile is cached and only rebuilt if the first sequence differs from the
+ * sequence it was built for. Thus, aligning one query against many targets builds the profile only once per
+ * algorithm instance.
+ *
+ * \remarks The template parameters of this CRTP-policy are selected in the
+ *          seqan3::detail::alignment_configurator::configure_scoring_scheme when selecting the alignment for the given
+ *          configuration.
+ */
+template <typename alignment_algorithm_t, typename scoring_scheme_t>
+class scoring_scheme_profile_policy
+{
+private:
+    //!\brief Befriends the derived class to grant it access to the private members.
+    friend alignment_algorithm_t;
+
+    //!\brief The score type of the scoring scheme.
+    using profile_score_type = typename scoring_scheme_t::score_type;
+    //!\brief The type of a single profile column.
+    using profile_column_type = std::span<profile_score_type const>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Defaulted.
+    scoring_scheme_profile_policy() = default;
+    //!\brief Defaulted.
+    scoring_scheme_profile_policy(scoring_scheme_profile_policy const &) = default;
+    //!\brief Defaulted.
+    scoring_scheme_profile_policy(scoring_scheme_profile_policy &&) = default;
+    //!\brief Defaulted.
+    scoring_scheme_profile_policy & operator=(scoring_scheme_profile_policy const &) = default;
+    //!\brief Defaulted.
+    scoring_scheme_profile_policy & operator=(scoring_scheme_profile_policy &&) = default;
+    //!\brief Defaulted.
+    ~scoring_scheme_profile_policy() = default;
+    //!\}
+
+    /*!\brief Returns the query profile for the given sequences.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; its value type must model seqan3::semialphabet.
+     *
+     * \param[in] sequence1 The first sequence to build the profile for.
+     * \param[in] sequence2 The second sequence (only used to determine its alphabet).
+     *
+     * \returns A std::ranges::random_access_range over the profile columns with one column per letter of the
+     *          first sequence.
+     *
+     * \details
+     *
+     * The profile is only recomputed if the given first sequence differs from the one the cached profile was
+     * built for. Testing this is linear in the size of the first sequence.
+     * The returned range is invalidated by the next call to this function.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    auto query_profile(sequence1_t && sequence1, sequence2_t && SEQAN3_DOXYGEN_ONLY(sequence2))
+    {
+        using alphabet2_t = std::ranges::range_value_t<sequence2_t>;
+        static_assert(semialphabet<alphabet2_t>,
+                      "The query profile can only be used if the second sequence is over a semialphabet.");
+
+        constexpr size_t column_size = alphabet_size<alphabet2_t>;
+
+        auto equal_rank = [] (auto const & lhs, size_t const rhs) { return seqan3::to_rank(lhs) == rhs; };
+
+        // Only rebuild the profile if the first sequence has changed.
+        if (profile_sequence.size() != static_cast<size_t>(std::ranges::distance(sequence1)) ||
+            !std::ranges::equal(sequence1, profile_sequence, equal_rank))
+        {
+            profile_sequence.clear();
+            profile.clear();
+            for (auto const & seq1_value : sequence1)
+            {
+                profile_sequence.push_back(seqan3::to_rank(seq1_value));
+                for (size_t rank = 0; rank < column_size; ++rank)
+                {
+                    alphabet2_t seq2_value{};
+                    seqan3::assign_rank_to(rank, seq2_value);
+                    profile.push_back(scoring_scheme.score(seq1_value, seq2_value));
+                }
+            }
+        }
+
+        return std::views::iota(size_t{0}, profile_sequence.size())
+             | std::views::transform([data = profile.data()] (size_t const column)
+        {
+            return profile_column_type{data + column * column_size, column_size};
+        });
+    }
+
+    //!\brief The scoring scheme used for this alignment algorithm.
+    scoring_scheme_t scoring_scheme{};
+    //!\brief The flattened query profile storing one column per letter of the first sequence.
+    std::vector<profile_score_type> profile{};
+    //!\brief The ranks of the first sequence the profile was built for.
+    std::vector<size_t> profile_sequence{};
+};
+
+} // namespace seqan3::detail
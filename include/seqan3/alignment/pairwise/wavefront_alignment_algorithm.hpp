@@ -0,0 +1,403 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::wavefront_alignment_algorithm.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <seqan3/alignment/band/static_band.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/configuration/align_config_result.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes a global alignment of two sequences with a tiled anti-diagonal wavefront.
+ * \ingroup pairwise_alignment
+ * \implements std::invocable
+ * \tparam config_t The configuration type; must be a specialisation of seqan3::configuration.
+ *
+ * \details
+ *
+ * The dynamic programming matrix of a single sequence pair is divided into square tiles of
+ * seqan3::detail::wavefront_alignment_algorithm::tile_size cells. Every tile depends only on the last row of its upper
+ * neighbour, the last column of its left neighbour and the bottom-right cell of its upper-left neighbour. These
+ * borders are stored in linear buffers which are shared by all tiles: the tile reads the borders from the buffers and
+ * overwrites them with its own last row and last column. Each tile maintains a counter of its unresolved dependencies.
+ * When a tile is finished, the counters of its right and lower neighbour are decremented and the neighbours are pushed
+ * into a concurrent queue once all their dependencies are resolved. The configured number of threads, including the
+ * calling thread, pop the tiles from this queue until the last tile has been computed.
+ *
+ * Only the scores of the last row and column of every tile are kept, such that the memory consumption is linear in
+ * the size of the sequences. Accordingly, only the score and the back coordinate can be computed. The algorithm uses
+ * affine gap costs and supports global alignments without free end-gaps, optionally restricted to a
+ * seqan3::static_band. Cells outside of the band are set to minus infinity and tiles that lie completely outside of
+ * the band are skipped.
+ */
+template <typename config_t>
+class wavefront_alignment_algorithm
+{
+private:
+    //!\brief The configuration traits.
+    using traits_t = alignment_configuration_traits<config_t>;
+    //!\brief The score type used during the computation.
+    using score_type = typename traits_t::original_score_t;
+
+    static_assert(traits_t::is_global && !traits_t::is_aligned_ends,
+                  "The wavefront alignment can only compute global alignments without free end-gaps.");
+    static_assert(traits_t::result_type_rank <= 1,
+                  "The wavefront alignment can only compute the score and the back coordinate.");
+
+    //!\brief The number of rows and columns of a single tile.
+    static constexpr size_t tile_size = 256;
+    //!\brief The value used for cells that cannot be reached.
+    static constexpr score_type minus_infinity = std::numeric_limits<score_type>::lowest() / 2;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    wavefront_alignment_algorithm() = default;                                                  //!< Defaulted
+    wavefront_alignment_algorithm(wavefront_alignment_algorithm const &) = default;             //!< Defaulted
+    wavefront_alignment_algorithm(wavefront_alignment_algorithm &&) = default;                  //!< Defaulted
+    wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm const &) = default; //!< Defaulted
+    wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm &&) = default;      //!< Defaulted
+    ~wavefront_alignment_algorithm() = default;                                                 //!< Defaulted
+
+    /*!\brief Constructs the algorithm with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the number of threads is 0.
+     *
+     * \details
+     *
+     * The configuration is copied once to the heap during construction and maintained by a std::shared_ptr, such
+     * that the algorithm can be stored inside of a std::function.
+     */
+    wavefront_alignment_algorithm(config_t const & cfg) : cfg_ptr{std::make_shared<config_t>(cfg)}
+    {
+        thread_count = seqan3::get<align_cfg::wavefront>(cfg).value;
+
+        if (thread_count == 0)
+            throw invalid_alignment_configuration{"The number of threads for the wavefront alignment must be "
+                                                  "greater than 0."};
+
+        auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+        gap_extension_score = static_cast<score_type>(gaps.get_gap_score());
+        gap_open_score = static_cast<score_type>(gaps.get_gap_open_score()) + gap_extension_score;
+
+        if constexpr (traits_t::is_banded)
+            band = seqan3::get<align_cfg::band>(cfg).value;
+    }
+    //!\}
+
+    /*!\brief Invokes the alignment computation for every indexed sequence pair contained in the given range.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     *
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     *
+     * \returns A std::vector over seqan3::alignment_result.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band does not contain the begin and the end of both
+     *         sequences.
+     *
+     * \details
+     *
+     * The sequence pairs are computed one after another, while every single alignment is computed by all threads.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t>
+    auto operator()(indexed_sequence_pairs_t && indexed_sequence_pairs)
+    {
+        using indexed_sequence_pair_t = std::ranges::range_value_t<indexed_sequence_pairs_t>;
+        using sequence_pair_t = std::tuple_element_t<0, indexed_sequence_pair_t>;
+        using sequence1_t = std::remove_reference_t<std::tuple_element_t<0, sequence_pair_t>>;
+        using sequence2_t = std::remove_reference_t<std::tuple_element_t<1, sequence_pair_t>>;
+        using result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
+
+        using std::get;
+
+        std::vector<alignment_result<result_value_t>> result_vector{};
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            result_value_t res{};
+            res.id = idx;
+            res.score = compute_single_pair(get<0>(sequence_pair), get<1>(sequence_pair));
+
+            if constexpr (traits_t::result_type_rank >= 1)
+            {
+                size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+                size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+                res.back_coordinate = alignment_coordinate{column_index_type{sequence1_size},
+                                                           row_index_type{sequence2_size}};
+            }
+
+            result_vector.emplace_back(std::move(res));
+        }
+
+        return result_vector;
+    }
+
+private:
+    /*!\brief Computes the score of the global alignment of a single sequence pair.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     * \param[in] sequence1 The first sequence spanning the columns of the matrix.
+     * \param[in] sequence2 The second sequence spanning the rows of the matrix.
+     * \returns The score of the optimal global alignment.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    score_type compute_single_pair(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        size_t const column_count = std::ranges::distance(sequence1);
+        size_t const row_count = std::ranges::distance(sequence2);
+
+        if (!in_band(0, 0) || !in_band(row_count, column_count))
+            throw invalid_alignment_configuration{"Invalid band error: The wavefront alignment requires a band that "
+                                                  "contains the begin and the end of both sequences."};
+
+        initialise_borders(row_count, column_count);
+
+        if (row_count == 0 || column_count == 0)
+            return (column_count == 0) ? column_border[row_count].score : row_border[column_count].score;
+
+        size_t const tile_row_count = (row_count + tile_size - 1) / tile_size;
+        size_t const tile_column_count = (column_count + tile_size - 1) / tile_size;
+        size_t const tile_count = tile_row_count * tile_column_count;
+
+        // The score of the cell before the upper-left corner of every tile. One additional row and column stores the
+        // bottom-right cell of the last tiles, which is never read.
+        std::vector<score_type> corners((tile_row_count + 1) * (tile_column_count + 1), minus_infinity);
+        auto corner = [&] (size_t const tile_row, size_t const tile_column) -> score_type &
+        {
+            return corners[tile_row * (tile_column_count + 1) + tile_column];
+        };
+
+        for (size_t tile_column = 0; tile_column < tile_column_count; ++tile_column)
+            corner(0, tile_column) = row_border[tile_column * tile_size].score;
+        for (size_t tile_row = 0; tile_row < tile_row_count; ++tile_row)
+            corner(tile_row, 0) = column_border[tile_row * tile_size].score;
+
+        // Every tile waits for its upper and its left neighbour.
+        std::vector<std::atomic<uint8_t>> dependencies(tile_count);
+        for (size_t tile_row = 0; tile_row < tile_row_count; ++tile_row)
+            for (size_t tile_column = 0; tile_column < tile_column_count; ++tile_column)
+                dependencies[tile_row * tile_column_count + tile_column].store((tile_row > 0) + (tile_column > 0),
+                                                                               std::memory_order_relaxed);
+
+        contrib::dynamic_buffer_queue<size_t> ready_tiles{std::min(tile_row_count, tile_column_count)};
+        ready_tiles.wait_push(size_t{0});
+
+        auto resolve = [&] (size_t const tile)
+        {
+            if (dependencies[tile].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                ready_tiles.wait_push(tile);
+        };
+
+        auto worker = [&] ()
+        {
+            size_t tile{};
+            while (ready_tiles.wait_pop(tile) == contrib::queue_op_status::success)
+            {
+                size_t const tile_row = tile / tile_column_count;
+                size_t const tile_column = tile % tile_column_count;
+                size_t const first_row = tile_row * tile_size + 1;
+                size_t const first_column = tile_column * tile_size + 1;
+                size_t const last_row = std::min(first_row + tile_size - 1, row_count);
+                size_t const last_column = std::min(first_column + tile_size - 1, column_count);
+
+                corner(tile_row + 1, tile_column + 1) = compute_tile(sequence1, sequence2,
+                                                                     first_row, last_row,
+                                                                     first_column, last_column,
+                                                                     corner(tile_row, tile_column));
+
+                if (tile_column + 1 < tile_column_count)
+                    resolve(tile + 1);
+                if (tile_row + 1 < tile_row_count)
+                    resolve(tile + tile_column_count);
+                if (tile + 1 == tile_count) // The last tile has been computed.
+                    ready_tiles.close();
+            }
+        };
+
+        std::vector<std::thread> threads{};
+        size_t const additional_thread_count = std::min<size_t>(thread_count, tile_count) - 1;
+        threads.reserve(additional_thread_count);
+        for (size_t i = 0; i < additional_thread_count; ++i)
+            threads.emplace_back(worker);
+
+        worker(); // The calling thread participates in the computation.
+
+        for (auto & thread : threads)
+            thread.join();
+
+        return row_border[column_count].score;
+    }
+
+    /*!\brief Computes a single tile of the matrix and updates the shared row and column borders.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] first_row The first row of the tile (1-based).
+     * \param[in] last_row The last row of the tile (inclusive).
+     * \param[in] first_column The first column of the tile (1-based).
+     * \param[in] last_column The last column of the tile (inclusive).
+     * \param[in] corner The score of the cell diagonal to the first cell of the tile.
+     * \returns The score of the bottom-right cell of the tile.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    score_type compute_tile(sequence1_t & sequence1,
+                            sequence2_t & sequence2,
+                            size_t const first_row,
+                            size_t const last_row,
+                            size_t const first_column,
+                            size_t const last_column,
+                            score_type const corner)
+    {
+        // Skip tiles that lie completely outside of the band.
+        if (!in_band_range(first_row, last_row, first_column, last_column))
+        {
+            for (size_t column = first_column; column <= last_column; ++column)
+                row_border[column] = border_cell{minus_infinity, minus_infinity};
+            for (size_t row = first_row; row <= last_row; ++row)
+                column_border[row] = border_cell{minus_infinity, minus_infinity};
+
+            return minus_infinity;
+        }
+
+        auto const & scoring_scheme = seqan3::get<align_cfg::scoring>(*cfg_ptr).value;
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        score_type diagonal = corner;
+        for (size_t row = first_row; row <= last_row; ++row)
+        {
+            // The score of the left border cell is the diagonal of the first cell in the next row.
+            score_type next_diagonal = column_border[row].score;
+            score_type left = column_border[row].score;
+            score_type horizontal = column_border[row].gap;
+            auto const & sequence2_value = sequence2_it[row - 1];
+
+            for (size_t column = first_column; column <= last_column; ++column)
+            {
+                border_cell & upper = row_border[column];
+                score_type current = minus_infinity;
+
+                if (in_band(row, column))
+                {
+                    horizontal = std::max<score_type>(left + gap_open_score, horizontal + gap_extension_score);
+                    upper.gap = std::max<score_type>(upper.score + gap_open_score, upper.gap + gap_extension_score);
+                    current = std::max<score_type>({static_cast<score_type>(diagonal +
+                                                        scoring_scheme.score(sequence1_it[column - 1],
+                                                                             sequence2_value)),
+                                                    horizontal,
+                                                    upper.gap});
+                }
+                else
+                {
+                    horizontal = minus_infinity;
+                    upper.gap = minus_infinity;
+                }
+
+                diagonal = upper.score;
+                upper.score = current;
+                left = current;
+            }
+
+            column_border[row] = border_cell{left, horizontal};
+            diagonal = next_diagonal;
+        }
+
+        return row_border[last_column].score;
+    }
+
+    /*!\brief Initialises the first row and the first column of the matrix.
+     * \param[in] row_count The size of the second sequence.
+     * \param[in] column_count The size of the first sequence.
+     */
+    void initialise_borders(size_t const row_count, size_t const column_count)
+    {
+        row_border.assign(column_count + 1, border_cell{minus_infinity, minus_infinity});
+        column_border.assign(row_count + 1, border_cell{minus_infinity, minus_infinity});
+
+        row_border[0].score = 0;
+        column_border[0].score = 0;
+
+        for (size_t column = 1; column <= column_count && in_band(0, column); ++column)
+            row_border[column].score = gap_open_score + static_cast<score_type>(column - 1) * gap_extension_score;
+
+        for (size_t row = 1; row <= row_count && in_band(row, 0); ++row)
+            column_border[row].score = gap_open_score + static_cast<score_type>(row - 1) * gap_extension_score;
+    }
+
+    //!\brief Checks whether the cell lies within the band.
+    bool in_band(size_t const row, size_t const column) const noexcept
+    {
+        int64_t const diagonal = static_cast<int64_t>(column) - static_cast<int64_t>(row);
+        return band.lower_bound <= diagonal && diagonal <= band.upper_bound;
+    }
+
+    //!\brief Checks whether any cell of the given tile lies within the band.
+    bool in_band_range(size_t const first_row,
+                       size_t const last_row,
+                       size_t const first_column,
+                       size_t const last_column) const noexcept
+    {
+        int64_t const min_diagonal = static_cast<int64_t>(first_column) - static_cast<int64_t>(last_row);
+        int64_t const max_diagonal = static_cast<int64_t>(last_column) - static_cast<int64_t>(first_row);
+        return band.lower_bound <= max_diagonal && min_diagonal <= band.upper_bound;
+    }
+
+    //!\brief A cell of the shared borders storing the score and the score of the gap running along the border.
+    struct border_cell
+    {
+        //!\brief The best score of the cell.
+        score_type score;
+        //!\brief The best score ending with a gap orthogonal to the border.
+        score_type gap;
+    };
+
+    //!\brief The alignment configuration stored on the heap.
+    std::shared_ptr<config_t> cfg_ptr{};
+    //!\brief The number of threads computing the tiles.
+    size_t thread_count{1};
+    //!\brief The score for opening a gap including the first extension.
+    score_type gap_open_score{};
+    //!\brief The score for extending a gap.
+    score_type gap_extension_score{};
+    //!\brief The band; unbounded if no band was configured.
+    static_band band{};
+    //!\brief The last computed row of every column of the matrix.
+    std::vector<border_cell> row_border{};
+    //!\brief The last computed column of every row of the matrix.
+    std::vector<border_cell> column_border{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,263 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::bgzf_index.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief Composes a BGZF virtual file offset.
+ * \param[in] compressed_offset The offset of the BGZF block in the compressed file.
+ * \param[in] in_block_offset   The offset within the uncompressed data of the block; smaller than 2^16.
+ * \returns The virtual offset that can be passed to the `seekg()` of a seqan3::contrib::bgzf_istream.
+ */
+constexpr uint64_t bgzf_virtual_offset(uint64_t const compressed_offset, uint16_t const in_block_offset) noexcept
+{
+    return (compressed_offset << 16) | in_block_offset;
+}
+
+/*!\brief The index of the blocks of a BGZF file, as stored in `.gzi` files.
+ *
+ * \details
+ *
+ * The index maps offsets in the uncompressed data to BGZF virtual offsets, i.e. to the offset of the compressed block
+ * shifted by 16 bits plus the offset within the uncompressed block. Seeking a seqan3::contrib::bgzf_istream to such a
+ * virtual offset only decompresses the block containing the position:
+ *
+ * ```cpp
+ * std::ifstream compressed{"file.fa.gz", std::ios::binary};
+ * std::ifstream index_file{"file.fa.gz.gzi", std::ios::binary};
+ *
+ * seqan3::contrib::bgzf_index index{};
+ * index.read(index_file);
+ *
+ * seqan3::contrib::bgzf_istream stream{compressed};
+ * stream.seekg(index.virtual_offset(1'000'000)); // The 1'000'000th character of the uncompressed data.
+ * ```
+ *
+ * The `.gzi` format is the one written by `bgzip --index`: the number of entries followed by pairs of the compressed
+ * and the uncompressed offset of each block but the first one and the empty end-of-file marker, all stored as
+ * little-endian 64 bit integers.
+ * If no `.gzi` file is available, the index can be built by scanning the block headers with build(), which does not
+ * decompress any data.
+ */
+class bgzf_index
+{
+public:
+    //!\brief The start of a BGZF block.
+    struct entry
+    {
+        //!\brief The offset of the block in the compressed file.
+        uint64_t compressed_offset{};
+        //!\brief The offset of the first character of the block in the uncompressed data.
+        uint64_t uncompressed_offset{};
+
+        //!\brief Compares both offsets.
+        friend bool operator==(entry const & lhs, entry const & rhs) noexcept
+        {
+            return lhs.compressed_offset == rhs.compressed_offset &&
+                   lhs.uncompressed_offset == rhs.uncompressed_offset;
+        }
+
+        //!\brief Compares both offsets.
+        friend bool operator!=(entry const & lhs, entry const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bgzf_index() = default;                               //!< Defaulted.
+    bgzf_index(bgzf_index const &) = default;             //!< Defaulted.
+    bgzf_index(bgzf_index &&) = default;                  //!< Defaulted.
+    bgzf_index & operator=(bgzf_index const &) = default; //!< Defaulted.
+    bgzf_index & operator=(bgzf_index &&) = default;      //!< Defaulted.
+    ~bgzf_index() = default;                              //!< Defaulted.
+    //!\}
+
+    /*!\brief Builds the index by reading the block headers and footers of a BGZF file.
+     * \param[in] compressed_stream The stream over the compressed file, positioned at its beginning.
+     * \returns The index of all non-empty blocks.
+     * \throws seqan3::io_error If the stream does not contain valid BGZF blocks.
+     *
+     * \details
+     *
+     * The compressed data is skipped, i.e. building the index is limited by the speed of reading the file.
+     */
+    static bgzf_index build(std::istream & compressed_stream)
+    {
+        constexpr size_t header_length = DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH;
+        constexpr size_t footer_length = DefaultPageSize<detail::bgzf_compression>::BLOCK_FOOTER_LENGTH;
+
+        bgzf_index index{};
+        entry current{};
+        std::array<char, header_length> header{};
+        std::array<char, footer_length> footer{};
+
+        while (compressed_stream.read(header.data(), header_length))
+        {
+            if (!detail::bgzf_compression::validate_header(std::span{header}))
+                throw io_error{"Building the BGZF index failed: invalid block header."};
+
+            size_t const block_size = _bgzfUnpack16(header.data() + 16) + 1u;
+
+            if (block_size < header_length + footer_length)
+                throw io_error{"Building the BGZF index failed: invalid block size."};
+
+            compressed_stream.ignore(block_size - header_length - footer_length);
+
+            if (!compressed_stream.read(footer.data(), footer_length))
+                throw io_error{"Building the BGZF index failed: the last block is truncated."};
+
+            uint32_t const uncompressed_size = _bgzfUnpack32(footer.data() + 4); // ISIZE is the last field.
+
+            // The first block always starts at offset 0 and is not stored. Like bgzip, empty blocks such as the
+            // end-of-file marker are not stored either; positions behind the data map to the end of the last block.
+            if (current.compressed_offset != 0 && uncompressed_size != 0)
+                index.entries.push_back(current);
+
+            current.compressed_offset += block_size;
+            current.uncompressed_offset += uncompressed_size;
+        }
+
+        if (compressed_stream.gcount() != 0)
+            throw io_error{"Building the BGZF index failed: the last block header is truncated."};
+
+        return index;
+    }
+
+    /*!\brief Reads the index from a `.gzi` file.
+     * \param[in] index_stream The stream over the `.gzi` file.
+     * \throws seqan3::io_error If the file is truncated or the offsets are not increasing.
+     */
+    void read(std::istream & index_stream)
+    {
+        uint64_t const count = read_uint64(index_stream);
+
+        entries.clear();
+        entries.reserve(std::min<uint64_t>(count, 1u << 16)); // Do not trust the count of a corrupted file.
+
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            entry current{};
+            current.compressed_offset = read_uint64(index_stream);
+            current.uncompressed_offset = read_uint64(index_stream);
+
+            if (!entries.empty() && (current.compressed_offset <= entries.back().compressed_offset ||
+                                     current.uncompressed_offset < entries.back().uncompressed_offset))
+                throw io_error{"The BGZF index is not sorted by offset."};
+
+            entries.push_back(current);
+        }
+    }
+
+    /*!\brief Writes the index in the `.gzi` format.
+     * \param[in] index_stream The stream to write to.
+     */
+    void write(std::ostream & index_stream) const
+    {
+        write_uint64(index_stream, entries.size());
+
+        for (entry const & current : entries)
+        {
+            write_uint64(index_stream, current.compressed_offset);
+            write_uint64(index_stream, current.uncompressed_offset);
+        }
+    }
+
+    /*!\brief Returns the virtual offset of a position in the uncompressed data.
+     * \param[in] uncompressed_offset The position in the uncompressed data.
+     * \returns The virtual offset of the position; to be passed to the `seekg()` of a bgzf_istream.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Logarithmic in the number of blocks.
+     */
+    uint64_t virtual_offset(uint64_t const uncompressed_offset) const noexcept
+    {
+        // The last block starting at or before the position; empty blocks are skipped by taking the last one.
+        auto it = std::upper_bound(entries.begin(), entries.end(), uncompressed_offset,
+                                   [] (uint64_t const offset, entry const & current)
+                                   {
+                                       return offset < current.uncompressed_offset;
+                                   });
+
+        entry const block_start = (it == entries.begin()) ? entry{} : *std::prev(it);
+
+        return bgzf_virtual_offset(block_start.compressed_offset,
+                                   static_cast<uint16_t>(uncompressed_offset - block_start.uncompressed_offset));
+    }
+
+    /*!\brief Appends the start of a block.
+     * \param[in] block The offsets of the block; must be greater than the offsets of the last block.
+     */
+    void push_back(entry const & block)
+    {
+        entries.push_back(block);
+    }
+
+    //!\brief The starts of all non-empty blocks but the first one, which always starts at offset 0 in both files.
+    std::vector<entry> const & blocks() const noexcept
+    {
+        return entries;
+    }
+
+    //!\brief Compares the blocks of both indices.
+    friend bool operator==(bgzf_index const & lhs, bgzf_index const & rhs) noexcept
+    {
+        return lhs.entries == rhs.entries;
+    }
+
+    //!\brief Compares the blocks of both indices.
+    friend bool operator!=(bgzf_index const & lhs, bgzf_index const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    //!\brief Reads a little-endian 64 bit integer.
+    static uint64_t read_uint64(std::istream & index_stream)
+    {
+        uint64_t value{};
+
+        if (!index_stream.read(reinterpret_cast<char *>(&value), sizeof(value)))
+            throw io_error{"The BGZF index is truncated."};
+
+        return detail::to_little_endian(value);
+    }
+
+    //!\brief Writes a little-endian 64 bit integer.
+    static void write_uint64(std::ostream & index_stream, uint64_t value)
+    {
+        value = detail::to_little_endian(value);
+        index_stream.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    //!\brief The starts of all blocks but the first one.
+    std::vector<entry> entries{};
+};
+
+} // namespace seqan3::contrib
@@ -392,6 +392,9 @@ public:
         }
     }
 
+    // Positions are BGZF virtual offsets, i.e. the offset of the compressed block shifted by 16 bits plus the offset
+    // within the uncompressed block (see seqan3::contrib::bgzf_index to obtain them for uncompressed positions).
+    // Seeking to another block requires a seekable compressed stream and only decompresses the sought block.
     pos_type seekoff(off_type ofs, std::ios_base::seekdir dir, std::ios_base::openmode openMode)
     {
         if ((openMode & (std::ios_base::in | std::ios_base::out)) == std::ios_base::in)
@@ -22,6 +22,7 @@
 
 #include <seqan3/contrib/parallel/serialised_resource_pool.hpp>
 #include <seqan3/contrib/parallel/suspendable_queue.hpp>
+#include <seqan3/contrib/stream/bgzf_index.hpp>
 #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
 
 namespace seqan3::contrib
@@ -75,20 +76,35 @@ public:
     {
         char    buffer[DefaultPageSize<detail::bgzf_compression>::MAX_BLOCK_SIZE];
         size_t  size;
+        size_t  uncompressedSize;
     };
 
     // Writes the output to the underlying stream when invoked.
     struct BufferWriter
     {
         ostream_reference ostream;
+        bgzf_index::entry nextBlock;    // start of the next block in the compressed and uncompressed data
+        bool              recordBlocks; // whether to store the block starts in blocks
+        bgzf_index        blocks;
 
         BufferWriter(ostream_reference ostream) :
-            ostream(ostream)
+            ostream(ostream),
+            nextBlock{},
+            recordBlocks(false),
+            blocks{}
         {}
 
+        // The buffers are written in order by one thread at a time, so the offsets need no further synchronisation.
         bool operator() (OutputBuffer const & outputBuffer)
         {
             ostream.write(outputBuffer.buffer, outputBuffer.size);
+
+            // The first block always starts at 0; empty blocks are not recorded, like by bgzf_index::build().
+            if (recordBlocks && nextBlock.compressed_offset != 0 && outputBuffer.uncompressedSize != 0)
+                blocks.push_back(nextBlock);
+
+            nextBlock.compressed_offset += outputBuffer.size;
+            nextBlock.uncompressed_offset += outputBuffer.uncompressedSize;
             return ostream.good();
         }
     };
@@ -117,6 +133,7 @@ public:
     Serializer<OutputBuffer, BufferWriter> serializer;
     size_t                                 currentJobId;
     bool                                   currentJobAvail;
+    uint64_t                               uncompressedPos;  // number of characters submitted for compression
 
     struct CompressionThread
     {
@@ -144,6 +161,7 @@ public:
                 job.outputBuffer->size = _compressBlock(
                     job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
                     &job.buffer[0], job.size, compressionCtx);
+                job.outputBuffer->uncompressedSize = job.size * sizeof(char_type);
 
                 success = releaseValue(streamBuf->serializer, job.outputBuffer);
                 appendValue(streamBuf->idleQueue, jobId);
@@ -156,13 +174,15 @@ public:
     std::vector<std::thread>  pool;
 
     basic_bgzf_ostreambuf(ostream_reference ostream_,
+                         int compressionLevel = bgzf_default_compression_level,
                          size_t numThreads = bgzf_thread_count,
                          size_t jobsPerThread = 8) :
         numThreads(numThreads),
         numJobs(numThreads * jobsPerThread),
         jobQueue(numJobs),
         idleQueue(numJobs),
-        serializer(ostream_, numThreads * jobsPerThread)
+        serializer(ostream_, numThreads * jobsPerThread),
+        uncompressedPos(0)
     {
         jobs.resize(numJobs);
         currentJobId = 0;
@@ -181,7 +201,11 @@ public:
 
         // Start off threads.
         for (size_t i = 0; i < numThreads; ++i)
-            pool.emplace_back(CompressionThread{this, CompressionContext<detail::bgzf_compression>{}});
+        {
+            CompressionContext<detail::bgzf_compression> compressionCtx{};
+            compressionCtx.compressionLevel = compressionLevel;
+            pool.emplace_back(CompressionThread{this, std::move(compressionCtx)});
+        }
 
         currentJobAvail = popFront(currentJobId, idleQueue);
         assert(currentJobAvail);
@@ -214,6 +238,7 @@ public:
         if (currentJobAvail)
         {
             jobs[currentJobId].size = size;
+            uncompressedPos += size;
             appendValue(jobQueue, currentJobId);
         }
 
@@ -284,6 +309,22 @@ public:
             overflow(EOF);
     }
 
+    // Only supports tellp(), which returns the number of uncompressed characters written so far. The virtual offset
+    // of a position is only known after the preceding blocks were compressed, see block_index().
+    pos_type seekoff(off_type ofs, std::ios_base::seekdir dir, std::ios_base::openmode openMode)
+    {
+        if (ofs == 0 && dir == std::ios_base::cur && (openMode & std::ios_base::out))
+            return pos_type(off_type(uncompressedPos + (this->pptr() - this->pbase())));
+
+        return pos_type(off_type(-1));
+    }
+
+    // Starts recording the offsets of the written blocks; must be called before the first block is written.
+    void record_block_index()               { serializer.worker.recordBlocks = true; };
+    // Returns the offsets of the blocks written so far, e.g. to translate uncompressed positions into virtual offsets.
+    // Call flush() before to write all blocks.
+    bgzf_index const & block_index() const  { return serializer.worker.blocks; };
+
     // returns a reference to the output stream
     ostream_reference get_ostream() const    { return serializer.worker.ostream; };
 };
@@ -305,8 +346,10 @@ public:
     typedef std::basic_ostream<Elem, Tr>&                         ostream_reference;
     typedef basic_bgzf_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_streambuf_type;
 
-    basic_bgzf_ostreambase(ostream_reference ostream_)
-        : m_buf(ostream_)
+    basic_bgzf_ostreambase(ostream_reference ostream_,
+                           int compressionLevel = bgzf_default_compression_level,
+                           size_t numThreads = bgzf_thread_count)
+        : m_buf(ostream_, compressionLevel, numThreads)
     {
         this->init(&m_buf );
     };
@@ -346,8 +389,12 @@ public:
     typedef std::basic_ostream<Elem,Tr>                        ostream_type;
     typedef ostream_type&                                      ostream_reference;
 
-    basic_bgzf_ostream(ostream_reference ostream_) :
-        bgzf_ostreambase_type(ostream_),
+    // The compression level ranges from 0 (no compression) to 9 (best compression) with zlib and to 12 with
+    // libdeflate; negative values select the default level of the deflate library.
+    basic_bgzf_ostream(ostream_reference ostream_,
+                       int compressionLevel = bgzf_default_compression_level,
+                       size_t numThreads = bgzf_thread_count) :
+        bgzf_ostreambase_type(ostream_, compressionLevel, numThreads),
         ostream_type(bgzf_ostreambase_type::rdbuf())
     {}
 
@@ -0,0 +1,197 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_istream.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without ZSTD-support."
+#endif
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <zstd.h>
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambuf
+// --------------------------------------------------------------------------
+
+/*!\brief A stream buffer that decompresses zstd compressed data from another stream.
+ * \tparam char_t   The character type of the stream; must have the size of a byte.
+ * \tparam traits_t The character traits of the stream.
+ *
+ * \details
+ *
+ * Multiple concatenated zstd frames are decompressed as one continuous stream.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1, "The zstd streams only support character types with the size of a byte.");
+
+public:
+    //!\brief The character type.
+    using char_type = char_t;
+    //!\brief The integer type of the characters.
+    using int_type = typename traits_t::int_type;
+    //!\brief The type of the compressed stream.
+    using istream_reference = std::basic_istream<char_t, traits_t> &;
+
+    /*!\brief Constructs the stream buffer on top of the compressed stream.
+     * \param[in] istream_ The stream holding the compressed data.
+     * \throws seqan3::io_error If the decompression context could not be created.
+     */
+    explicit basic_zstd_istreambuf(istream_reference istream_) :
+        compressed_stream{istream_},
+        context{ZSTD_createDCtx()},
+        compressed_buffer(ZSTD_DStreamInSize()),
+        decompressed_buffer(ZSTD_DStreamOutSize())
+    {
+        if (context == nullptr)
+            throw io_error{"Creating the zstd decompression context failed."};
+
+        input = ZSTD_inBuffer{compressed_buffer.data(), 0, 0};
+        this->setg(decompressed_buffer.data(), decompressed_buffer.data(), decompressed_buffer.data());
+    }
+
+    //!\brief Decompresses the next characters into the buffer.
+    int_type underflow() override
+    {
+        if (this->gptr() < this->egptr())
+            return traits_t::to_int_type(*this->gptr());
+
+        while (true)
+        {
+            if (input.pos == input.size && !fill_input_buffer())
+                return traits_t::eof(); // The compressed stream is exhausted.
+
+            ZSTD_outBuffer output{decompressed_buffer.data(), decompressed_buffer.size(), 0};
+            size_t const result = ZSTD_decompressStream(context.get(), &output, &input);
+
+            if (ZSTD_isError(result))
+                throw io_error{std::string{"Decompressing the zstd stream failed: "} + ZSTD_getErrorName(result)};
+
+            if (output.pos > 0)
+            {
+                this->setg(decompressed_buffer.data(),
+                           decompressed_buffer.data(),
+                           decompressed_buffer.data() + output.pos);
+                return traits_t::to_int_type(*this->gptr());
+            }
+        }
+    }
+
+private:
+    //!\brief Reads the next compressed characters; returns `false` if no characters are left.
+    bool fill_input_buffer()
+    {
+        compressed_stream.read(compressed_buffer.data(), compressed_buffer.size());
+        input = ZSTD_inBuffer{compressed_buffer.data(), static_cast<size_t>(compressed_stream.gcount()), 0};
+        return input.size > 0;
+    }
+
+    //!\brief Frees the decompression context.
+    struct context_deleter
+    {
+        //!\brief Frees the context.
+        void operator()(ZSTD_DCtx * ptr) const noexcept
+        {
+            ZSTD_freeDCtx(ptr);
+        }
+    };
+
+    //!\brief The stream holding the compressed data.
+    istream_reference compressed_stream;
+    //!\brief The zstd decompression context.
+    std::unique_ptr<ZSTD_DCtx, context_deleter> context;
+    //!\brief The compressed characters read from the stream.
+    std::vector<char_t> compressed_buffer;
+    //!\brief The decompressed characters; the get area of the stream buffer.
+    std::vector<char_t> decompressed_buffer;
+    //!\brief The part of the compressed buffer that has not been decompressed yet.
+    ZSTD_inBuffer input{};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambase
+// --------------------------------------------------------------------------
+
+//!\brief Holds the stream buffer, such that it is constructed before the std::basic_istream.
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istreambase : virtual public std::basic_ios<char_t, traits_t>
+{
+public:
+    //!\brief The type of the stream buffer.
+    using unzstd_streambuf_type = basic_zstd_istreambuf<char_t, traits_t>;
+
+    //!\brief Constructs the stream buffer on top of the compressed stream.
+    explicit basic_zstd_istreambase(std::basic_istream<char_t, traits_t> & istream_) : m_buf{istream_}
+    {
+        this->init(&m_buf);
+    }
+
+    //!\brief Returns the stream buffer.
+    unzstd_streambuf_type * rdbuf()
+    {
+        return &m_buf;
+    }
+
+private:
+    //!\brief The stream buffer.
+    unzstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istream
+// --------------------------------------------------------------------------
+
+/*!\brief An input stream that decompresses zstd compressed data from another stream.
+ * \tparam char_t   The character type of the stream; must have the size of a byte.
+ * \tparam traits_t The character traits of the stream.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istream :
+    public basic_zstd_istreambase<char_t, traits_t>,
+    public std::basic_istream<char_t, traits_t>
+{
+public:
+    //!\brief The base holding the stream buffer.
+    using zstd_istreambase_type = basic_zstd_istreambase<char_t, traits_t>;
+    //!\brief The type of the std::basic_istream.
+    using istream_type = std::basic_istream<char_t, traits_t>;
+    //!\brief The type of the compressed stream.
+    using istream_reference = istream_type &;
+
+    /*!\brief Constructs the stream on top of the compressed stream.
+     * \param[in] istream_ The stream holding the compressed data.
+     */
+    explicit basic_zstd_istream(istream_reference istream_) :
+        zstd_istreambase_type{istream_},
+        istream_type{zstd_istreambase_type::rdbuf()}
+    {}
+};
+
+// --------------------------------------------------------------------------
+// typedefs
+// --------------------------------------------------------------------------
+
+//!\brief A zstd input stream over char.
+using zstd_istream = basic_zstd_istream<char>;
+
+} // namespace seqan3::contrib
@@ -0,0 +1,249 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_ostream.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without ZSTD-support."
+#endif
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <zstd.h>
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A static variable indicating the number of threads to use for the zstd output streams.
+ *        Defaults to std::thread::hardware_concurrency.
+ */
+inline static uint64_t zstd_thread_count = std::thread::hardware_concurrency();
+
+//!\brief The compression level used by the zstd output streams by default.
+inline constexpr int zstd_default_compression_level = ZSTD_CLEVEL_DEFAULT;
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambuf
+// --------------------------------------------------------------------------
+
+/*!\brief A stream buffer that compresses the written characters with zstd into another stream.
+ * \tparam char_t   The character type of the stream; must have the size of a byte.
+ * \tparam traits_t The character traits of the stream.
+ *
+ * \details
+ *
+ * If more than one thread is requested, zstd compresses the data with the given number of worker threads in the
+ * background. If the zstd library was built without multi-threading support, the data is compressed by the calling
+ * thread. Flushing the stream finishes the current block, while the frame is completed on destruction.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1, "The zstd streams only support character types with the size of a byte.");
+
+public:
+    //!\brief The character type.
+    using char_type = char_t;
+    //!\brief The integer type of the characters.
+    using int_type = typename traits_t::int_type;
+    //!\brief The type of the target stream.
+    using ostream_reference = std::basic_ostream<char_t, traits_t> &;
+
+    /*!\brief Constructs the stream buffer on top of the target stream.
+     * \param[in] ostream_           The stream the compressed data is written to.
+     * \param[in] compression_level_ The zstd compression level.
+     * \param[in] thread_count_      The number of threads used for compression.
+     * \throws seqan3::io_error If the compression context could not be created or configured.
+     */
+    basic_zstd_ostreambuf(ostream_reference ostream_, int const compression_level_, size_t const thread_count_) :
+        compressed_stream{ostream_},
+        context{ZSTD_createCCtx()},
+        uncompressed_buffer(ZSTD_CStreamInSize()),
+        compressed_buffer(ZSTD_CStreamOutSize())
+    {
+        if (context == nullptr)
+            throw io_error{"Creating the zstd compression context failed."};
+
+        if (ZSTD_isError(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel, compression_level_)))
+            throw io_error{"Setting the zstd compression level failed."};
+
+        // Fails if zstd was built without multi-threading support; the data is then compressed by this thread.
+        if (thread_count_ > 1)
+            ZSTD_CCtx_setParameter(context.get(), ZSTD_c_nbWorkers, static_cast<int>(thread_count_));
+
+        this->setp(uncompressed_buffer.data(), uncompressed_buffer.data() + uncompressed_buffer.size());
+    }
+
+    //!\brief Completes the zstd frame.
+    ~basic_zstd_ostreambuf()
+    {
+        try
+        {
+            compress_buffer(ZSTD_e_end);
+            compressed_stream.flush();
+        }
+        catch (...)
+        {} // Destructors must not throw.
+    }
+
+    //!\brief Compresses the buffered characters and appends the given character.
+    int_type overflow(int_type c) override
+    {
+        compress_buffer(ZSTD_e_continue);
+
+        if (!traits_t::eq_int_type(c, traits_t::eof()))
+        {
+            *this->pptr() = traits_t::to_char_type(c);
+            this->pbump(1);
+        }
+
+        return traits_t::not_eof(c);
+    }
+
+    //!\brief Compresses and writes all characters to the target stream.
+    int sync() override
+    {
+        compress_buffer(ZSTD_e_flush);
+        compressed_stream.flush();
+        return compressed_stream.good() ? 0 : -1;
+    }
+
+private:
+    //!\brief Compresses the buffered characters; flushes or ends the frame depending on the given directive.
+    void compress_buffer(ZSTD_EndDirective const directive)
+    {
+        ZSTD_inBuffer input{this->pbase(), static_cast<size_t>(this->pptr() - this->pbase()), 0};
+        bool finished = false;
+
+        while (!finished)
+        {
+            ZSTD_outBuffer output{compressed_buffer.data(), compressed_buffer.size(), 0};
+            size_t const remaining = ZSTD_compressStream2(context.get(), &output, &input, directive);
+
+            if (ZSTD_isError(remaining))
+                throw io_error{std::string{"Compressing the zstd stream failed: "} + ZSTD_getErrorName(remaining)};
+
+            compressed_stream.write(compressed_buffer.data(), output.pos);
+
+            // For ZSTD_e_continue it suffices to consume the input, otherwise zstd must have written everything.
+            finished = (directive == ZSTD_e_continue) ? (input.pos == input.size) : (remaining == 0);
+        }
+
+        this->setp(uncompressed_buffer.data(), uncompressed_buffer.data() + uncompressed_buffer.size());
+    }
+
+    //!\brief Frees the compression context.
+    struct context_deleter
+    {
+        //!\brief Frees the context.
+        void operator()(ZSTD_CCtx * ptr) const noexcept
+        {
+            ZSTD_freeCCtx(ptr);
+        }
+    };
+
+    //!\brief The stream the compressed data is written to.
+    ostream_reference compressed_stream;
+    //!\brief The zstd compression context.
+    std::unique_ptr<ZSTD_CCtx, context_deleter> context;
+    //!\brief The characters that are not compressed yet; the put area of the stream buffer.
+    std::vector<char_t> uncompressed_buffer;
+    //!\brief The compressed characters before they are written.
+    std::vector<char_t> compressed_buffer;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambase
+// --------------------------------------------------------------------------
+
+//!\brief Holds the stream buffer, such that it is constructed before the std::basic_ostream.
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostreambase : virtual public std::basic_ios<char_t, traits_t>
+{
+public:
+    //!\brief The type of the stream buffer.
+    using zstd_streambuf_type = basic_zstd_ostreambuf<char_t, traits_t>;
+
+    //!\brief Constructs the stream buffer on top of the target stream.
+    basic_zstd_ostreambase(std::basic_ostream<char_t, traits_t> & ostream_,
+                           int const compression_level_,
+                           size_t const thread_count_) :
+        m_buf{ostream_, compression_level_, thread_count_}
+    {
+        this->init(&m_buf);
+    }
+
+    //!\brief Returns the stream buffer.
+    zstd_streambuf_type * rdbuf()
+    {
+        return &m_buf;
+    }
+
+private:
+    //!\brief The stream buffer.
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostream
+// --------------------------------------------------------------------------
+
+/*!\brief An output stream that compresses the written data with zstd into another stream.
+ * \tparam char_t   The character type of the stream; must have the size of a byte.
+ * \tparam traits_t The character traits of the stream.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostream :
+    public basic_zstd_ostreambase<char_t, traits_t>,
+    public std::basic_ostream<char_t, traits_t>
+{
+public:
+    //!\brief The base holding the stream buffer.
+    using zstd_ostreambase_type = basic_zstd_ostreambase<char_t, traits_t>;
+    //!\brief The type of the std::basic_ostream.
+    using ostream_type = std::basic_ostream<char_t, traits_t>;
+    //!\brief The type of the target stream.
+    using ostream_reference = ostream_type &;
+
+    /*!\brief Constructs the stream on top of the target stream.
+     * \param[in] ostream_           The stream the compressed data is written to.
+     * \param[in] compression_level_ The zstd compression level.
+     * \param[in] thread_count_      The number of threads used for compression.
+     */
+    explicit basic_zstd_ostream(ostream_reference ostream_,
+                                int const compression_level_ = zstd_default_compression_level,
+                                size_t const thread_count_ = zstd_thread_count) :
+        zstd_ostreambase_type{ostream_, compression_level_, thread_count_},
+        ostream_type{zstd_ostreambase_type::rdbuf()}
+    {}
+
+    //!\brief Flushes the stream; the zstd frame is completed by the destructor of the stream buffer.
+    ~basic_zstd_ostream()
+    {
+        this->flush();
+    }
+};
+
+// --------------------------------------------------------------------------
+// typedefs
+// --------------------------------------------------------------------------
+
+//!\brief A zstd output stream over char.
+using zstd_ostream = basic_zstd_ostream<char>;
+
+} // namespace seqan3::contrib
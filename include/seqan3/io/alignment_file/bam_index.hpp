@@ -0,0 +1,656 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_index.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+// Forward declaration for the friend declaration in seqan3::bam_index.
+class bam_index_builder;
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief The index of a coordinate-sorted BAM file, as stored in `.bai` and `.csi` files.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The index implements the binning scheme of the [SAM specifications](https://samtools.github.io/hts-specs/): every
+ * record is assigned to the smallest bin that contains its alignment, and each bin stores the chunks of the BAM file
+ * that contain its records as BGZF virtual offsets. query() returns the chunks that may contain records overlapping a
+ * region, such that only the BGZF blocks of these chunks need to be decompressed.
+ *
+ * Both the BAI format (fixed binning scheme for references of up to 2^29 bases) and the CSI format (configurable
+ * binning scheme for longer references) can be read. An index is written in the format it was read or built in.
+ *
+ * Usually, you do not query the index yourself, but pass a region to seqan3::alignment_file_input::set_region.
+ * An index is built while writing a coordinate-sorted BAM file if
+ * seqan3::alignment_file_output_options::bam_create_index is set.
+ */
+class bam_index
+{
+public:
+    //!\brief A contiguous part of the BAM file, given by BGZF virtual offsets.
+    struct chunk
+    {
+        //!\brief The virtual offset of the first record.
+        uint64_t begin{};
+        //!\brief The virtual offset behind the last record.
+        uint64_t end{};
+
+        //!\brief Compares both offsets.
+        friend bool operator==(chunk const & lhs, chunk const & rhs) noexcept
+        {
+            return lhs.begin == rhs.begin && lhs.end == rhs.end;
+        }
+
+        //!\brief Compares both offsets.
+        friend bool operator!=(chunk const & lhs, chunk const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_index() = default;                              //!< Defaulted.
+    bam_index(bam_index const &) = default;             //!< Defaulted.
+    bam_index(bam_index &&) = default;                  //!< Defaulted.
+    bam_index & operator=(bam_index const &) = default; //!< Defaulted.
+    bam_index & operator=(bam_index &&) = default;      //!< Defaulted.
+    ~bam_index() = default;                             //!< Defaulted.
+    //!\}
+
+    /*!\brief Reads a `.bai` or a `.csi` file; the format is detected from the magic string.
+     * \param[in] index_stream The stream over the index file.
+     * \throws seqan3::format_error If the stream does not contain a valid BAI or CSI index.
+     */
+    void read(std::istream & index_stream)
+    {
+        std::string magic(4, '\0');
+        index_stream.read(magic.data(), magic.size());
+
+        if (magic == std::string{"BAI\1"})
+        {
+            csi = false;
+            min_shift = bai_min_shift;
+            depth = bai_depth;
+            aux.clear();
+        }
+        else if (magic == std::string{"CSI\1"})
+        {
+            csi = true;
+            min_shift = read_integer<int32_t>(index_stream);
+            depth = read_integer<int32_t>(index_stream);
+            aux.resize(read_count(index_stream));
+            read_bytes(index_stream, aux.data(), aux.size());
+
+            if (min_shift < 0 || depth < 0 || min_shift + 3 * depth > 63)
+                throw format_error{"The binning scheme of the CSI index is invalid."};
+        }
+        else
+        {
+            throw format_error{"The file is neither a BAI nor a CSI index."};
+        }
+
+        references.clear();
+        references.resize(read_count(index_stream));
+
+        for (reference_index & reference : references)
+        {
+            for (size_t bin_count = read_count(index_stream); bin_count > 0; --bin_count)
+            {
+                uint32_t const bin_id = read_integer<uint32_t>(index_stream);
+                bin_index & bin = reference.bins[bin_id];
+
+                if (csi)
+                    bin.loffset = read_integer<uint64_t>(index_stream);
+
+                bin.chunks.resize(read_count(index_stream));
+                for (chunk & current : bin.chunks)
+                {
+                    current.begin = read_integer<uint64_t>(index_stream);
+                    current.end = read_integer<uint64_t>(index_stream);
+                }
+            }
+
+            if (!csi)
+            {
+                reference.linear_index.resize(read_count(index_stream));
+                for (uint64_t & offset : reference.linear_index)
+                    offset = read_integer<uint64_t>(index_stream);
+            }
+        }
+
+        // The number of unplaced unmapped reads is optional.
+        uint64_t unplaced{};
+        if (index_stream.read(reinterpret_cast<char *>(&unplaced), sizeof(unplaced)))
+            unplaced_unmapped_count = detail::to_little_endian(unplaced);
+        else
+            unplaced_unmapped_count = 0;
+    }
+
+    /*!\brief Writes the index as `.bai` or `.csi` file, depending on the format it was read or built in.
+     * \param[in] index_stream The stream to write to.
+     */
+    void write(std::ostream & index_stream) const
+    {
+        if (csi)
+        {
+            index_stream.write("CSI\1", 4);
+            write_integer(index_stream, min_shift);
+            write_integer(index_stream, depth);
+            write_integer(index_stream, static_cast<int32_t>(aux.size()));
+            index_stream.write(aux.data(), aux.size());
+        }
+        else
+        {
+            index_stream.write("BAI\1", 4);
+        }
+
+        write_integer(index_stream, static_cast<int32_t>(references.size()));
+
+        for (reference_index const & reference : references)
+        {
+            write_integer(index_stream, static_cast<int32_t>(reference.bins.size()));
+
+            for (auto const & [bin_id, bin] : reference.bins)
+            {
+                write_integer(index_stream, bin_id);
+
+                if (csi)
+                    write_integer(index_stream, bin.loffset);
+
+                write_integer(index_stream, static_cast<int32_t>(bin.chunks.size()));
+                for (chunk const & current : bin.chunks)
+                {
+                    write_integer(index_stream, current.begin);
+                    write_integer(index_stream, current.end);
+                }
+            }
+
+            if (!csi)
+            {
+                write_integer(index_stream, static_cast<int32_t>(reference.linear_index.size()));
+                for (uint64_t const offset : reference.linear_index)
+                    write_integer(index_stream, offset);
+            }
+        }
+
+        write_integer(index_stream, unplaced_unmapped_count);
+    }
+
+    /*!\brief Returns the chunks of the BAM file that may contain records overlapping the region.
+     * \param[in] ref_id The index of the reference in the header of the BAM file.
+     * \param[in] begin  The first position of the region (0-based).
+     * \param[in] end    The position behind the last position of the region.
+     * \returns The chunks sorted by offset; overlapping and adjacent chunks are merged.
+     *
+     * \details
+     *
+     * The chunks may also contain records that do not overlap the region, which must be skipped by the caller.
+     * Chunks that end before the first record overlapping the 16 kbp window of `begin` (given by the linear index,
+     * respectively the bin offsets of CSI) are omitted.
+     */
+    std::vector<chunk> query(int32_t const ref_id, int64_t const begin, int64_t const end) const
+    {
+        std::vector<chunk> result{};
+
+        if (ref_id < 0 || static_cast<size_t>(ref_id) >= references.size() || begin >= end)
+            return result;
+
+        reference_index const & reference = references[ref_id];
+        int64_t const query_begin = std::max<int64_t>(begin, 0);
+        uint64_t const min_offset = minimal_offset(reference, query_begin);
+
+        for (uint32_t const bin_id : reg2bins(query_begin, end, min_shift, depth))
+        {
+            auto it = reference.bins.find(bin_id);
+            if (it == reference.bins.end())
+                continue;
+
+            for (chunk const & current : it->second.chunks)
+                if (current.end > min_offset)
+                    result.push_back(current);
+        }
+
+        std::sort(result.begin(), result.end(), [] (chunk const & lhs, chunk const & rhs)
+        {
+            return lhs.begin < rhs.begin;
+        });
+
+        // Merge overlapping and adjacent chunks, such that every BGZF block is read only once.
+        size_t merged_size = 0;
+        for (chunk const & current : result)
+        {
+            if (merged_size > 0 && current.begin <= result[merged_size - 1].end)
+                result[merged_size - 1].end = std::max(result[merged_size - 1].end, current.end);
+            else
+                result[merged_size++] = current;
+        }
+        result.resize(merged_size);
+
+        return result;
+    }
+
+    //!\brief Returns the number of references in the index.
+    size_t reference_count() const noexcept
+    {
+        return references.size();
+    }
+
+    //!\brief Returns whether the index uses the CSI format.
+    bool is_csi() const noexcept
+    {
+        return csi;
+    }
+
+    //!\brief Compares the contents of both indices.
+    friend bool operator==(bam_index const & lhs, bam_index const & rhs) noexcept
+    {
+        return lhs.csi == rhs.csi && lhs.min_shift == rhs.min_shift && lhs.depth == rhs.depth && lhs.aux == rhs.aux &&
+               lhs.references == rhs.references && lhs.unplaced_unmapped_count == rhs.unplaced_unmapped_count;
+    }
+
+    //!\brief Compares the contents of both indices.
+    friend bool operator!=(bam_index const & lhs, bam_index const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /*!\name Binning scheme
+     * \{
+     */
+    /*!\brief Computes the bin of the region [beg, end); the generalisation of `reg2bin` of the SAM specifications.
+     * \param[in] beg       The first position of the region.
+     * \param[in] end       The position behind the last position of the region; must be greater than `beg`.
+     * \param[in] min_shift The binary logarithm of the size of the smallest bins; 14 for BAI.
+     * \param[in] depth     The number of levels below the root bin; 5 for BAI.
+     */
+    static constexpr uint32_t reg2bin(int64_t const beg, int64_t end, int32_t const min_shift, int32_t const depth)
+        noexcept
+    {
+        int32_t shift = min_shift;
+        uint32_t first = first_bin(depth);
+
+        --end;
+        for (int32_t level = depth; level > 0; --level, shift += 3, first = first_bin(level))
+            if (beg >> shift == end >> shift)
+                return first + (beg >> shift);
+
+        return 0;
+    }
+
+    /*!\brief Computes the bins that may contain records overlapping the region [beg, end); the generalisation of
+     *        `reg2bins` of the SAM specifications.
+     * \param[in] beg       The first position of the region.
+     * \param[in] end       The position behind the last position of the region.
+     * \param[in] min_shift The binary logarithm of the size of the smallest bins; 14 for BAI.
+     * \param[in] depth     The number of levels below the root bin; 5 for BAI.
+     */
+    static std::vector<uint32_t> reg2bins(int64_t const beg, int64_t end, int32_t const min_shift, int32_t const depth)
+    {
+        std::vector<uint32_t> bins{};
+
+        if (beg >= end)
+            return bins;
+
+        int32_t shift = min_shift + 3 * depth;
+        end = std::min<int64_t>(end, int64_t{1} << shift);
+
+        --end;
+        for (int32_t level = 0; level <= depth; ++level, shift -= 3)
+        {
+            uint32_t const first = first_bin(level);
+            for (int64_t bin = first + (beg >> shift); bin <= first + (end >> shift); ++bin)
+                bins.push_back(static_cast<uint32_t>(bin));
+        }
+
+        return bins;
+    }
+    //!\}
+
+private:
+    //!\brief The seqan3::detail::bam_index_builder fills the bins.
+    friend class detail::bam_index_builder;
+
+    //!\brief The binary logarithm of the size of the smallest bins of BAI.
+    static constexpr int32_t bai_min_shift = 14;
+    //!\brief The number of levels below the root bin of BAI.
+    static constexpr int32_t bai_depth = 5;
+
+    //!\brief The chunks of a bin.
+    struct bin_index
+    {
+        //!\brief The smallest offset of the records overlapping the first window of the bin; only stored by CSI.
+        uint64_t loffset{};
+        //!\brief The chunks containing the records of the bin.
+        std::vector<chunk> chunks{};
+
+        //!\brief Compares the members.
+        friend bool operator==(bin_index const & lhs, bin_index const & rhs) noexcept
+        {
+            return lhs.loffset == rhs.loffset && lhs.chunks == rhs.chunks;
+        }
+    };
+
+    //!\brief The bins and the linear index of a reference.
+    struct reference_index
+    {
+        //!\brief The non-empty bins, including the pseudo-bin with meta data.
+        std::map<uint32_t, bin_index> bins{};
+        //!\brief The smallest offset of the records overlapping each window of 2^min_shift bases; only stored by BAI.
+        std::vector<uint64_t> linear_index{};
+
+        //!\brief Compares the members.
+        friend bool operator==(reference_index const & lhs, reference_index const & rhs) noexcept
+        {
+            return lhs.bins == rhs.bins && lhs.linear_index == rhs.linear_index;
+        }
+    };
+
+    //!\brief Returns the first bin of a level.
+    static constexpr uint32_t first_bin(int32_t const level) noexcept
+    {
+        return ((uint32_t{1} << (3 * level)) - 1) / 7;
+    }
+
+    //!\brief Returns the id of the pseudo-bin storing the meta data of a reference.
+    static constexpr uint32_t pseudo_bin(int32_t const depth) noexcept
+    {
+        return first_bin(depth + 1) + 1;
+    }
+
+    //!\brief Returns the offset before which no record overlaps the given position.
+    uint64_t minimal_offset(reference_index const & reference, int64_t const position) const
+    {
+        if (!csi)
+        {
+            if (reference.linear_index.empty())
+                return 0;
+
+            size_t const window = std::min<size_t>(position >> min_shift, reference.linear_index.size() - 1);
+            return reference.linear_index[window];
+        }
+
+        // The offset of the smallest existing bin containing the position.
+        uint32_t bin_id = first_bin(depth) + (position >> min_shift);
+        while (true)
+        {
+            if (auto it = reference.bins.find(bin_id); it != reference.bins.end())
+                return it->second.loffset;
+
+            if (bin_id == 0)
+                return 0;
+
+            bin_id = (bin_id - 1) >> 3; // parent bin
+        }
+    }
+
+    //!\brief Reads a little-endian integer.
+    template <typename integer_t>
+    static integer_t read_integer(std::istream & index_stream)
+    {
+        integer_t value{};
+        read_bytes(index_stream, reinterpret_cast<char *>(&value), sizeof(value));
+        return detail::to_little_endian(value);
+    }
+
+    //!\brief Reads a count and checks that it is not negative.
+    static size_t read_count(std::istream & index_stream)
+    {
+        int32_t const count = read_integer<int32_t>(index_stream);
+
+        if (count < 0)
+            throw format_error{"The BAM index contains a negative count."};
+
+        return count;
+    }
+
+    //!\brief Reads the given number of bytes.
+    static void read_bytes(std::istream & index_stream, char * target, size_t const count)
+    {
+        if (!index_stream.read(target, count))
+            throw format_error{"Unexpected end of the BAM index."};
+    }
+
+    //!\brief Writes a little-endian integer.
+    template <typename integer_t>
+    static void write_integer(std::ostream & index_stream, integer_t value)
+    {
+        value = detail::to_little_endian(value);
+        index_stream.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    //!\brief Whether the index uses the CSI format.
+    bool csi{false};
+    //!\brief The binary logarithm of the size of the smallest bins.
+    int32_t min_shift{bai_min_shift};
+    //!\brief The number of levels below the root bin.
+    int32_t depth{bai_depth};
+    //!\brief The auxiliary data of CSI.
+    std::string aux{};
+    //!\brief The bins of each reference.
+    std::vector<reference_index> references{};
+    //!\brief The number of unmapped reads without a position.
+    uint64_t unplaced_unmapped_count{};
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Builds a seqan3::bam_index from the records of a coordinate-sorted BAM file.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The offsets passed to push() may be of any kind as long as they increase, e.g. positions in the uncompressed BAM
+ * data. finish() translates them into BGZF virtual offsets.
+ *
+ * Like samtools, the builder creates a BAI index if all references are shorter than 2^29 bases and a CSI index with
+ * as many levels as needed otherwise.
+ */
+class bam_index_builder
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_index_builder() = delete;                                      //!< Deleted.
+    bam_index_builder(bam_index_builder const &) = default;             //!< Defaulted.
+    bam_index_builder(bam_index_builder &&) = default;                  //!< Defaulted.
+    bam_index_builder & operator=(bam_index_builder const &) = default; //!< Defaulted.
+    bam_index_builder & operator=(bam_index_builder &&) = default;      //!< Defaulted.
+    ~bam_index_builder() = default;                                     //!< Defaulted.
+
+    /*!\brief Prepares the index for the given references.
+     * \param[in] reference_count          The number of references in the header.
+     * \param[in] maximal_reference_length The length of the longest reference.
+     */
+    bam_index_builder(size_t const reference_count, uint64_t const maximal_reference_length)
+    {
+        while ((uint64_t{1} << (index.min_shift + 3 * index.depth)) < maximal_reference_length)
+            ++index.depth;
+
+        index.csi = index.depth != bam_index::bai_depth;
+        index.references.resize(reference_count);
+        statistics.resize(reference_count);
+    }
+    //!\}
+
+    /*!\brief Adds a record.
+     * \param[in] ref_id       The index of the reference; -1 for unplaced records.
+     * \param[in] begin        The position of the record; -1 for records without a position.
+     * \param[in] end          The position behind the last aligned base of the record.
+     * \param[in] mapped       Whether the record is mapped.
+     * \param[in] offset_begin The offset of the record in the file.
+     * \param[in] offset_end   The offset behind the record in the file.
+     * \throws seqan3::format_error If the records are not sorted by coordinate.
+     */
+    void push(int32_t const ref_id,
+              int64_t const begin,
+              int64_t end,
+              bool const mapped,
+              uint64_t const offset_begin,
+              uint64_t const offset_end)
+    {
+        if (ref_id < 0) // Unplaced reads are at the end of a sorted file.
+        {
+            ++index.unplaced_unmapped_count;
+            last_ref_id = std::numeric_limits<int32_t>::max();
+            return;
+        }
+
+        if (static_cast<size_t>(ref_id) >= index.references.size())
+            throw format_error{"The reference id of the record is not in the header of the BAM file."};
+
+        if (ref_id < last_ref_id || (ref_id == last_ref_id && begin >= 0 && begin < last_begin))
+            throw format_error{"Cannot build the BAM index, because the records are not sorted by coordinate."};
+
+        if (begin < 0) // Records of a reference without a position come first within the reference; not binned.
+        {
+            reference_statistics & current = statistics[ref_id];
+            current.offset_begin = std::min(current.offset_begin, offset_begin);
+            current.offset_end = std::max(current.offset_end, offset_end);
+            ++current.unmapped;
+            return;
+        }
+
+        last_ref_id = ref_id;
+        last_begin = begin;
+        end = std::max(end, begin + 1); // Records without aligned bases cover one position.
+
+        bam_index::reference_index & reference = index.references[ref_id];
+
+        // Extend the last chunk of the bin if the record directly follows it.
+        std::vector<bam_index::chunk> & chunks =
+            reference.bins[bam_index::reg2bin(begin, end, index.min_shift, index.depth)].chunks;
+
+        if (!chunks.empty() && chunks.back().end == offset_begin)
+            chunks.back().end = offset_end;
+        else
+            chunks.push_back(bam_index::chunk{offset_begin, offset_end});
+
+        // The linear index stores the offset of the first record overlapping each window.
+        size_t const last_window = (end - 1) >> index.min_shift;
+        if (reference.linear_index.size() <= last_window)
+            reference.linear_index.resize(last_window + 1, unset);
+
+        for (size_t window = begin >> index.min_shift; window <= last_window; ++window)
+            if (reference.linear_index[window] == unset)
+                reference.linear_index[window] = offset_begin;
+
+        reference_statistics & current = statistics[ref_id];
+        current.offset_begin = std::min(current.offset_begin, offset_begin);
+        current.offset_end = std::max(current.offset_end, offset_end);
+        ++(mapped ? current.mapped : current.unmapped);
+    }
+
+    /*!\brief Returns the index with all offsets translated into virtual offsets.
+     * \tparam translate_t The type of the translation; must be invocable with and return `uint64_t`.
+     * \param[in] translate Translates the offsets passed to push() into BGZF virtual offsets.
+     */
+    template <typename translate_t>
+    bam_index finish(translate_t && translate) const
+    {
+        bam_index result = index;
+        uint32_t const pseudo = bam_index::pseudo_bin(result.depth);
+
+        for (size_t ref_id = 0; ref_id < result.references.size(); ++ref_id)
+        {
+            bam_index::reference_index & reference = result.references[ref_id];
+
+            // Windows without records get the offset of the previous window.
+            uint64_t previous = 0;
+            for (uint64_t & offset : reference.linear_index)
+                offset = (offset == unset) ? previous : (previous = translate(offset));
+
+            for (auto & [bin_id, bin] : reference.bins)
+            {
+                for (bam_index::chunk & current : bin.chunks)
+                    current = bam_index::chunk{translate(current.begin), translate(current.end)};
+
+                if (result.csi)
+                    bin.loffset = bin_offset(reference, bin_id);
+            }
+
+            if (reference_statistics const & current = statistics[ref_id]; current.mapped + current.unmapped > 0)
+            {
+                reference.bins[pseudo].chunks = {bam_index::chunk{translate(current.offset_begin),
+                                                                  translate(current.offset_end)},
+                                                 bam_index::chunk{current.mapped, current.unmapped}};
+            }
+
+            if (result.csi)
+                reference.linear_index.clear(); // CSI stores the offsets in the bins instead.
+        }
+
+        return result;
+    }
+
+private:
+    //!\brief Marks windows of the linear index without records.
+    static constexpr uint64_t unset = std::numeric_limits<uint64_t>::max();
+
+    //!\brief The meta data stored in the pseudo-bin of a reference.
+    struct reference_statistics
+    {
+        //!\brief The offset of the first record.
+        uint64_t offset_begin{unset};
+        //!\brief The offset behind the last record.
+        uint64_t offset_end{0};
+        //!\brief The number of mapped records.
+        uint64_t mapped{0};
+        //!\brief The number of unmapped records.
+        uint64_t unmapped{0};
+    };
+
+    //!\brief Returns the linear offset of the first window covered by a bin; for CSI.
+    uint64_t bin_offset(bam_index::reference_index const & reference, uint32_t const bin_id) const
+    {
+        if (bin_id >= bam_index::first_bin(index.depth + 1)) // the pseudo-bin
+            return 0;
+
+        int32_t level = 0;
+        while (level < index.depth && bin_id >= bam_index::first_bin(level + 1))
+            ++level;
+
+        size_t const window = static_cast<size_t>(bin_id - bam_index::first_bin(level)) << (3 * (index.depth - level));
+        return window < reference.linear_index.size() ? reference.linear_index[window] : 0;
+    }
+
+    //!\brief The index with offsets that are not yet translated.
+    bam_index index{};
+    //!\brief The meta data of each reference.
+    std::vector<reference_statistics> statistics{};
+    //!\brief The reference of the last record; for checking the sorting.
+    int32_t last_ref_id{-1};
+    //!\brief The position of the last record; for checking the sorting.
+    int64_t last_begin{-1};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,214 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the conversion of sequences and qualities from and to their BAM representation.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/detail/convert.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/range/container/concept.hpp>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Maps a byte of a BAM sequence to the two bases it stores, converted to `alphabet_type`.
+ * \ingroup alignment_file
+ * \tparam alphabet_type The alphabet of the sequence; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * BAM stores two seqan3::sam_dna16 ranks per byte, the first base in the high nibble. Looking up both bases at once
+ * avoids the shifts and the conversion through seqan3::sam_dna16 per base.
+ */
+template <writable_alphabet alphabet_type>
+inline constexpr std::array<std::array<alphabet_type, 2>, 256> bam_byte_to_bases
+{
+    [] () constexpr
+    {
+        constexpr auto from_dna16 = convert_through_char_representation<alphabet_type, sam_dna16>;
+
+        std::array<std::array<alphabet_type, 2>, 256> table{};
+        for (size_t byte = 0; byte < 256; ++byte)
+            table[byte] = {from_dna16[byte >> 4], from_dna16[byte & 0x0f]};
+
+        return table;
+    }()
+};
+
+/*!\brief Maps a letter of `alphabet_type` to the seqan3::sam_dna16 rank that BAM stores for it.
+ * \ingroup alignment_file
+ * \tparam alphabet_type The alphabet of the sequence; must model seqan3::alphabet.
+ */
+template <alphabet alphabet_type>
+inline constexpr std::array<uint8_t, alphabet_size<alphabet_type>> bam_base_to_nibble
+{
+    [] () constexpr
+    {
+        constexpr auto to_dna16 = convert_through_char_representation<sam_dna16, alphabet_type>;
+
+        std::array<uint8_t, alphabet_size<alphabet_type>> table{};
+        for (size_t rank = 0; rank < table.size(); ++rank)
+            table[rank] = to_rank(to_dna16[rank]);
+
+        return table;
+    }()
+};
+
+/*!\brief Maps a byte of the BAM qualities (the Phred score) to a letter of `alphabet_type`.
+ * \ingroup alignment_file
+ * \tparam alphabet_type The alphabet of the qualities; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * The letter is assigned from the Phred+33 character, just like when reading SAM files.
+ */
+template <writable_alphabet alphabet_type>
+inline constexpr std::array<alphabet_type, 256> bam_byte_to_quality
+{
+    [] () constexpr
+    {
+        std::array<alphabet_type, 256> table{};
+        for (size_t byte = 0; byte < 256; ++byte)
+            assign_char_to(static_cast<char>(byte + 33), table[byte]);
+
+        return table;
+    }()
+};
+
+/*!\brief Decodes the bases `[begin, end)` of a BAM sequence.
+ * \ingroup alignment_file
+ * \tparam alphabet_type   The alphabet to decode to; must model seqan3::writable_alphabet.
+ * \tparam output_iterator The type of the output iterator.
+ * \param[in] packed The packed sequence, two bases per byte.
+ * \param[in] begin  The position of the first base to decode.
+ * \param[in] end    The position behind the last base to decode.
+ * \param[in] out    The iterator to write the bases to.
+ * \returns The output iterator behind the last written base.
+ */
+template <writable_alphabet alphabet_type, std::output_iterator<alphabet_type> output_iterator>
+output_iterator decode_bam_bases(char const * const packed, size_t begin, size_t const end, output_iterator out)
+{
+    constexpr auto const & table = bam_byte_to_bases<alphabet_type>;
+
+    if ((begin & 1) && begin < end) // starts in the low nibble
+    {
+        *out = table[static_cast<uint8_t>(packed[begin / 2])][1];
+        ++out;
+        ++begin;
+    }
+
+    for (; begin + 1 < end; begin += 2)
+    {
+        std::array<alphabet_type, 2> const & bases = table[static_cast<uint8_t>(packed[begin / 2])];
+        *out = bases[0];
+        ++out;
+        *out = bases[1];
+        ++out;
+    }
+
+    if (begin < end) // ends in the high nibble
+    {
+        *out = table[static_cast<uint8_t>(packed[begin / 2])][0];
+        ++out;
+    }
+
+    return out;
+}
+
+/*!\brief Appends the first `length` bases of a sequence to `packed` in the BAM representation.
+ * \ingroup alignment_file
+ * \tparam sequence_type The type of the sequence; must model std::ranges::input_range over a seqan3::alphabet.
+ * \param[in]     sequence The sequence to encode.
+ * \param[in]     length   The number of bases to encode; the sequence must contain at least as many.
+ * \param[in,out] packed   The buffer to append `(length + 1) / 2` bytes to.
+ */
+template <std::ranges::input_range sequence_type>
+//!\cond
+    requires alphabet<reference_t<sequence_type>>
+//!\endcond
+void encode_bam_bases(sequence_type && sequence, size_t const length, std::string & packed)
+{
+    constexpr auto const & table = bam_base_to_nibble<remove_cvref_t<reference_t<sequence_type>>>;
+
+    size_t const old_size = packed.size();
+    packed.resize(old_size + (length + 1) / 2);
+    char * out = packed.data() + old_size;
+
+    auto it = std::ranges::begin(sequence);
+    for (size_t i = 1; i < length; i += 2, ++out) // the first base of a byte goes into the high nibble
+    {
+        uint8_t const high = table[to_rank(*it)];
+        ++it;
+        *out = static_cast<char>((high << 4) | table[to_rank(*it)]);
+        ++it;
+    }
+
+    if (length & 1)
+        *out = static_cast<char>(table[to_rank(*it)] << 4);
+}
+
+/*!\brief Decodes BAM qualities.
+ * \ingroup alignment_file
+ * \tparam alphabet_type   The alphabet to decode to; must model seqan3::writable_alphabet.
+ * \tparam output_iterator The type of the output iterator.
+ * \param[in] bytes  The qualities, one Phred score per byte.
+ * \param[in] length The number of qualities.
+ * \param[in] out    The iterator to write the qualities to.
+ * \returns The output iterator behind the last written quality.
+ */
+template <writable_alphabet alphabet_type, std::output_iterator<alphabet_type> output_iterator>
+output_iterator decode_bam_qualities(char const * const bytes, size_t const length, output_iterator out)
+{
+    constexpr auto const & table = bam_byte_to_quality<alphabet_type>;
+
+    for (size_t i = 0; i < length; ++i, ++out)
+        *out = table[static_cast<uint8_t>(bytes[i])];
+
+    return out;
+}
+
+/*!\brief Appends `length` letters of a range to `target` by handing an output iterator to `decode`.
+ * \ingroup alignment_file
+ * \tparam container_type The type of the target container.
+ * \tparam decode_type    The type of the function writing the letters.
+ * \param[in,out] target The container to append to.
+ * \param[in]     length The number of letters `decode` writes.
+ * \param[in]     decode The function writing the letters to the given output iterator.
+ *
+ * \details
+ *
+ * Contiguous containers are resized once and `decode` writes to a pointer, all other containers are appended to with
+ * a std::back_insert_iterator.
+ */
+template <typename container_type, typename decode_type>
+void append_decoded(container_type & target, size_t const length, decode_type && decode)
+{
+    if constexpr (random_access_container<container_type> && std::ranges::contiguous_range<container_type>)
+    {
+        size_t const old_size = std::ranges::size(target);
+        target.resize(old_size + length);
+        decode(std::ranges::data(target) + old_size);
+    }
+    else
+    {
+        decode(std::back_inserter(target));
+    }
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,284 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_record.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/concept.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/io/alignment_file/bam_packed_sequence.hpp>
+#include <seqan3/io/alignment_file/misc.hpp>
+#include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A BAM record that is stored undecoded; every field is decoded when it is accessed.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * seqan3::alignment_file_input decodes all selected fields of every record while reading, e.g. it converts the
+ * sequence to the sequence alphabet and parses the cigar string. If most records are discarded after looking at few
+ * fields, e.g. when filtering by flag, mapping quality or position, reading the records as seqan3::bam_record is
+ * considerably faster: reading a record only copies its bytes, and the fixed-size fields (flag(), mapq(),
+ * ref_offset(), ...) are read directly from them. Variable-size fields (sequence(), cigar_vector(), tags(), ...) are
+ * decoded on every call, so store the result if you need it more than once.
+ *
+ * ```cpp
+ * seqan3::alignment_file_input fin{"mapped.bam"};
+ * seqan3::bam_record record{};
+ *
+ * while (fin.read_raw_record(record))
+ *     if (record.mapq() >= 30 && !static_cast<bool>(record.flag() & seqan3::sam_flag::unmapped))
+ *         process(record.id(), record.sequence());
+ * ```
+ *
+ * The record buffer is reused, such that reading into the same object does not allocate memory once it is large
+ * enough for the longest record.
+ */
+class bam_record
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record() = default;                               //!< Defaulted.
+    bam_record(bam_record const &) = default;             //!< Defaulted.
+    bam_record(bam_record &&) = default;                  //!< Defaulted.
+    bam_record & operator=(bam_record const &) = default; //!< Defaulted.
+    bam_record & operator=(bam_record &&) = default;      //!< Defaulted.
+    ~bam_record() = default;                              //!< Defaulted.
+
+    /*!\brief Constructs the record from its bytes.
+     * \param[in] bytes The bytes of the record, i.e. all fields following `block_size`.
+     * \throws seqan3::format_error If the lengths stored in the record do not match the number of bytes.
+     */
+    explicit bam_record(std::string_view const bytes)
+    {
+        assign(bytes);
+    }
+    //!\}
+
+    /*!\brief Replaces the record by the given bytes.
+     * \param[in] bytes The bytes of the record, i.e. all fields following `block_size`.
+     * \throws seqan3::format_error If the lengths stored in the record do not match the number of bytes.
+     */
+    void assign(std::string_view const bytes)
+    {
+        data.assign(bytes);
+        validate();
+    }
+
+    /*!\cond DEV
+     * \brief Returns the buffer of the record, to be filled with `size` bytes followed by a call to validate().
+     *        [public, but not documented as part of the API]
+     */
+    char * buffer(size_t const size)
+    {
+        data.resize(size);
+        return data.data();
+    }
+
+    /*!\brief Checks that the lengths stored in the record match its number of bytes.
+     *        [public, but not documented as part of the API]
+     * \throws seqan3::format_error If the record is malformed.
+     */
+    void validate() const
+    {
+        if (data.size() < core_size)
+            throw format_error{"The BAM record is shorter than its fixed-size fields."};
+
+        if (l_read_name() == 0 || l_seq() < 0 ||
+            data.size() < core_size + l_read_name() + 4u * n_cigar_op() + (l_seq() + 1u) / 2u + l_seq())
+            throw format_error{"The lengths stored in the BAM record exceed its size."};
+    }
+    //!\endcond
+
+    //!\brief Returns the bytes of the record, i.e. all fields following `block_size`.
+    std::string_view bytes() const noexcept
+    {
+        return data;
+    }
+
+    /*!\name Fixed-size fields
+     * \brief Read directly from the bytes of the record.
+     * \{
+     */
+    //!\brief The index of the reference in the header or std::nullopt if the record is unmapped.
+    std::optional<int32_t> ref_id() const
+    {
+        return to_optional(read<int32_t>(0));
+    }
+
+    //!\brief The 0-based position of the alignment on the reference or std::nullopt if it is not given.
+    std::optional<int32_t> ref_offset() const
+    {
+        return to_optional(read<int32_t>(4));
+    }
+
+    //!\brief The mapping quality.
+    uint8_t mapq() const
+    {
+        return read<uint8_t>(9);
+    }
+
+    //!\brief The flag.
+    sam_flag flag() const
+    {
+        return static_cast<sam_flag>(read<uint16_t>(14));
+    }
+
+    //!\brief The reference index, position and template length of the mate, see seqan3::field::mate.
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate() const
+    {
+        return {to_optional(read<int32_t>(20)), to_optional(read<int32_t>(24)), read<int32_t>(28)};
+    }
+
+    //!\brief The length of the sequence.
+    size_t sequence_size() const
+    {
+        return l_seq();
+    }
+    //!\}
+
+    /*!\name Variable-size fields
+     * \brief Decoded on every call.
+     * \{
+     */
+    //!\brief The read name; refers to the bytes of the record.
+    std::string_view id() const
+    {
+        return std::string_view{data}.substr(core_size, l_read_name() - 1); // without '\0'
+    }
+
+    //!\brief The cigar operations.
+    std::vector<cigar> cigar_vector() const
+    {
+        constexpr char const * cigar_mapping = "MIDNSHP=X*******";
+
+        std::vector<cigar> operations(n_cigar_op());
+        size_t position = cigar_begin();
+
+        for (cigar & operation : operations)
+        {
+            uint32_t const operation_and_count = read<uint32_t>(position);
+            operation = cigar{operation_and_count >> 4,
+                              cigar_op{}.assign_char(cigar_mapping[operation_and_count & 0x0f])};
+            position += 4;
+        }
+
+        return operations;
+    }
+
+    /*!\brief The sequence.
+     * \tparam alphabet_type The alphabet of the sequence; must model seqan3::writable_alphabet.
+     */
+    template <writable_alphabet alphabet_type = dna5>
+    std::vector<alphabet_type> sequence() const
+    {
+        std::vector<alphabet_type> result(l_seq());
+        detail::decode_bam_bases<alphabet_type>(data.data() + sequence_begin(), 0, result.size(), result.data());
+        return result;
+    }
+
+    /*!\brief The qualities; empty if the record stores no qualities.
+     * \tparam alphabet_type The alphabet of the qualities; must model seqan3::writable_quality_alphabet.
+     */
+    template <writable_quality_alphabet alphabet_type = phred42>
+    std::vector<alphabet_type> quality() const
+    {
+        std::vector<alphabet_type> result{};
+        char const * qualities = data.data() + sequence_begin() + (l_seq() + 1) / 2;
+
+        if (l_seq() == 0 || static_cast<uint8_t>(qualities[0]) == 0xff) // 0xff marks missing qualities
+            return result;
+
+        result.resize(l_seq());
+        detail::decode_bam_qualities<alphabet_type>(qualities, result.size(), result.data());
+
+        return result;
+    }
+
+    //!\brief The optional fields; the dictionary decodes them on first access.
+    sam_tag_dictionary tags() const
+    {
+        sam_tag_dictionary dict{};
+        dict.assign_bam_tags(std::string_view{data}.substr(sequence_begin() + (l_seq() + 1) / 2 + l_seq()));
+        return dict;
+    }
+    //!\}
+
+private:
+    //!\brief The number of bytes of the fixed-size fields following `block_size`.
+    static constexpr size_t core_size = 32;
+
+    //!\brief Reads a little-endian number at the given byte position.
+    template <typename number_type>
+    number_type read(size_t const position) const
+    {
+        number_type value{};
+        std::memcpy(&value, data.data() + position, sizeof(number_type));
+        return detail::to_little_endian(value);
+    }
+
+    //!\brief Returns std::nullopt for -1, which marks missing positions and references in BAM.
+    static std::optional<int32_t> to_optional(int32_t const value)
+    {
+        return value > -1 ? std::optional<int32_t>{value} : std::nullopt;
+    }
+
+    //!\brief The length of the read name including '\0'.
+    size_t l_read_name() const
+    {
+        return read<uint8_t>(8);
+    }
+
+    //!\brief The number of cigar operations.
+    size_t n_cigar_op() const
+    {
+        return read<uint16_t>(12);
+    }
+
+    //!\brief The length of the sequence.
+    int32_t l_seq() const
+    {
+        return read<int32_t>(16);
+    }
+
+    //!\brief The byte position of the cigar operations.
+    size_t cigar_begin() const
+    {
+        return core_size + l_read_name();
+    }
+
+    //!\brief The byte position of the sequence.
+    size_t sequence_begin() const
+    {
+        return cigar_begin() + 4 * n_cigar_op();
+    }
+
+    //!\brief The bytes of the record, excluding `block_size`.
+    std::string data{};
+};
+
+} // namespace seqan3
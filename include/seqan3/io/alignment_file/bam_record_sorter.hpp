@@ -0,0 +1,396 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::bam_record_sorter.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/io/detail/safe_filesystem_entry.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/std/filesystem>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief Sorts serialised BAM records by coordinate with an external merge sort.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The records are given as bytes, including `block_size`, and buffered until the memory limit is reached. Then the
+ * buffered records are sorted by (reference id, position) and written to a temporary run file on a background
+ * thread, while the next records are buffered. Runs are sorted by splitting them into one part per thread that are
+ * sorted in parallel and merged afterwards. If SeqAn is built with zlib, the run files are BGZF compressed.
+ *
+ * finish() merges the run files and the buffered records and passes the records to a callback in sorted order.
+ * Records with the same coordinate keep the order in which they were pushed. Unmapped records without a reference
+ * id or position are sorted to the end, as required by the BAM specification.
+ */
+class bam_record_sorter
+{
+public:
+    //!\brief The type of the function that is called with every record in sorted order.
+    using write_function_type = std::function<void(std::string_view)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record_sorter() = delete;                                      //!< Deleted.
+    bam_record_sorter(bam_record_sorter const &) = delete;             //!< Deleted.
+    bam_record_sorter(bam_record_sorter &&) = delete;                  //!< Deleted.
+    bam_record_sorter & operator=(bam_record_sorter const &) = delete; //!< Deleted.
+    bam_record_sorter & operator=(bam_record_sorter &&) = delete;      //!< Deleted.
+
+    //!\brief Waits for the run that is currently written; removes all run files.
+    ~bam_record_sorter()
+    {
+        if (pending_run.valid())
+            pending_run.wait();
+    }
+
+    /*!\brief Constructs the sorter.
+     * \param[in] memory_limit The number of bytes that may be buffered, including the run that is written.
+     * \param[in] thread_count The number of threads used to sort a run.
+     * \param[in] tmp_directory The directory to create the run files in; the system's temporary directory if empty.
+     */
+    bam_record_sorter(size_t const memory_limit,
+                      size_t const thread_count,
+                      std::filesystem::path const & tmp_directory) :
+        run_size_limit{std::max<size_t>(memory_limit / 2, 1)},
+        thread_count{std::max<size_t>(thread_count, 1)},
+        tmp_directory{tmp_directory.empty() ? std::filesystem::temp_directory_path() : tmp_directory}
+    {}
+    //!\}
+
+    /*!\brief Buffers a record; starts writing a run if the memory limit is reached.
+     * \param[in] record The bytes of the record, including `block_size`.
+     * \throws Any exception thrown while writing the previous run.
+     */
+    void push(std::string_view const record)
+    {
+        entries.push_back(entry{sort_key(record), buffer.size()});
+        buffer.append(record);
+
+        if (buffer.size() >= run_size_limit)
+            write_run_async();
+    }
+
+    /*!\brief Passes all records to the given function in sorted order and resets the sorter.
+     * \param[in] write The function called with every record.
+     * \throws seqan3::format_error If a run file cannot be read.
+     */
+    void finish(write_function_type const & write)
+    {
+        wait_for_pending_run();
+        sort_entries(entries, thread_count);
+
+        // Every run is read by a cursor; the buffered records form the last run.
+        std::vector<run_cursor> cursors{};
+        cursors.reserve(run_files.size() + 1);
+
+        for (std::filesystem::path const & run_file : run_files)
+            cursors.emplace_back(run_file);
+
+        cursors.emplace_back(buffer, entries);
+
+        // Ties are broken by the index of the run, such that records keep the order in which they were pushed.
+        using queue_entry = std::pair<uint64_t, size_t>;
+        std::priority_queue<queue_entry, std::vector<queue_entry>, std::greater<queue_entry>> queue{};
+
+        for (size_t i = 0; i < cursors.size(); ++i)
+            if (cursors[i].next())
+                queue.emplace(sort_key(cursors[i].record), i);
+
+        while (!queue.empty())
+        {
+            size_t const i = queue.top().second;
+            queue.pop();
+            write(cursors[i].record);
+
+            if (cursors[i].next())
+                queue.emplace(sort_key(cursors[i].record), i);
+        }
+
+        cursors.clear();
+        buffer.clear();
+        entries.clear();
+        run_files.clear();
+        run_directory.reset();
+    }
+
+    /*!\brief Returns the key by which a record is sorted.
+     * \param[in] record The bytes of the record, including `block_size`.
+     *
+     * \details
+     *
+     * The reference id is stored in the upper and the position plus one in the lower 32 bit, such that records of a
+     * reference without a position (-1) come first within their reference, like samtools sorts them. Records without a
+     * reference id are sorted to the end.
+     */
+    static uint64_t sort_key(std::string_view const record) noexcept
+    {
+        int32_t ref_id{};
+        int32_t position{};
+        std::memcpy(&ref_id, record.data() + 4, sizeof(ref_id));
+        std::memcpy(&position, record.data() + 8, sizeof(position));
+
+        ref_id = to_little_endian(ref_id);
+        position = to_little_endian(position);
+
+        if (ref_id < 0)
+            return std::numeric_limits<uint64_t>::max();
+
+        return (static_cast<uint64_t>(ref_id) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(position) + 1u);
+    }
+
+private:
+    //!\brief The sort key and the position of a buffered record.
+    struct entry
+    {
+        //!\brief The key the record is sorted by, see sort_key().
+        uint64_t key;
+        //!\brief The position of the record in the buffer.
+        size_t position;
+
+        //!\brief Entries are ordered by their key.
+        bool operator<(entry const & other) const noexcept
+        {
+            return key < other.key;
+        }
+    };
+
+    //!\brief Reads the records of a run one after another, either from a run file or from the buffer.
+    struct run_cursor
+    {
+        //!\brief Opens a run file.
+        explicit run_cursor(std::filesystem::path const & run_file) :
+            file_stream{std::make_unique<std::ifstream>(run_file, std::ios::binary)}
+        {
+            if (!file_stream->good())
+                throw format_error{"Could not open the temporary file " + run_file.string() + " for sorting."};
+
+        #ifdef SEQAN3_HAS_ZLIB
+            // All runs are read at the same time, so every run is decompressed by a single thread.
+            decompression_buffer = std::make_unique<contrib::basic_bgzf_istreambuf<char>>(*file_stream, 1);
+            decompressed_stream = std::make_unique<std::istream>(decompression_buffer.get());
+            stream = decompressed_stream.get();
+        #else
+            stream = file_stream.get();
+        #endif
+        }
+
+        //!\brief Reads the sorted buffered records.
+        run_cursor(std::string const & buffer, std::vector<entry> const & entries) :
+            buffer{&buffer}, entries{&entries}
+        {}
+
+        //!\brief Moves to the next record; returns `false` at the end of the run.
+        bool next()
+        {
+            if (stream == nullptr)
+            {
+                if (entry_index == entries->size())
+                    return false;
+
+                std::string_view const rest = std::string_view{*buffer}.substr((*entries)[entry_index++].position);
+                record = rest.substr(0, 4 + block_size(rest));
+                return true;
+            }
+
+            record_storage.resize(4);
+            if (!stream->read(record_storage.data(), 4))
+                return false;
+
+            size_t const size = block_size(record_storage);
+            record_storage.resize(4 + size);
+            if (!stream->read(record_storage.data() + 4, size))
+                throw format_error{"Unexpected end of a temporary file for sorting."};
+
+            record = record_storage;
+            return true;
+        }
+
+        //!\brief The current record, including `block_size`.
+        std::string_view record{};
+
+        //!\brief The stream of the file, if the run is stored in a file.
+        std::unique_ptr<std::ifstream> file_stream{};
+    #ifdef SEQAN3_HAS_ZLIB
+        //!\brief The decompressing stream buffer on top of the file stream.
+        std::unique_ptr<contrib::basic_bgzf_istreambuf<char>> decompression_buffer{};
+        //!\brief The stream reading from the decompressing stream buffer.
+        std::unique_ptr<std::istream> decompressed_stream{};
+    #endif
+        //!\brief The stream the records are read from or nullptr if the buffered records are read.
+        std::istream * stream{nullptr};
+        //!\brief The storage of the current record if it is read from a file.
+        std::string record_storage{};
+
+        //!\brief The buffered records.
+        std::string const * buffer{nullptr};
+        //!\brief The sorted entries of the buffered records.
+        std::vector<entry> const * entries{nullptr};
+        //!\brief The index of the next entry.
+        size_t entry_index{0};
+    };
+
+    //!\brief Returns the `block_size` of the record starting at the beginning of the bytes.
+    static size_t block_size(std::string_view const bytes) noexcept
+    {
+        int32_t size{};
+        std::memcpy(&size, bytes.data(), sizeof(size));
+        return static_cast<size_t>(to_little_endian(size));
+    }
+
+    /*!\brief Sorts the entries stably by key using the given number of threads.
+     * \param[in, out] entries The entries to sort.
+     * \param[in] thread_count The number of threads.
+     *
+     * \details
+     *
+     * The entries are split into one part per thread. The parts are sorted in parallel and merged pairwise.
+     */
+    static void sort_entries(std::vector<entry> & entries, size_t const thread_count)
+    {
+        size_t const part_count = std::min(thread_count, std::max<size_t>(entries.size() / 1024, 1));
+        size_t const part_size = (entries.size() + part_count - 1) / std::max<size_t>(part_count, 1);
+
+        auto part_begin = [&] (size_t const part)
+        {
+            return entries.begin() + std::min(part * part_size, entries.size());
+        };
+
+        std::vector<std::thread> threads{};
+        for (size_t part = 1; part < part_count; ++part)
+            threads.emplace_back([&, part] () { std::stable_sort(part_begin(part), part_begin(part + 1)); });
+
+        std::stable_sort(part_begin(0), part_begin(1));
+
+        for (auto & thread : threads)
+            thread.join();
+
+        for (size_t width = 1; width < part_count; width *= 2)
+            for (size_t part = 0; part + width < part_count; part += 2 * width)
+                std::inplace_merge(part_begin(part), part_begin(part + width), part_begin(part + 2 * width));
+    }
+
+    //!\brief Waits for the run that is currently written and rethrows its exceptions.
+    void wait_for_pending_run()
+    {
+        if (pending_run.valid())
+            pending_run.get();
+    }
+
+    //!\brief Sorts and writes the buffered records to a new run file on a background thread.
+    void write_run_async()
+    {
+        wait_for_pending_run();
+
+        if (!run_directory)
+        {
+            run_directory_path = create_run_directory();
+            run_directory = std::make_unique<safe_filesystem_entry>(run_directory_path);
+        }
+
+        std::filesystem::path run_file = run_directory_path / ("run_" + std::to_string(run_files.size()) + ".bam");
+        run_files.push_back(run_file);
+
+        pending_run = std::async(std::launch::async,
+                                 [run_buffer = std::move(buffer),
+                                  run_entries = std::move(entries),
+                                  run_file = std::move(run_file),
+                                  thread_count = thread_count] () mutable
+        {
+            sort_entries(run_entries, thread_count);
+
+            std::ofstream file_stream{run_file, std::ios::binary};
+            if (!file_stream.good())
+                throw format_error{"Could not open the temporary file " + run_file.string() + " for sorting."};
+
+            {
+            #ifdef SEQAN3_HAS_ZLIB
+                contrib::bgzf_ostream stream{file_stream};
+            #else
+                std::ostream & stream = file_stream;
+            #endif
+                std::string_view const records{run_buffer};
+                for (entry const & e : run_entries)
+                {
+                    std::string_view const rest = records.substr(e.position);
+                    stream.write(rest.data(), 4 + block_size(rest));
+                }
+            }
+
+            if (!file_stream.good())
+                throw format_error{"Could not write the temporary file " + run_file.string() + " for sorting."};
+        });
+
+        buffer = std::string{};
+        entries = std::vector<entry>{};
+    }
+
+    //!\brief Creates a new, uniquely named directory for the run files.
+    std::filesystem::path create_run_directory() const
+    {
+        std::random_device random{};
+
+        while (true)
+        {
+            std::filesystem::path directory = tmp_directory / ("seqan3_bam_sort_" + std::to_string(random()));
+
+            if (std::filesystem::create_directory(directory))
+                return directory;
+        }
+    }
+
+    //!\brief The number of buffered bytes after which a run is written.
+    size_t run_size_limit;
+    //!\brief The number of threads used to sort a run.
+    size_t thread_count;
+    //!\brief The directory in which the directory of the run files is created.
+    std::filesystem::path tmp_directory;
+
+    //!\brief The buffered records.
+    std::string buffer{};
+    //!\brief The sort keys and positions of the buffered records.
+    std::vector<entry> entries{};
+
+    //!\brief The directory of the run files.
+    std::filesystem::path run_directory_path{};
+    //!\brief Removes the directory of the run files with all run files.
+    std::unique_ptr<safe_filesystem_entry> run_directory{};
+    //!\brief The run files in the order they were written.
+    std::vector<std::filesystem::path> run_files{};
+    //!\brief The run that is currently sorted and written.
+    std::future<void> pending_run{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,344 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::lazy_alignment_from_cigar and seqan3::cigar_row_view.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3
+{
+
+/*!\brief A view over one row of the alignment described by a cigar string; gaps are inserted during iteration.
+ * \ingroup alignment_file
+ * \tparam urng_t           The type of the underlying sequence; must model std::ranges::view and
+ *                          std::ranges::forward_range.
+ * \tparam is_reference_row Whether the view represents the reference (`true`) or the query (`false`) row.
+ *
+ * \details
+ *
+ * The view stores a reference to the cigar operations and the underlying sequence. Dereferencing an iterator returns
+ * either the current character of the underlying sequence or seqan3::gap, depending on the current cigar operation;
+ * nothing is copied or allocated. The size of the view is computed from the cigar operations on construction.
+ *
+ * The reference row consumes the underlying sequence for the operations M, =, X, D and N and contains gaps for the
+ * operations I and P. The query row consumes the underlying sequence for the operations M, =, X and I and contains
+ * gaps for the operations D, N and P. Soft clipped bases (S) are skipped in the query, hard clips (H) are ignored.
+ * Thus, the reference row expects the reference sequence beginning at the first aligned position and the query row
+ * expects the complete sequence of the record, including soft clipped bases.
+ *
+ * Use seqan3::lazy_alignment_from_cigar to create both rows.
+ */
+template <std::ranges::view urng_t, bool is_reference_row>
+//!\cond
+    requires std::ranges::forward_range<urng_t>
+//!\endcond
+class cigar_row_view : public std::ranges::view_interface<cigar_row_view<urng_t, is_reference_row>>
+{
+private:
+    //!\brief Whether the operation represents a column of the alignment.
+    static constexpr bool is_column(char const operation) noexcept
+    {
+        return operation != 'S' && operation != 'H';
+    }
+
+    //!\brief Whether the operation consumes a character of the underlying sequence.
+    static constexpr bool consumes_sequence(char const operation) noexcept
+    {
+        switch (operation)
+        {
+            case 'M': case '=': case 'X':
+                return true;
+            case 'D': case 'N':
+                return is_reference_row;
+            case 'I': case 'S':
+                return !is_reference_row;
+            default: // H, P
+                return false;
+        }
+    }
+
+    /*!\brief The iterator of seqan3::cigar_row_view.
+     * \tparam range_type The type of the underlying sequence, possibly const-qualified.
+     *
+     * \details
+     *
+     * Like the iterator of seqan3::views::pairwise_combine, this iterator returns a prvalue when dereferenced and
+     * thus does not model [Cpp17Iterator](https://en.cppreference.com/w/cpp/named_req/Iterator).
+     */
+    template <typename range_type>
+    class iterator_type
+    {
+    private:
+        //!\brief The iterator of the underlying sequence.
+        using underlying_iterator_type = std::ranges::iterator_t<range_type>;
+
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        //!\brief The difference type.
+        using difference_type   = std::ptrdiff_t;
+        //!\brief The value type.
+        using value_type        = gapped<value_type_t<range_type>>;
+        //!\brief The reference type.
+        using reference         = value_type;
+        //!\brief The pointer type.
+        using pointer           = void;
+        //!\brief The iterator category tag.
+        using iterator_category = std::forward_iterator_tag;
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        iterator_type() = default;                                  //!< Defaulted.
+        iterator_type(iterator_type const &) = default;             //!< Defaulted.
+        iterator_type(iterator_type &&) = default;                  //!< Defaulted.
+        iterator_type & operator=(iterator_type const &) = default; //!< Defaulted.
+        iterator_type & operator=(iterator_type &&) = default;      //!< Defaulted.
+        ~iterator_type() = default;                                 //!< Defaulted.
+
+        /*!\brief Constructs the iterator at the first column of the given operations.
+         * \param[in] operation     The first cigar operation.
+         * \param[in] operation_end The end of the cigar operations.
+         * \param[in] sequence_it   The beginning of the underlying sequence.
+         */
+        iterator_type(cigar const * operation,
+                      cigar const * operation_end,
+                      underlying_iterator_type sequence_it) :
+            operation{operation}, operation_end{operation_end}, sequence_it{std::move(sequence_it)}
+        {
+            enter_operation();
+        }
+        //!\}
+
+        /*!\name Access
+         * \{
+         */
+        //!\brief Returns the character of the underlying sequence or seqan3::gap.
+        reference operator*() const
+        {
+            return consumes ? value_type{*sequence_it} : value_type{gap{}};
+        }
+        //!\}
+
+        /*!\name Arithmetic operators
+         * \{
+         */
+        //!\brief Moves to the next column.
+        iterator_type & operator++()
+        {
+            if (consumes)
+                ++sequence_it;
+
+            if (--remaining == 0)
+            {
+                ++operation;
+                enter_operation();
+            }
+
+            return *this;
+        }
+
+        //!\brief Moves to the next column and returns the previous position.
+        iterator_type operator++(int)
+        {
+            iterator_type tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+        //!\}
+
+        /*!\name Comparison operators
+         * \{
+         */
+        //!\brief Checks whether both iterators point to the same column.
+        friend bool operator==(iterator_type const & lhs, iterator_type const & rhs) noexcept
+        {
+            return lhs.operation == rhs.operation && lhs.remaining == rhs.remaining;
+        }
+
+        //!\brief Checks whether both iterators point to different columns.
+        friend bool operator!=(iterator_type const & lhs, iterator_type const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        //!\}
+
+    private:
+        //!\brief Moves to the next operation that represents columns, skipping soft clipped bases.
+        void enter_operation()
+        {
+            for (; operation != operation_end; ++operation)
+            {
+                auto [count, cigar_operation] = *operation;
+                char const operation_char = cigar_operation.to_char();
+
+                if (is_column(operation_char) && count > 0)
+                {
+                    remaining = count;
+                    consumes = consumes_sequence(operation_char);
+                    return;
+                }
+
+                if (consumes_sequence(operation_char))
+                    std::ranges::advance(sequence_it, count);
+            }
+
+            remaining = 0;
+        }
+
+        //!\brief The current cigar operation.
+        cigar const * operation{nullptr};
+        //!\brief The end of the cigar operations.
+        cigar const * operation_end{nullptr};
+        //!\brief The number of columns left in the current operation.
+        uint32_t remaining{0};
+        //!\brief Whether the current operation consumes the underlying sequence.
+        bool consumes{false};
+        //!\brief The current position in the underlying sequence.
+        underlying_iterator_type sequence_it{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    cigar_row_view() = default;                                   //!< Defaulted.
+    cigar_row_view(cigar_row_view const &) = default;             //!< Defaulted.
+    cigar_row_view(cigar_row_view &&) = default;                  //!< Defaulted.
+    cigar_row_view & operator=(cigar_row_view const &) = default; //!< Defaulted.
+    cigar_row_view & operator=(cigar_row_view &&) = default;      //!< Defaulted.
+    ~cigar_row_view() = default;                                  //!< Defaulted.
+
+    /*!\brief Constructs the view from the cigar operations and the underlying sequence.
+     * \param[in] operations The cigar operations; must outlive the view.
+     * \param[in] urange     The underlying sequence.
+     */
+    cigar_row_view(std::span<cigar const> const operations, urng_t urange) :
+        operations{operations}, urange{std::move(urange)}
+    {
+        for (auto [count, cigar_operation] : operations)
+            if (is_column(cigar_operation.to_char()))
+                length += count;
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first column.
+    auto begin()
+    {
+        return iterator_type<urng_t>{operations.data(),
+                                     operations.data() + operations.size(),
+                                     std::ranges::begin(urange)};
+    }
+
+    //!\copydoc begin()
+    auto begin() const
+    //!\cond
+        requires std::ranges::forward_range<urng_t const>
+    //!\endcond
+    {
+        return iterator_type<urng_t const>{operations.data(),
+                                           operations.data() + operations.size(),
+                                           std::ranges::begin(urange)};
+    }
+
+    //!\brief Returns an iterator behind the last column.
+    auto end()
+    {
+        return iterator_type<urng_t>{operations.data() + operations.size(),
+                                     operations.data() + operations.size(),
+                                     std::ranges::begin(urange)};
+    }
+
+    //!\copydoc end()
+    auto end() const
+    //!\cond
+        requires std::ranges::forward_range<urng_t const>
+    //!\endcond
+    {
+        return iterator_type<urng_t const>{operations.data() + operations.size(),
+                                           operations.data() + operations.size(),
+                                           std::ranges::begin(urange)};
+    }
+    //!\}
+
+    //!\brief Returns the number of columns of the alignment; computed on construction.
+    size_t size() const noexcept
+    {
+        return length;
+    }
+
+private:
+    //!\brief The cigar operations.
+    std::span<cigar const> operations{};
+    //!\brief The underlying sequence.
+    urng_t urange{};
+    //!\brief The number of columns of the alignment.
+    size_t length{0};
+};
+
+/*!\brief Returns both rows of the alignment described by a cigar string as views that insert the gaps lazily.
+ * \ingroup alignment_file
+ * \tparam reference_t The type of the reference sequence; must model std::ranges::viewable_range and
+ *                     std::ranges::forward_range.
+ * \tparam query_t     The type of the query sequence; must model std::ranges::viewable_range and
+ *                     std::ranges::forward_range.
+ * \param[in] operations The cigar operations; must outlive the returned views.
+ * \param[in] reference  The reference sequence, beginning at the first aligned position.
+ * \param[in] query      The sequence of the record, including soft clipped bases.
+ * \returns A std::tuple of the reference and query row, see seqan3::cigar_row_view.
+ *
+ * \details
+ *
+ * When seqan3::field::alignment is read, the gaps are inserted into seqan3::gap_decorator objects for every record,
+ * which is costly if the alignment is only inspected for a few records or only partially. Reading
+ * seqan3::field::cigar, seqan3::field::seq and seqan3::field::ref_offset instead and creating the alignment with this
+ * function is the cheap alternative: the gaps are only determined while iterating over the rows, and the size of the
+ * rows (the length of the alignment) is known without iterating.
+ *
+ * ```cpp
+ * for (auto & [seq, ref_id, ref_offset, cigar_vector] : fin)
+ * {
+ *     auto [reference_row, query_row] = seqan3::lazy_alignment_from_cigar(cigar_vector,
+ *                                                                          ref_seqs[*ref_id] | std::views::drop(*ref_offset),
+ *                                                                          seq);
+ * }
+ * ```
+ */
+template <std::ranges::viewable_range reference_t, std::ranges::viewable_range query_t>
+//!\cond
+    requires std::ranges::forward_range<reference_t> && std::ranges::forward_range<query_t>
+//!\endcond
+auto lazy_alignment_from_cigar(std::span<cigar const> const operations, reference_t && reference, query_t && query)
+{
+    using reference_row_t = cigar_row_view<std::ranges::all_view<reference_t>, true>;
+    using query_row_t = cigar_row_view<std::ranges::all_view<query_t>, false>;
+
+    return std::tuple<reference_row_t, query_row_t>{
+        reference_row_t{operations, std::views::all(std::forward<reference_t>(reference))},
+        query_row_t{operations, std::views::all(std::forward<query_t>(query))}};
+}
+
+} // namespace seqan3
@@ -12,12 +12,15 @@
 
 #pragma once
 
+#include <cstring>
 #include <iterator>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
-#include <seqan3/alphabet/detail/convert.hpp>
-#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
 #include <seqan3/core/bit_manipulation.hpp>
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/concept/core_language.hpp>
@@ -25,6 +28,10 @@
 #include <seqan3/core/detail/to_string.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/core/type_traits/template_inspection.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/bam_packed_sequence.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/bam_record_sorter.hpp>
 #include <seqan3/io/alignment_file/detail.hpp>
 #include <seqan3/io/alignment_file/format_sam_base.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
@@ -37,6 +44,7 @@
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/range/detail/misc.hpp>
+#include <seqan3/range/views/single_pass_input.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/range/views/take_exactly.hpp>
 #include <seqan3/range/views/take_until.hpp>
@@ -146,12 +154,48 @@ protected:
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(e_value),
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(bit_score));
 
+    template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+    bool read_raw_record(stream_type & stream,
+                         ref_seqs_type & ref_seqs,
+                         alignment_file_header<ref_ids_type> & header,
+                         bam_record & record);
+
+    template <typename stream_type>
+    void write_sorted_records(stream_type & stream);
+
+    //!\brief Builds the index of the written records if seqan3::alignment_file_output_options::bam_create_index is set.
+    std::optional<detail::bam_index_builder> index_builder{};
+    //!\brief The offset of the next record in the uncompressed BAM data.
+    uint64_t index_record_offset{};
+    /*!\brief Buffers and sorts the records if seqan3::alignment_file_output_options::bam_sort_by_coordinate is set.
+     *
+     * \details
+     *
+     * Shared between copies of the format, because the sorter cannot be copied; copies of the format that write
+     * records in parallel are never made while sorting.
+     */
+    std::shared_ptr<detail::bam_record_sorter> sorter{};
+
 private:
     //!\brief A variable that tracks whether the content of header has been read or not.
     bool header_was_read{false};
 
     //!\brief Local buffer to read into while avoiding reallocation.
     std::string string_buffer{};
+    //!\brief The buffer the current record is assembled in before it is written.
+    std::string record_buffer{};
+
+    /*!\brief Reads the next `count` bytes of the stream into the string_buffer.
+     * \throws seqan3::format_error if the stream ends before.
+     */
+    template <typename stream_type>
+    void read_bytes(stream_type & stream, size_t const count)
+    {
+        string_buffer.resize(count);
+
+        if (!stream.read(string_buffer.data(), count))
+            throw format_error{"The BAM record is truncated."};
+    }
 
     //!\brief Stores all fixed length variables which can be read/written directly by reinterpreting the binary stream.
     struct alignment_record_core
@@ -248,13 +292,10 @@ private:
         target = tmp;
     }
 
-    template <typename stream_view_type, typename value_type>
-    void read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant,
-                              stream_view_type && stream_view,
-                              value_type const & SEQAN3_DOXYGEN_ONLY(value));
-
-    template <typename stream_view_type>
-    void read_field(stream_view_type && stream_view, sam_tag_dictionary & target);
+    template <typename stream_view_type, typename ref_seqs_type, typename ref_ids_type>
+    void read_bam_header(stream_view_type & stream_view,
+                         alignment_file_header<ref_ids_type> & header,
+                         ref_seqs_type & ref_seqs);
 
     template <typename cigar_input_type>
     auto parse_binary_cigar(cigar_input_type && cigar_input, uint16_t n_cigar_op) const;
@@ -262,6 +303,115 @@ private:
     static std::string get_tag_dict_str(sam_tag_dictionary const & tag_dict);
 };
 
+/*!\brief Reads the BAM header, i.e. the header text and the reference information.
+ * \tparam stream_view_type The type of the stream as a view.
+ * \param[in, out] stream_view The stream view to read from.
+ * \param[in, out] header      The header to store the information in; compared to the references if given.
+ * \param[in]      ref_seqs    The reference sequences or std::ignore.
+ * \throws seqan3::format_error If the header is malformed or does not match the reference information.
+ */
+template <typename stream_view_type, typename ref_seqs_type, typename ref_ids_type>
+inline void format_bam::read_bam_header(stream_view_type & stream_view,
+                                        alignment_file_header<ref_ids_type> & header,
+                                        ref_seqs_type & ref_seqs)
+{
+    // magic BAM string
+    if (!std::ranges::equal(stream_view | views::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
+        throw format_error{"File is not in BAM format."};
+
+    int32_t tmp32{};
+    read_field(stream_view, tmp32);
+
+    if (tmp32 > 0) // header text is present
+    {
+        // The text is copied, such that the @SQ lines can be counted to reserve the reference information before it
+        // is parsed. The appended NUL character ends the parser at the end of the text.
+        string_buffer.resize(tmp32 + 1);
+        std::ranges::copy(stream_view | views::take_exactly_or_throw(tmp32), string_buffer.begin());
+        string_buffer[tmp32] = '\0';
+
+        if constexpr (detail::decays_to_ignore_v<ref_seqs_type>) // otherwise the references were given
+        {
+            std::string_view const text{string_buffer.data(), static_cast<size_t>(tmp32)};
+            size_t sq_line_count = text.substr(0, 3) == "@SQ" ? 1 : 0;
+
+            for (size_t pos = text.find("\n@SQ"); pos != std::string_view::npos; pos = text.find("\n@SQ", pos + 1))
+                ++sq_line_count;
+
+            header.ref_id_info.reserve(header.ref_id_info.size() + sq_line_count);
+            header.ref_dict.reserve(header.ref_dict.size() + sq_line_count);
+        }
+
+        read_header(string_buffer | views::single_pass_input | views::take_exactly_or_throw(tmp32), header, ref_seqs);
+    }
+
+    int32_t n_ref;
+    read_field(stream_view, n_ref);
+
+    // Without reference information and without @SQ lines, the references are only listed in the binary block.
+    bool fill_from_binary_block{false};
+
+    if constexpr (detail::decays_to_ignore_v<ref_seqs_type>)
+    {
+        if (!ref_info_present_in_header && n_ref > 0)
+        {
+            fill_from_binary_block = true;
+            header.ref_id_info.reserve(header.ref_id_info.size() + n_ref);
+            header.ref_dict.reserve(header.ref_dict.size() + n_ref);
+        }
+    }
+
+    for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+    {
+        read_field(stream_view, tmp32); // l_name (length of reference name including \0 character)
+
+        string_buffer.resize(tmp32 - 1);
+        std::ranges::copy_n(std::ranges::begin(stream_view), tmp32 - 1, string_buffer.data()); // copy without \0 character
+        std::ranges::next(std::ranges::begin(stream_view)); // skip \0 character
+
+        read_field(stream_view, tmp32); // l_ref (length of reference sequence)
+
+        if constexpr (detail::decays_to_ignore_v<ref_seqs_type>)
+        {
+            if (fill_from_binary_block)
+            {
+                if (header.ref_dict.count(string_buffer) != 0) // [unlikely]
+                    throw format_error{"Duplicate reference name '" + string_buffer + "' found in BAM file header."};
+
+                value_type_t<decltype(header.ref_ids())> id{};
+                std::ranges::copy(string_buffer | views::char_to<value_type_t<decltype(id)>>,
+                                  std::ranges::back_inserter(id));
+                header.ref_ids().push_back(std::move(id));
+                header.ref_id_info.emplace_back(tmp32, "");
+                header.ref_dict[(header.ref_ids())[(header.ref_ids()).size() - 1]] = (header.ref_ids()).size() - 1;
+                continue;
+            }
+        }
+
+        auto id_it = header.ref_dict.find(string_buffer);
+
+        // sanity checks of reference information to existing header object:
+        if (id_it == header.ref_dict.end()) // [unlikely]
+        {
+            throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
+                                                 "' found in BAM file header (header.ref_ids():",
+                                                 header.ref_ids(), ").")};
+        }
+        else if (id_it->second != ref_idx) // [unlikely]
+        {
+            throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
+                                                 " does not correspond to the position ", id_it->second,
+                                                 " in the header (header.ref_ids():", header.ref_ids(), ").")};
+        }
+        else if (std::get<0>(header.ref_id_info[id_it->second]) != tmp32) // [unlikely]
+        {
+            throw format_error{"Provided reference has unequal length as specified in the header."};
+        }
+    }
+
+    header_was_read = true;
+}
+
 //!\copydoc alignment_file_input_format::read_alignment_record
 template <typename stream_type,     // constraints checked by file
           typename seq_legal_alph_type,
@@ -326,51 +476,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if (!header_was_read)
     {
-        // magic BAM string
-        if (!std::ranges::equal(stream_view | views::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
-            throw format_error{"File is not in BAM format."};
-
-        int32_t tmp32{};
-        read_field(stream_view, tmp32);
-
-        if (tmp32 > 0) // header text is present
-            read_header(stream_view | views::take_exactly_or_throw(tmp32), header, ref_seqs);
-
-        int32_t n_ref;
-        read_field(stream_view, n_ref);
-
-        for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
-        {
-            read_field(stream_view, tmp32); // l_name (length of reference name including \0 character)
-
-            string_buffer.resize(tmp32 - 1);
-            std::ranges::copy_n(std::ranges::begin(stream_view), tmp32 - 1, string_buffer.data()); // copy without \0 character
-            std::ranges::next(std::ranges::begin(stream_view)); // skip \0 character
-
-            read_field(stream_view, tmp32); // l_ref (length of reference sequence)
-
-            auto id_it = header.ref_dict.find(string_buffer);
-
-            // sanity checks of reference information to existing header object:
-            if (id_it == header.ref_dict.end()) // [unlikely]
-            {
-                throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
-                                                     "' found in BAM file header (header.ref_ids():",
-                                                     header.ref_ids(), ").")};
-            }
-            else if (id_it->second != ref_idx) // [unlikely]
-            {
-                throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
-                                                     " does not correspond to the position ", id_it->second,
-                                                     " in the header (header.ref_ids():", header.ref_ids(), ").")};
-            }
-            else if (std::get<0>(header.ref_id_info[id_it->second]) != tmp32) // [unlikely]
-            {
-                throw format_error{"Provided reference has unequal length as specified in the header."};
-            }
-        }
-
-        header_was_read = true;
+        read_bam_header(stream_view, header, ref_seqs);
 
         if (stream_buf_t{stream} == stream_buf_t{}) // no records follow
             return;
@@ -432,13 +538,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if (core.l_seq > 0) // sequence information is given
     {
-        auto seq_stream = stream_view
-                        | views::take_exactly_or_throw(core.l_seq / 2) // one too short if uneven
-                        | std::views::transform([] (char c) -> std::pair<sam_dna16, sam_dna16>
-                          {
-                              return {sam_dna16{}.assign_rank(std::min(15, static_cast<uint8_t>(c) >> 4)),
-                                      sam_dna16{}.assign_rank(std::min(15, static_cast<uint8_t>(c) & 0x0f))};
-                          });
+        read_bytes(stream, (core.l_seq + 1) / 2); // two bases per byte, the last low nibble is unused if uneven
 
         if constexpr (detail::decays_to_ignore_v<seq_type>)
         {
@@ -452,65 +552,30 @@ inline void format_bam::read_alignment_record(stream_type & stream,
                 {
                     assert(core.l_seq == (seq_length + offset_tmp + soft_clipping_end)); // sanity check
                     using alph_t = value_type_t<decltype(get<1>(align))>;
-                    constexpr auto from_dna16 = detail::convert_through_char_representation<alph_t, sam_dna16>;
-
-                    get<1>(align).reserve(seq_length);
-
-                    auto tmp_iter = std::ranges::begin(seq_stream);
-                    std::ranges::advance(tmp_iter, offset_tmp / 2); // skip soft clipped bases at the beginning
-
-                    if (offset_tmp & 1)
-                    {
-                        get<1>(align).push_back(from_dna16[to_rank(get<1>(*tmp_iter))]);
-                        ++tmp_iter;
-                        --seq_length;
-                    }
-
-                    for (size_t i = (seq_length / 2); i > 0; --i)
-                    {
-                        get<1>(align).push_back(from_dna16[to_rank(get<0>(*tmp_iter))]);
-                        get<1>(align).push_back(from_dna16[to_rank(get<1>(*tmp_iter))]);
-                        ++tmp_iter;
-                    }
 
-                    if (seq_length & 1)
+                    // skip soft clipped bases at the beginning and the end
+                    detail::append_decoded(get<1>(align), seq_length, [&] (auto it)
                     {
-                        get<1>(align).push_back(from_dna16[to_rank(get<0>(*tmp_iter))]);
-                        ++tmp_iter;
-                        --soft_clipping_end;
-                    }
-
-                    std::ranges::advance(tmp_iter, (soft_clipping_end + !(seq_length & 1)) / 2);
+                        detail::decode_bam_bases<alph_t>(string_buffer.data(),
+                                                         offset_tmp,
+                                                         offset_tmp + seq_length,
+                                                         it);
+                    });
                 }
                 else
                 {
                     get<1>(align) = std::remove_reference_t<decltype(get<1>(align))>{}; // assign empty container
                 }
             }
-            else
-            {
-                detail::consume(seq_stream);
-                if (core.l_seq & 1)
-                    std::ranges::next(std::ranges::begin(stream_view));
-            }
         }
         else
         {
             using alph_t = value_type_t<decltype(seq)>;
-            constexpr auto from_dna16 = detail::convert_through_char_representation<alph_t, sam_dna16>;
 
-            for (auto [d1, d2] : seq_stream)
+            detail::append_decoded(seq, core.l_seq, [&] (auto it)
             {
-                seq.push_back(from_dna16[to_rank(d1)]);
-                seq.push_back(from_dna16[to_rank(d2)]);
-            }
-
-            if (core.l_seq & 1)
-            {
-                sam_dna16 d = sam_dna16{}.assign_rank(std::min(15, static_cast<uint8_t>(*std::ranges::begin(stream_view)) >> 4));
-                seq.push_back(from_dna16[to_rank(d)]);
-                std::ranges::next(std::ranges::begin(stream_view));
-            }
+                detail::decode_bam_bases<alph_t>(string_buffer.data(), 0, core.l_seq, it);
+            });
 
             if constexpr (!detail::decays_to_ignore_v<align_type>)
             {
@@ -523,8 +588,18 @@ inline void format_bam::read_alignment_record(stream_type & stream,
 
     // read qual string
     // -------------------------------------------------------------------------------------------------------------
-    read_field(stream_view | views::take_exactly_or_throw(core.l_seq)
-                           | std::views::transform([] (char chr) { return static_cast<char>(chr + 33); }), qual);
+    read_bytes(stream, core.l_seq);
+
+    if constexpr (!detail::decays_to_ignore_v<qual_type>)
+    {
+        if (core.l_seq > 0 && static_cast<uint8_t>(string_buffer[0]) != 0xff) // 0xff marks missing qualities
+        {
+            detail::append_decoded(qual, core.l_seq, [&] (auto it)
+            {
+                detail::decode_bam_qualities<value_type_t<qual_type>>(string_buffer.data(), core.l_seq, it);
+            });
+        }
+    }
 
     // All remaining optional fields if any: SAM tags dictionary
     // -------------------------------------------------------------------------------------------------------------
@@ -533,8 +608,10 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     assert(remaining_bytes >= 0);
     auto tags_view = stream_view | views::take_exactly_or_throw(remaining_bytes);
 
-    while (tags_view.size() > 0)
-        read_field(tags_view, tag_dict);
+    if constexpr (detail::decays_to_ignore_v<tag_dict_type>)
+        detail::consume(tags_view);
+    else
+        tag_dict.assign_bam_tags(tags_view); // decoded on first access
 
     // DONE READING - wrap up
     // -------------------------------------------------------------------------------------------------------------
@@ -699,7 +776,18 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
         {
             stream << "BAM\1";
             std::ostringstream os;
-            write_header(os, options, header); // write SAM header to temporary stream to query the size.
+
+            if (options.bam_sort_by_coordinate) // the records are written sorted, regardless of the header
+            {
+                std::string sorting = std::exchange(header.sorting, "coordinate");
+                write_header(os, options, header); // write SAM header to temporary stream to query the size.
+                header.sorting = std::move(sorting);
+            }
+            else
+            {
+                write_header(os, options, header); // write SAM header to temporary stream to query the size.
+            }
+
             int32_t l_text{static_cast<int32_t>(os.str().size())};
             std::ranges::copy_n(reinterpret_cast<char *>(&l_text), 4, stream_it); // write read id
 
@@ -722,6 +810,24 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
             header_was_written = true;
         }
 
+        if (options.bam_create_index && !index_builder)
+        {
+            uint64_t maximal_reference_length{};
+            for (auto const & info : header.ref_id_info)
+                maximal_reference_length = std::max<uint64_t>(maximal_reference_length, get<0>(info));
+
+            index_builder.emplace(header.ref_ids().size(), maximal_reference_length);
+            // Records are then tracked by their size, such that the stream is queried only once.
+            index_record_offset = static_cast<uint64_t>(stream.tellp());
+        }
+
+        if (options.bam_sort_by_coordinate && !sorter)
+        {
+            sorter = std::make_shared<detail::bam_record_sorter>(options.bam_sort_memory_limit,
+                                                                 options.threads,
+                                                                 options.bam_sort_tmp_directory);
+        }
+
         // ---------------------------------------------------------------------
         // Writing the Record
         // ---------------------------------------------------------------------
@@ -853,43 +959,33 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
                           core.l_seq +           // quality string
                           tag_dict_binary_str.size();
 
-        std::ranges::copy_n(reinterpret_cast<char *>(&core), sizeof(core), stream_it);  // write core
+        // The record is assembled in a buffer, such that it can be handed to the sorter as a whole.
+        record_buffer.clear();
+        auto record_it = std::back_inserter(record_buffer);
+
+        std::ranges::copy_n(reinterpret_cast<char *>(&core), sizeof(core), record_it);  // write core
 
         if (std::ranges::empty(id)) // empty id is represented as * for backward compatibility
-            stream_it = '*';
+            record_it = '*';
         else
-            std::ranges::copy_n(std::ranges::begin(id), core.l_read_name - 1, stream_it); // write read id
-        stream_it = '\0';
+            std::ranges::copy_n(std::ranges::begin(id), core.l_read_name - 1, record_it); // write read id
+        record_it = '\0';
 
         // write cigar
         for (auto [cigar_count, op] : cigar_vector)
         {
             cigar_count = cigar_count << 4;
             cigar_count |= static_cast<int32_t>(char_to_sam_rank[op.to_char()]);
-            std::ranges::copy_n(reinterpret_cast<char *>(&cigar_count), 4, stream_it);
+            std::ranges::copy_n(reinterpret_cast<char *>(&cigar_count), 4, record_it);
         }
 
         // write seq (bit-compressed: sam_dna16 characters go into one byte)
-        using alph_t = value_type_t<seq_type>;
-        constexpr auto to_dna16 = detail::convert_through_char_representation<sam_dna16, alph_t>;
-
-        auto sit = std::ranges::begin(seq);
-        for (int32_t sidx = 0; sidx < ((core.l_seq & 1) ? core.l_seq - 1 : core.l_seq); ++sidx, ++sit)
-        {
-            uint8_t compressed_chr = to_rank(to_dna16[to_rank(*sit)]) << 4;
-            ++sidx, ++sit;
-            compressed_chr |= to_rank(to_dna16[to_rank(*sit)]);
-            stream_it = static_cast<char>(compressed_chr);
-        }
-
-        if (core.l_seq & 1) // write one more
-            stream_it = static_cast<char>(to_rank(to_dna16[to_rank(*sit)]) << 4);
+        detail::encode_bam_bases(seq, core.l_seq, record_buffer);
 
         // write qual
         if (std::ranges::empty(qual))
         {
-            auto v = views::repeat_n(static_cast<char>(255), core.l_seq);
-            std::ranges::copy_n(v.begin(), core.l_seq, stream_it);
+            record_buffer.append(core.l_seq, static_cast<char>(255));
         }
         else
         {
@@ -898,182 +994,142 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
                                                      core.l_seq, ". Got quality with size ",
                                                      std::ranges::distance(qual), " instead.")};
 
-            auto v = qual | std::views::transform([] (auto chr) { return static_cast<char>(to_rank(chr)); });
-            std::ranges::copy_n(v.begin(), core.l_seq, stream_it);
+            size_t const qual_begin = record_buffer.size();
+            record_buffer.resize(qual_begin + core.l_seq);
+            std::ranges::transform(qual, record_buffer.begin() + qual_begin, [] (auto chr)
+            {
+                return static_cast<char>(to_rank(chr));
+            });
         }
 
         // write optional fields
-        stream << tag_dict_binary_str;
-    } // if constexpr (!detail::decays_to_ignore_v<header_type>)
-}
+        record_buffer += tag_dict_binary_str;
 
-//!\copydoc seqan3::format_sam::read_sam_dict_vector
-template <typename stream_view_type, typename value_type>
-inline void format_bam::read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant,
-                                             stream_view_type && stream_view,
-                                             value_type const & SEQAN3_DOXYGEN_ONLY(value))
-{
-    int32_t count;
-    read_field(stream_view, count); // read length of vector
-    std::vector<value_type> tmp_vector;
-    tmp_vector.reserve(count);
+        if (sorter) // the index is built when the sorted records are written
+        {
+            sorter->push(record_buffer);
+            return;
+        }
 
-    while (count > 0)
-    {
-        value_type tmp{};
-        read_field(stream_view, tmp);
-        tmp_vector.push_back(std::move(tmp));
-        --count;
-    }
-    variant = std::move(tmp_vector);
+        stream.write(record_buffer.data(), record_buffer.size());
+
+        if (index_builder)
+        {
+            uint64_t const record_end = index_record_offset + core.block_size + 4/*block_size itself*/;
+            index_builder->push(core.refID,
+                                core.pos,
+                                static_cast<int64_t>(core.pos) + ref_length,
+                                !static_cast<bool>(flag & sam_flag::unmapped),
+                                index_record_offset,
+                                record_end);
+            index_record_offset = record_end;
+        }
+    } // if constexpr (!detail::decays_to_ignore_v<header_type>)
 }
 
-/*!\brief Reads the optional tag fields into the seqan3::sam_tag_dictionary.
- * \tparam stream_view_type   The type of the stream as a view.
- *
- * \param[in, out] stream_view  The stream view to iterate over.
- * \param[out]     target       The seqan3::sam_tag_dictionary to store the tag information.
- *
- * \throws seqan3::format_error if any unexpected character or format is encountered.
+/*!\brief Writes the records buffered by the sorter in sorted order.
+ * \tparam stream_type The type of the stream; must be derived from std::ostream.
+ * \param[in, out] stream The stream to write to.
+ * \throws seqan3::format_error If a temporary file cannot be read or, if the index is built, a record has a reference
+ *                              id that is not in the header.
  *
  * \details
  *
- * Reading the tags is done according to the official
- * [SAM format specifications](https://samtools.github.io/hts-specs/SAMv1.pdf).
- *
- * The function throws a seqan3::format_error if any unknown tag type was encountered. It will also fail if the
- * format is not in a correct state (e.g. required fields are not given), but throwing might occur downstream of
- * the actual error.
+ * Does nothing if seqan3::alignment_file_output_options::bam_sort_by_coordinate is not set. If an index is built,
+ * the records are added to it while they are written. Records written afterwards are sorted separately.
  */
-template <typename stream_view_type>
-inline void format_bam::read_field(stream_view_type && stream_view, sam_tag_dictionary & target)
+template <typename stream_type>
+inline void format_bam::write_sorted_records(stream_type & stream)
 {
-    /* Every BA< tag has the format "[TAG][TYPE_ID][VALUE]", where TAG is a two letter
-       name tag which is converted to a unique integer identifier and TYPE_ID is one character in [A,i,Z,H,B,f]
-       describing the type for the upcoming VALUES. If TYPE_ID=='B' it signals an array of
-       VALUE's and the inner value type is identified by the next character, one of [cCsSiIf], followed
-       by the length (int32_t) of the array, followed by the values.
-    */
-    uint16_t tag = static_cast<uint16_t>(*std::ranges::begin(stream_view)) << 8;
-    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
-    tag += static_cast<uint16_t>(*std::ranges::begin(stream_view));
-    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
-    char type_id = static_cast<char>(*std::ranges::begin(stream_view));
-    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
-
-    switch (type_id)
+    if (!sorter)
+        return;
+
+    sorter->finish([&] (std::string_view const record)
     {
-        case 'A' : // char
-        {
-            target[tag] = static_cast<char>(*std::ranges::begin(stream_view));
-            std::ranges::next(std::ranges::begin(stream_view)); // skip char that has been read
-            break;
-        }
-        // all integer sizes are possible
-        case 'c' : // int8_t
-        {
-            int8_t tmp;
-            read_field(stream_view, tmp);
-            target[tag] = static_cast<int32_t>(tmp); // readable sam format only allows int32_t
-            break;
-        }
-        case 'C' : // uint8_t
-        {
-            uint8_t tmp;
-            read_field(stream_view, tmp);
-            target[tag] = static_cast<int32_t>(tmp); // readable sam format only allows int32_t
-            break;
-        }
-        case 's' : // int16_t
-        {
-            int16_t tmp;
-            read_field(stream_view, tmp);
-            target[tag] = static_cast<int32_t>(tmp); // readable sam format only allows int32_t
-            break;
-        }
-        case 'S' : // uint16_t
-        {
-            uint16_t tmp;
-            read_field(stream_view, tmp);
-            target[tag] = static_cast<int32_t>(tmp); // readable sam format only allows int32_t
-            break;
-        }
-        case 'i' : // int32_t
-        {
-            int32_t tmp;
-            read_field(stream_view, tmp);
-            target[tag] = std::move(tmp); // readable sam format only allows int32_t
-            break;
-        }
-        case 'I' : // uint32_t
-        {
-            uint32_t tmp;
-            read_field(stream_view, tmp);
-            target[tag] = static_cast<int32_t>(tmp); // readable sam format only allows int32_t
-            break;
-        }
-        case 'f' : // float
-        {
-            float tmp;
-            read_field(stream_view, tmp);
-            target[tag] = tmp;
-            break;
-        }
-        case 'Z' : // string
+        stream.write(record.data(), record.size());
+
+        if (!index_builder)
+            return;
+
+        auto read = [&record] (auto value, size_t const position)
         {
-            string_buffer.clear();
-            while (!is_char<'\0'>(*std::ranges::begin(stream_view)))
-            {
-                string_buffer.push_back(*std::ranges::begin(stream_view));
-                std::ranges::next(std::ranges::begin(stream_view));
-            }
-            std::ranges::next(std::ranges::begin(stream_view)); // skip \0
-            target[tag] = string_buffer;
-            break;
-        }
-        case 'H' :
+            std::memcpy(&value, record.data() + position, sizeof(value));
+            return detail::to_little_endian(value);
+        };
+
+        int32_t const ref_id = read(int32_t{}, 4);
+        int32_t const pos = read(int32_t{}, 8);
+        uint8_t const l_read_name = read(uint8_t{}, 12);
+        uint16_t const n_cigar_op = read(uint16_t{}, 16);
+        sam_flag const flag = static_cast<sam_flag>(read(uint16_t{}, 18));
+
+        // M, D, N, = and X consume the reference.
+        int64_t ref_length{};
+        for (size_t i = 0; i < n_cigar_op; ++i)
         {
-            // TODO
-            break;
+            uint32_t const operation = read(uint32_t{}, 36 + l_read_name + 4 * i);
+            if ((0b110001101u >> (operation & 0x0f)) & 1u)
+                ref_length += operation >> 4;
         }
-        case 'B' : // Array. Value type depends on second char [cCsSiIf]
-        {
-            char array_value_type_id = *std::ranges::begin(stream_view);
-            std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
 
-            switch (array_value_type_id)
-            {
-                case 'c' : // int8_t
-                    read_sam_dict_vector(target[tag], stream_view, int8_t{});
-                    break;
-                case 'C' : // uint8_t
-                    read_sam_dict_vector(target[tag], stream_view, uint8_t{});
-                    break;
-                case 's' : // int16_t
-                    read_sam_dict_vector(target[tag], stream_view, int16_t{});
-                    break;
-                case 'S' : // uint16_t
-                    read_sam_dict_vector(target[tag], stream_view, uint16_t{});
-                    break;
-                case 'i' : // int32_t
-                    read_sam_dict_vector(target[tag], stream_view, int32_t{});
-                    break;
-                case 'I' : // uint32_t
-                    read_sam_dict_vector(target[tag], stream_view, uint32_t{});
-                    break;
-                case 'f' : // float
-                    read_sam_dict_vector(target[tag], stream_view, float{});
-                    break;
-                default:
-                    throw format_error{detail::to_string("The first character in the numerical id of a SAM tag ",
-                                       "must be one of [cCsSiIf] but '", array_value_type_id, "' was given.")};
-            }
-            break;
-        }
-        default:
-            throw format_error{detail::to_string("The second character in the numerical id of a "
-                               "SAM tag must be one of [A,i,Z,H,B,f] but '", type_id, "' was given.")};
+        uint64_t const record_end = index_record_offset + record.size();
+        index_builder->push(ref_id,
+                            pos,
+                            static_cast<int64_t>(pos) + ref_length,
+                            !static_cast<bool>(flag & sam_flag::unmapped),
+                            index_record_offset,
+                            record_end);
+        index_record_offset = record_end;
+    });
+}
+
+/*!\brief Reads the next record without decoding it.
+ * \tparam stream_type   The type of the stream; must be derived from std::istream.
+ * \param[in, out] stream   The stream to read from.
+ * \param[in, out] ref_seqs The reference sequences or std::ignore.
+ * \param[in, out] header   The header; read before the first record.
+ * \param[out]     record   The record to store the bytes in.
+ * \returns `false` if no record follows, otherwise `true`.
+ * \throws seqan3::format_error If the record is malformed.
+ */
+template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+inline bool format_bam::read_raw_record(stream_type & stream,
+                                        ref_seqs_type & ref_seqs,
+                                        alignment_file_header<ref_ids_type> & header,
+                                        bam_record & record)
+{
+    using stream_buf_t = std::istreambuf_iterator<typename stream_type::char_type>;
+
+    if (!header_was_read)
+    {
+        auto stream_view = std::ranges::subrange<decltype(stream_buf_t{stream}), decltype(stream_buf_t{})>
+                               {stream_buf_t{stream}, stream_buf_t{}};
+        read_bam_header(stream_view, header, ref_seqs);
+    }
+
+    if (stream_buf_t{stream} == stream_buf_t{})
+        return false;
+
+    // The record is copied as a whole, without looking at its fields.
+    int32_t block_size{};
+    if (!stream.read(reinterpret_cast<char *>(&block_size), sizeof(block_size)))
+        throw format_error{"The BAM record is truncated."};
+
+    block_size = detail::to_little_endian(block_size);
+
+    if (block_size < 0 || !stream.read(record.buffer(block_size), block_size))
+        throw format_error{"The BAM record is truncated."};
+
+    record.validate();
+
+    if (std::optional<int32_t> const ref_id = record.ref_id();
+        ref_id.has_value() && ref_id.value() >= static_cast<int32_t>(header.ref_ids().size())) // [[unlikely]]
+    {
+        throw format_error{detail::to_string("Reference id index '", ref_id.value(), "' is not in range of ",
+                                             "header.ref_ids(), which has size ", header.ref_ids().size(), ".")};
     }
+
+    return true;
 }
 
 /*!\brief Parses a cigar string into a vector of operation-count pairs (e.g. (M, 3)).
@@ -1124,9 +1180,16 @@ inline auto format_bam::parse_binary_cigar(cigar_input_type && cigar_input, uint
 
 /*!\brief Writes the optional fields of the seqan3::sam_tag_dictionary.
  * \param[in] tag_dict The tag dictionary to print.
+ *
+ * \details
+ *
+ * The tags of a record read from a BAM file which were never accessed are written as read, without decoding them.
  */
 inline std::string format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_dict)
 {
+    if (std::string_view const binary = tag_dict.bam_tags(); !binary.empty())
+        return std::string{binary};
+
     std::string result{};
 
     auto stream_variant_fn = [&result] (auto && arg) // helper to print an std::variant
@@ -1209,3 +1272,45 @@ inline std::string format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_d
 }
 
 } // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Exposes the reading of undecoded records of seqan3::format_bam in addition to the reading interface.
+ * \ingroup alignment_file
+ * \see seqan3::detail::alignment_file_input_format_exposer
+ */
+template <>
+struct alignment_file_input_format_exposer<format_bam> : public format_bam
+{
+public:
+    //!\brief Forwards to the seqan3::alignment_file_input_format::read_alignment_record interface.
+    template <typename ...ts>
+    void read_alignment_record(ts && ...args)
+    {
+        format_bam::read_alignment_record(std::forward<ts>(args)...);
+    }
+
+    using format_bam::read_raw_record;
+};
+
+/*!\brief Exposes the index builder of seqan3::format_bam in addition to the writing interface.
+ * \ingroup alignment_file
+ * \see seqan3::detail::alignment_file_output_format_exposer
+ */
+template <>
+struct alignment_file_output_format_exposer<format_bam> : public format_bam
+{
+public:
+    //!\brief Forwards to the seqan3::alignment_file_output_format::write_alignment_record interface.
+    template <typename ...ts>
+    void write_alignment_record(ts && ...args)
+    {
+        format_bam::write_alignment_record(std::forward<ts>(args)...);
+    }
+
+    using format_bam::index_builder;
+    using format_bam::write_sorted_records;
+};
+
+} // namespace seqan3::detail
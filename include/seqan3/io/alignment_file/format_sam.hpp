@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <array>
 #include <iterator>
 #include <string>
 #include <vector>
@@ -43,6 +44,7 @@
 #include <seqan3/range/views/to_char.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/std/algorithm>
+#include <seqan3/std/charconv>
 #include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
 
@@ -247,6 +249,9 @@ private:
     //!\brief Tracks whether reference information (\@SR tag) were found in the SAM header
     bool ref_info_present_in_header{false};
 
+    //!\brief The record that is written; formatted completely before it is written to the stream.
+    std::string record_buffer{};
+
     //!brief Returns a reference to dummy if passed a std::ignore.
     std::string_view const & default_or(detail::ignore_t) const noexcept
     {
@@ -276,11 +281,11 @@ private:
     template <typename stream_it_t>
     void write_range(stream_it_t & stream_it, char const * const field_value);
 
-    template <typename stream_t, arithmetic field_type>
-    void write_field(stream_t & stream, field_type field_value);
+    template <typename stream_it_t, arithmetic field_type>
+    void write_field(stream_it_t & stream_it, field_type field_value);
 
-    template <typename stream_t>
-    void write_tag_fields(stream_t & stream, sam_tag_dictionary const & tag_dict, char const separator);
+    template <typename stream_it_t>
+    void write_tag_fields(stream_it_t & stream_it, sam_tag_dictionary const & tag_dict, char const separator);
 };
 
 //!\copydoc sequence_file_input_format::read_sequence_record
@@ -664,9 +669,8 @@ inline void format_sam::write_alignment_record(stream_type & stream,
      *
      * - arithmetic values default to 0 while all others default to '*'
      *
-     * - Because of the former, arithmetic values can be directly streamed
-     *   into 'stream' as operator<< is defined for all arithmetic types
-     *   and the default value (0) is also the SAM default.
+     * - Because of the former, arithmetic values can be directly written
+     *   via write_field() as the default value (0) is also the SAM default.
      *
      * - All other non-arithmetic values need to be checked for emptiness
      */
@@ -792,14 +796,17 @@ inline void format_sam::write_alignment_record(stream_type & stream,
     // ---------------------------------------------------------------------
     // Writing the Record
     // ---------------------------------------------------------------------
-    seqan3::ostreambuf_iterator stream_it{stream};
+    // The record is formatted into a buffer and written at once; numbers are formatted without the stream's locale.
+    record_buffer.clear();
+    auto stream_it = std::back_inserter(record_buffer);
     char const separator{'\t'};
 
     write_range(stream_it, std::forward<id_type>(id));
 
-    stream << separator;
+    stream_it = separator;
 
-    stream << static_cast<uint16_t>(flag) << separator;
+    write_field(stream_it, static_cast<uint16_t>(flag));
+    stream_it = separator;
 
     if constexpr (!detail::decays_to_ignore_v<ref_id_type>)
     {
@@ -812,7 +819,7 @@ inline void format_sam::write_alignment_record(stream_type & stream,
             if (ref_id.has_value())
                 write_range(stream_it, (header.ref_ids())[ref_id.value()]);
             else
-                stream << '*';
+                stream_it = '*';
         }
         else
         {
@@ -821,15 +828,17 @@ inline void format_sam::write_alignment_record(stream_type & stream,
     }
     else
     {
-        stream << '*';
+        stream_it = '*';
     }
 
-    stream << separator;
+    stream_it = separator;
 
     // SAM is 1 based, 0 indicates unmapped read if optional is not set
-    stream << (ref_offset.value_or(-1) + 1) << separator;
+    write_field(stream_it, ref_offset.value_or(-1) + 1);
+    stream_it = separator;
 
-    stream << static_cast<unsigned>(mapq) << separator;
+    write_field(stream_it, static_cast<unsigned>(mapq));
+    stream_it = separator;
 
     if (!std::ranges::empty(get<0>(align)) && !std::ranges::empty(get<1>(align)))
     {
@@ -847,15 +856,18 @@ inline void format_sam::write_alignment_record(stream_type & stream,
     }
     else if (!cigar_vector.empty())
     {
-        for (auto & c : cigar_vector)
-            stream << c.to_string(); // returns a small_vector instead of char so write_range doesn't work
+        for (cigar const & c : cigar_vector)
+        {
+            write_field(stream_it, static_cast<uint32_t>(get<0>(c)));
+            stream_it = to_char(get<1>(c));
+        }
     }
     else
     {
-        stream << '*';
+        stream_it = '*';
     }
 
-    stream << separator;
+    stream_it = separator;
 
     if constexpr (std::integral<std::remove_reference_t<decltype(get<0>(mate))>>)
     {
@@ -868,36 +880,41 @@ inline void format_sam::write_alignment_record(stream_type & stream,
             // workaround for a ubsan false-positive in GCC8: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=90058
             write_range(stream_it, header.ref_ids()[get<0>(mate).value_or(0)]);
         else
-            stream << '*';
+            stream_it = '*';
     }
     else
     {
         write_range(stream_it, get<0>(mate));
     }
 
-    stream << separator;
+    stream_it = separator;
 
     if constexpr (detail::is_type_specialisation_of_v<remove_cvref_t<decltype(get<1>(mate))>, std::optional>)
     {
         // SAM is 1 based, 0 indicates unmapped read if optional is not set
-        stream << (get<1>(mate).value_or(-1) + 1) << separator;
+        write_field(stream_it, get<1>(mate).value_or(-1) + 1);
     }
     else
     {
-        stream << get<1>(mate) << separator;
+        write_field(stream_it, get<1>(mate));
     }
 
-    stream << get<2>(mate) << separator;
+    stream_it = separator;
+
+    write_field(stream_it, get<2>(mate));
+    stream_it = separator;
 
     write_range(stream_it, std::forward<seq_type>(seq));
 
-    stream << separator;
+    stream_it = separator;
 
     write_range(stream_it, std::forward<qual_type>(qual));
 
-    write_tag_fields(stream, std::forward<tag_dict_type>(tag_dict), separator);
+    write_tag_fields(stream_it, std::forward<tag_dict_type>(tag_dict), separator);
 
     detail::write_eol(stream_it, options.add_carriage_return);
+
+    stream.write(record_buffer.data(), record_buffer.size());
 }
 
 
@@ -996,9 +1013,9 @@ inline void format_sam::read_field(stream_view_type && stream_view, sam_tag_dict
             target[tag] = stream_view | views::to<std::string>;
             break;
         }
-        case 'H' :
+        case 'H' : // hex string, kept as string
         {
-            // TODO
+            target[tag] = stream_view | views::to<std::string>;
             break;
         }
         case 'B' : // Array. Value type depends on second char [cCsSiIf]
@@ -1071,38 +1088,67 @@ inline void format_sam::write_range(stream_it_t & stream_it, char const * const
     write_range(stream_it, std::string_view{field_value});
 }
 
-/*!\brief Writes a field value to the stream.
- * \tparam stream_t           The stream type.
- * \param[in,out] stream      The stream to print to.
+/*!\brief Writes a number to the stream.
+ * \tparam stream_it_t The stream iterator type.
+ * \tparam field_type  The type of the field value. Must model seqan3::arithmetic.
+ *
+ * \param[in,out] stream_it   The stream iterator to print to.
  * \param[in]     field_value The value to print.
+ *
+ * \details
+ *
+ * The number is formatted via std::to_chars; floating point numbers are formatted like `std::ostream::operator<<`
+ * does with the default precision of 6 significant digits.
  */
-template <typename stream_t, arithmetic field_type>
-inline void format_sam::write_field(stream_t & stream, field_type field_value)
+template <typename stream_it_t, arithmetic field_type>
+inline void format_sam::write_field(stream_it_t & stream_it, field_type field_value)
 {
-    // TODO: replace this with to_chars for efficiency
-    if constexpr (std::same_as<field_type, int8_t> || std::same_as<field_type, uint8_t>)
-        stream << static_cast<int16_t>(field_value);
+    if constexpr (std::same_as<field_type, char>)
+    {
+        stream_it = field_value;
+    }
     else
-        stream << field_value;
+    {
+        std::array<char, 32> buffer{};
+        char * const last = buffer.data() + buffer.size();
+        std::to_chars_result result{};
+
+        if constexpr (std::same_as<field_type, int8_t> || std::same_as<field_type, uint8_t>)
+            result = std::to_chars(buffer.data(), last, static_cast<int16_t>(field_value));
+    #if __cpp_lib_to_chars >= 201611
+        else if constexpr (floating_point<field_type>)
+            result = std::to_chars(buffer.data(), last, field_value, std::chars_format::general, 6);
+    #endif // otherwise, the fallback in seqan3/std/charconv formats floating point numbers via std::ostringstream
+        else
+            result = std::to_chars(buffer.data(), last, field_value);
+
+        std::copy(buffer.data(), result.ptr, stream_it);
+    }
 }
 
 /*!\brief Writes the optional fields of the seqan3::sam_tag_dictionary.
- * \tparam stream_t   The stream type.
+ * \tparam stream_it_t The stream iterator type.
  *
- * \param[in,out] stream    The stream to print to.
+ * \param[in,out] stream_it The stream iterator to print to.
  * \param[in]     tag_dict  The tag dictionary to print.
  * \param[in]     separator The field separator to append.
  */
-template <typename stream_t>
-inline void format_sam::write_tag_fields(stream_t & stream, sam_tag_dictionary const & tag_dict, char const separator)
+template <typename stream_it_t>
+inline void format_sam::write_tag_fields(stream_it_t & stream_it,
+                                         sam_tag_dictionary const & tag_dict,
+                                         char const separator)
 {
-    auto stream_variant_fn = [this, &stream] (auto && arg) // helper to print an std::variant
+    auto stream_variant_fn = [this, &stream_it] (auto && arg) // helper to print an std::variant
     {
         using T = remove_cvref_t<decltype(arg)>;
 
-        if constexpr (!container<T> || std::same_as<T, std::string>)
+        if constexpr (std::same_as<T, std::string>)
+        {
+            std::ranges::copy(arg, stream_it);
+        }
+        else if constexpr (!container<T>)
         {
-            stream << arg;
+            write_field(stream_it, arg);
         }
         else
         {
@@ -1110,26 +1156,30 @@ inline void format_sam::write_tag_fields(stream_t & stream, sam_tag_dictionary c
             {
                 for (auto it = arg.begin(); it != (arg.end() - 1); ++it)
                 {
-                    write_field(stream, *it);
-                    stream << ',';
+                    write_field(stream_it, *it);
+                    stream_it = ',';
                 }
 
-                write_field(stream, *(arg.end() - 1)); // write last value without trailing ','
+                write_field(stream_it, *(arg.end() - 1)); // write last value without trailing ','
             }
         }
     };
 
     for (auto & [tag, variant] : tag_dict)
     {
-        stream << separator;
+        stream_it = separator;
 
-        char char0 = tag / 256;
-        char char1 = tag % 256;
-
-        stream << char0 << char1 << ':' << detail::sam_tag_type_char[variant.index()] << ':';
+        stream_it = static_cast<char>(tag / 256);
+        stream_it = static_cast<char>(tag % 256);
+        stream_it = ':';
+        stream_it = detail::sam_tag_type_char[variant.index()];
+        stream_it = ':';
 
         if (detail::sam_tag_type_char_extra[variant.index()] != '\0')
-            stream << detail::sam_tag_type_char_extra[variant.index()] << ',';
+        {
+            stream_it = detail::sam_tag_type_char_extra[variant.index()];
+            stream_it = ',';
+        }
 
         std::visit(stream_variant_fn, variant);
     }
@@ -13,12 +13,12 @@
 #pragma once
 
 #include <deque>
-#include <unordered_map>
 #include <vector>
 
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/type_traits/pre.hpp>
 #include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/io/alignment_file/reference_id_map.hpp>
 #include <seqan3/range/hash.hpp>
 #include <seqan3/range/views/type_reduce.hpp>
 #include <seqan3/std/ranges>
@@ -154,8 +154,14 @@ public:
      */
     std::vector<std::tuple<int32_t, std::string>> ref_id_info{};
 
-    //!\brief The mapping of reference id to position in the ref_ids() range and the ref_id_info range.
-    std::unordered_map<key_type, int32_t, std::hash<key_type>, detail::view_equality_fn> ref_dict{};
+    /*!\brief The mapping of reference id to position in the ref_ids() range and the ref_id_info range.
+     *
+     * \details
+     *
+     * The dictionary provides `find`, `count`, `operator[]`, `reserve` and iteration like std::unordered_map;
+     * its entries are iterated in the order of their insertion.
+     */
+    detail::reference_id_map<key_type> ref_dict{};
 
     /*!\brief The Read Group Dictionary (used by the SAM/BAM format).
      *
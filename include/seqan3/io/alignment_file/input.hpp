@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <fstream>
+#include <stdexcept>
 #include <string>
 #include <variant>
 #include <vector>
@@ -28,6 +29,8 @@
 #include <seqan3/core/type_list/traits.hpp>
 #include <seqan3/core/type_traits/transformation_trait_or.hpp>
 #include <seqan3/io/alignment_file/input_format_concept.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/misc.hpp>
@@ -260,6 +263,9 @@ struct alignment_file_input_default_traits
  * seqan3::alignment_file_header of the file.)
  *
  * All of these fields are retrieved by default (and in that order) except the field::cigar.
+ * Reading seqan3::field::alignment inserts the gaps of every record into seqan3::gap_decorator objects; if you only
+ * need the alignment of some records, read seqan3::field::cigar instead and create the alignment on demand with
+ * seqan3::lazy_alignment_from_cigar, which inserts the gaps while iterating.
  * Note that some of the fields are specific to the SAM format (e.g. seqan3::field::flag) while others are specific to
  * BLAST format (e.g. seqan3::field::bit_score). Please see the corresponding formats for more details
  * (seqan3::format_sam).
@@ -574,6 +580,9 @@ public:
      * (e.g. `seqan3::fields<seqan3::field::seq>{}`) which may be easier than
      * defining all the template parameters.
      *
+     * Regular files are memory-mapped and read directly from the mapping; other files, e.g. named pipes or files
+     * reporting size 0, are read through a std::ifstream.
+     *
      * ### Decompression
      *
      * This constructor transparently applies a decompression stream on top of the file stream in case
@@ -582,7 +591,7 @@ public:
      */
     alignment_file_input(std::filesystem::path filename,
                          selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{filename, std::ios_base::in | std::ios::binary}, stream_deleter_default}
+        primary_stream{detail::make_primary_istream<stream_char_type>(filename).release(), stream_deleter_default}
     {
         init(filename);
     }
@@ -648,6 +657,9 @@ public:
      * (e.g. `seqan3::fields<seqan3::field::seq>{}`) which may be easier than
      * defining all the template parameters.
      *
+     * Regular files are memory-mapped and read directly from the mapping; other files, e.g. named pipes or files
+     * reporting size 0, are read through a std::ifstream.
+     *
      * ### Decompression
      *
      * This constructor transparently applies a decompression stream on top of the file stream in case
@@ -658,7 +670,7 @@ public:
                          typename traits_type::ref_ids & ref_ids,
                          typename traits_type::ref_sequences & ref_sequences,
                          selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{filename, std::ios_base::in | std::ios::binary}, stream_deleter_default}
+        primary_stream{detail::make_primary_istream<stream_char_type>(filename).release(), stream_deleter_default}
     {
         // initialize reference information
         set_references(ref_ids, ref_sequences);
@@ -833,7 +845,7 @@ public:
     header_type & header()
     {
         // make sure header is read
-        if (!first_record_was_read)
+        if (!first_record_was_read && !raw_records_were_read)
         {
             read_next_record();
             first_record_was_read = true;
@@ -842,9 +854,177 @@ public:
         return *header_ptr;
     }
 
+    /*!\brief Restricts the file to the records overlapping a region, using the index of a BAM file.
+     * \param[in] index  The index of the file.
+     * \param[in] ref_id The index of the reference in the header, e.g. from `header().ref_dict`.
+     * \param[in] begin  The first position of the region (0-based).
+     * \param[in] end    The position behind the last position of the region.
+     * \throws std::logic_error If the file is not a BGZF compressed BAM file.
+     * \throws seqan3::format_error If the header could not be read.
+     *
+     * \details
+     *
+     * Afterwards, begin() points to the first record that overlaps `[begin, end)` and iterating stops behind the last
+     * such record. Only the BGZF blocks that contain the chunks returned by seqan3::bam_index::query are decompressed.
+     * The region can be changed at any time, which invalidates all iterators. Records are filtered by their cigar
+     * string, i.e. the position and cigar are read even if seqan3::field::ref_offset or seqan3::field::cigar are not
+     * selected.
+     *
+     * ### Example
+     *
+     * ```cpp
+     * seqan3::alignment_file_input fin{"sorted.bam"};
+     *
+     * // All records overlapping the positions [10'000, 20'000) of the second reference in the header.
+     * // The index is read from sorted.bam.bai.
+     * fin.set_region(1, 10'000, 20'000);
+     *
+     * for (auto & record : fin)
+     *     seqan3::debug_stream << seqan3::get<seqan3::field::id>(record) << '\n';
+     * ```
+     */
+    void set_region(bam_index const & index, int32_t const ref_id, int64_t const begin, int64_t const end)
+    {
+        bool is_bgzf_bam = false;
+    #ifdef SEQAN3_HAS_ZLIB
+        std::visit([&] (auto & f)
+        {
+            is_bgzf_bam = std::same_as<std::remove_reference_t<decltype(f)>,
+                                       detail::alignment_file_input_format_exposer<format_bam>> &&
+                          dynamic_cast<contrib::basic_bgzf_istream<stream_char_type> *>(&*secondary_stream) != nullptr;
+        }, format);
+    #endif // SEQAN3_HAS_ZLIB
+
+        if (!is_bgzf_bam)
+            throw std::logic_error{"Regions can only be read from BGZF compressed BAM files."};
+
+        header(); // Reads the header of the file with the first record.
+
+        region_active = true;
+        region_ref_id = ref_id;
+        region_begin = begin;
+        region_end = end;
+        region_chunks = index.query(ref_id, begin, end);
+        region_chunk = 0;
+        at_end = false;
+
+        if (region_chunks.empty())
+        {
+            at_end = true;
+            return;
+        }
+
+        secondary_stream->clear();
+        secondary_stream->seekg(region_chunks.front().begin);
+        read_next_record();
+    }
+
+    /*!\brief Restricts the file to the records overlapping a region, reading the index from the disk.
+     * \param[in] ref_id The index of the reference in the header, e.g. from `header().ref_dict`.
+     * \param[in] begin  The first position of the region (0-based).
+     * \param[in] end    The position behind the last position of the region.
+     * \throws seqan3::file_open_error If the file was not constructed from a filename or no index was found.
+     * \throws seqan3::format_error If the index is invalid.
+     *
+     * \details
+     *
+     * Reads the index from `<filename>.bai`, `<filename>.csi` or, with the `.bam` extension replaced, `<stem>.bai`
+     * and keeps it for further calls. See the other overload for how the region is read.
+     */
+    void set_region(int32_t const ref_id, int64_t const begin, int64_t const end)
+    {
+        if (!region_index)
+        {
+            std::filesystem::path const candidates[]{std::filesystem::path{file_name} += ".bai",
+                                                     std::filesystem::path{file_name} += ".csi",
+                                                     std::filesystem::path{file_name}.replace_extension(".bai")};
+
+            for (std::filesystem::path const & candidate : candidates)
+            {
+                if (file_name.empty() || !std::filesystem::exists(candidate))
+                    continue;
+
+                std::ifstream index_stream{candidate, std::ios_base::in | std::ios::binary};
+                region_index.emplace();
+                region_index->read(index_stream);
+                break;
+            }
+
+            if (!region_index)
+                throw file_open_error{"Could not find an index (.bai or .csi) for " + file_name.string() + "."};
+        }
+
+        set_region(*region_index, ref_id, begin, end);
+    }
+
+    /*!\brief Reads the next record of a BAM file without decoding it.
+     * \param[out] record The record to store the bytes in; its memory is reused.
+     * \returns `false` if the file contains no further records, otherwise `true`.
+     * \throws std::logic_error If the file is not a BAM file or records were already read via begin() or header().
+     * \throws seqan3::format_error If the header or the record is malformed.
+     *
+     * \details
+     *
+     * Instead of decoding the selected fields, the bytes of the record are copied into `record` and each field is
+     * decoded when it is accessed, see seqan3::bam_record. This is useful for filtering records, as records that are
+     * discarded after looking at their flag, mapping quality or position cost little more than decompressing them.
+     *
+     * Raw and decoded records cannot be mixed, i.e. call this function before begin() and front(). The header is
+     * read with the first record; afterwards, it can be accessed via header(). Regions (set_region()) are not
+     * considered.
+     *
+     * ### Example
+     *
+     * ```cpp
+     * seqan3::alignment_file_input fin{"mapped.bam"};
+     * seqan3::bam_record record{};
+     *
+     * while (fin.read_raw_record(record))
+     *     if (record.mapq() >= 30)
+     *         seqan3::debug_stream << record.id() << '\t' << fin.header().ref_ids()[*record.ref_id()] << '\n';
+     * ```
+     */
+    bool read_raw_record(bam_record & record)
+    {
+        if (first_record_was_read && !raw_records_were_read)
+            throw std::logic_error{"Raw records cannot be read after records were read via begin() or header()."};
+
+        bool is_bam = false;
+        bool has_record = false;
+
+        auto call_read_func = [&] (auto & ref_seq_info)
+        {
+            std::visit([&] (auto & f)
+            {
+                if constexpr (std::same_as<std::remove_reference_t<decltype(f)>,
+                                           detail::alignment_file_input_format_exposer<format_bam>>)
+                {
+                    is_bam = true;
+                    has_record = f.read_raw_record(*secondary_stream, ref_seq_info, *header_ptr, record);
+                }
+            }, format);
+        };
+
+        if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+            call_read_func(*reference_sequences_ptr);
+        else
+            call_read_func(std::ignore);
+
+        if (!is_bam)
+            throw std::logic_error{"Raw records can only be read from BAM files."};
+
+        first_record_was_read = true;
+        raw_records_were_read = true;
+        at_end = !has_record;
+        return has_record;
+    }
+
 protected:
     //!\privatesection
 
+    //!\brief The index read by set_region(int32_t, int64_t, int64_t).
+    std::optional<bam_index> region_index{};
+
     //!/brief Initialisation based on a filename.
     void init(std::filesystem::path & filename)
     {
@@ -854,6 +1034,7 @@ protected:
 
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
         detail::set_format(format, filename);
+        file_name = filename;
     }
 
     //!/brief Initialisation based on a format (construction via stream).
@@ -893,8 +1074,13 @@ protected:
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
 
+    //!\brief The name of the file if constructed from filename; the index is searched next to it.
+    std::filesystem::path file_name{};
+
     //!\brief Tracks whether the very first record is buffered when calling begin().
     bool first_record_was_read{false};
+    //!\brief Whether the records are read via read_raw_record() instead of the record buffer.
+    bool raw_records_were_read{false};
     //!\brief File is one position behind the last record.
     bool at_end{false};
 
@@ -931,6 +1117,9 @@ protected:
         reference_sequences_ptr = &ref_sequences;
 
         // initialise reference map and ref_dict if ref_ids are non-empty
+        header_ptr->ref_id_info.reserve(std::ranges::distance(ref_ids));
+        header_ptr->ref_dict.reserve(std::ranges::distance(ref_ids));
+
         for (int32_t idx = 0; idx < std::ranges::distance(ref_ids); ++idx)
         {
             header_ptr->ref_id_info.emplace_back(std::ranges::distance(ref_sequences[idx]), "");
@@ -952,6 +1141,22 @@ protected:
 
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
+    {
+        if (region_active)
+            read_next_region_record();
+        else
+            read_record(detail::get_or_ignore<field::ref_id>(record_buffer),
+                        detail::get_or_ignore<field::ref_offset>(record_buffer),
+                        detail::get_or_ignore<field::cigar>(record_buffer));
+    }
+
+    /*!\brief Reads the next record into the buffer; the fields needed to filter a region are passed separately.
+     * \param[out] ref_id       The reference id of the record; seqan3::field::ref_id or a separate buffer.
+     * \param[out] ref_offset   The position of the record; seqan3::field::ref_offset or a separate buffer.
+     * \param[out] cigar_vector The cigar of the record; seqan3::field::cigar or a separate buffer.
+     */
+    template <typename ref_id_t, typename ref_offset_t, typename cigar_t>
+    void read_record(ref_id_t & ref_id, ref_offset_t & ref_offset, cigar_t & cigar_vector)
     {
         // clear the record
         record_buffer.clear();
@@ -965,7 +1170,7 @@ protected:
             return;
         }
 
-        auto call_read_func = [this] (auto & ref_seq_info)
+        auto call_read_func = [&] (auto & ref_seq_info)
         {
             std::visit([&] (auto & f)
             {
@@ -978,10 +1183,10 @@ protected:
                                         detail::get_or_ignore<field::id>(record_buffer),
                                         detail::get_or_ignore<field::offset>(record_buffer),
                                         detail::get_or_ignore<field::ref_seq>(record_buffer),
-                                        detail::get_or_ignore<field::ref_id>(record_buffer),
-                                        detail::get_or_ignore<field::ref_offset>(record_buffer),
+                                        ref_id,
+                                        ref_offset,
                                         detail::get_or_ignore<field::alignment>(record_buffer),
-                                        detail::get_or_ignore<field::cigar>(record_buffer),
+                                        cigar_vector,
                                         detail::get_or_ignore<field::flag>(record_buffer),
                                         detail::get_or_ignore<field::mapq>(record_buffer),
                                         detail::get_or_ignore<field::mate>(record_buffer),
@@ -999,6 +1204,93 @@ protected:
             call_read_func(std::ignore);
     }
 
+    /*!\name Region access
+     * \{
+     */
+    //!\brief Whether only the records overlapping a region are read, see set_region().
+    bool region_active{false};
+    //!\brief The reference id of the region.
+    int32_t region_ref_id{};
+    //!\brief The first position of the region.
+    int64_t region_begin{};
+    //!\brief The position behind the region.
+    int64_t region_end{};
+    //!\brief The chunks of the file that may contain records of the region.
+    std::vector<bam_index::chunk> region_chunks{};
+    //!\brief The chunk that is currently read.
+    size_t region_chunk{};
+    //!\brief Reference id of the current record if seqan3::field::ref_id is not selected.
+    std::optional<int32_t> region_ref_id_buffer{};
+    //!\brief Position of the current record if seqan3::field::ref_offset is not selected.
+    std::optional<int32_t> region_ref_offset_buffer{};
+    //!\brief Cigar of the current record if seqan3::field::cigar is not selected.
+    std::vector<cigar> region_cigar_buffer{};
+
+    //!\brief Returns the field of the record buffer if it is selected, otherwise the given buffer.
+    template <field field_id, typename buffer_t>
+    auto & field_or_buffer(buffer_t & buffer)
+    {
+        if constexpr (selected_field_ids::contains(field_id))
+            return detail::get_or_ignore<field_id>(record_buffer);
+        else
+            return buffer;
+    }
+
+    //!\brief Reads the next record overlapping the region, skipping the parts of the file outside of its chunks.
+    void read_next_region_record()
+    {
+        auto & ref_id = field_or_buffer<field::ref_id>(region_ref_id_buffer);
+        auto & ref_offset = field_or_buffer<field::ref_offset>(region_ref_offset_buffer);
+        auto & cigar_vector = field_or_buffer<field::cigar>(region_cigar_buffer);
+
+        while (true)
+        {
+            uint64_t const position = static_cast<uint64_t>(secondary_stream->tellg());
+
+            while (region_chunk < region_chunks.size() && region_chunks[region_chunk].end <= position)
+                ++region_chunk;
+
+            if (region_chunk == region_chunks.size())
+            {
+                at_end = true;
+                return;
+            }
+
+            if (position < region_chunks[region_chunk].begin)
+                secondary_stream->seekg(region_chunks[region_chunk].begin);
+
+            region_ref_id_buffer.reset();
+            region_ref_offset_buffer.reset();
+            region_cigar_buffer.clear();
+
+            read_record(ref_id, ref_offset, cigar_vector);
+
+            if (at_end)
+                return;
+
+            // The records are sorted by coordinate, i.e. no later record overlaps the region.
+            if (!ref_id.has_value() || ref_id.value() != region_ref_id ||
+                !ref_offset.has_value() || ref_offset.value() >= region_end)
+            {
+                at_end = true;
+                return;
+            }
+
+            int64_t reference_length{};
+            for (auto [count, operation] : cigar_vector)
+            {
+                char const op = operation.to_char();
+                if (op == 'M' || op == 'D' || op == 'N' || op == '=' || op == 'X')
+                    reference_length += count;
+            }
+
+            // Records without aligned bases cover one position, as in the binning scheme.
+            if (ref_offset.value() + std::max<int64_t>(reference_length, 1) > region_begin)
+                return;
+        }
+    }
+    //!\}
+
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
 };
@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -21,6 +22,7 @@
 
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/type_list/traits.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
@@ -29,6 +31,7 @@
 #include <seqan3/io/alignment_file/output_options.hpp>
 #include <seqan3/io/detail/out_file_iterator.hpp>
 #include <seqan3/io/detail/misc_output.hpp>
+#include <seqan3/io/detail/parallel_record_writer.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
@@ -159,6 +162,22 @@ namespace seqan3
  *
  * \include test/snippet/io/alignment_file/alignment_file_output_io_pipeline.cpp
  *
+ * ### Serialising with multiple threads
+ *
+ * When a range of records is assigned to the file, the records can be serialised by multiple threads by setting
+ * seqan3::alignment_file_output_options::threads. The records are copied into batches, every batch is serialised
+ * into its own buffer and the buffers are written in the order of the records, so the file is the same as if it
+ * was written by a single thread. Fields that are views, e.g. std::string_view, must stay valid until the
+ * assignment returns.
+ *
+ * ### Sorting BAM files
+ *
+ * If seqan3::alignment_file_output_options::bam_sort_by_coordinate is set, the records of a BAM file are sorted by
+ * reference id and position with an external merge sort: records are buffered up to a memory limit, sorted and
+ * written to temporary files, which are merged into the file by close(). The destructor calls close() if you did not,
+ * but it cannot report errors, e.g. if a temporary file cannot be read or the index cannot be written; call close()
+ * to handle them.
+ *
  * ### Formats
  *
  * We currently support writing the following formats:
@@ -270,8 +289,23 @@ public:
     alignment_file_output(alignment_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     alignment_file_output & operator=(alignment_file_output &&) = default;
-    //!\brief Destructor is defaulted.
-    ~alignment_file_output() = default;
+    /*!\brief Calls close(), but ignores errors, because a destructor must not throw.
+     *
+     * \details
+     *
+     * Call close() before if seqan3::alignment_file_output_options::bam_sort_by_coordinate or
+     * seqan3::alignment_file_output_options::bam_create_index is set; otherwise you cannot notice that the file or the
+     * index is incomplete.
+     */
+    ~alignment_file_output()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {}
+    }
 
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
@@ -306,11 +340,13 @@ public:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for writing."};
 
-        // possibly add intermediate compression stream
-        secondary_stream = detail::make_secondary_ostream(*primary_stream, filename);
+        // possibly add intermediate compression stream, which is created on first use to apply the options
+        compression_extension = detail::strip_compression_extension(filename);
 
         // initialise format handler or throw if format is not found
         detail::set_format(format, filename);
+
+        file_name = std::move(filename);
     }
 
     /*!\brief Construct from an existing stream and with specified format.
@@ -513,25 +549,7 @@ public:
                  requires { requires detail::is_type_specialisation_of_v<remove_cvref_t<record_t>, record>; }
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
-
-        write_record(detail::get_or<field::header_ptr>(r, nullptr),
-                     detail::get_or<field::seq>(r, std::string_view{}),
-                     detail::get_or<field::qual>(r, std::string_view{}),
-                     detail::get_or<field::id>(r, std::string_view{}),
-                     detail::get_or<field::offset>(r, 0u),
-                     detail::get_or<field::ref_seq>(r, std::string_view{}),
-                     detail::get_or<field::ref_id>(r, std::ignore),
-                     detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
-                     detail::get_or<field::alignment>(r, default_align_t{}),
-                     detail::get_or<field::cigar>(r, std::vector<cigar>{}),
-                     detail::get_or<field::flag>(r, sam_flag::none),
-                     detail::get_or<field::mapq>(r, 0u),
-                     detail::get_or<field::mate>(r, default_mate_t{}),
-                     detail::get_or<field::tags>(r, sam_tag_dictionary{}),
-                     detail::get_or<field::evalue>(r, 0u),
-                     detail::get_or<field::bit_score>(r, 0u));
+        write_record(get_stream(), format, std::forward<record_t>(r));
     }
 
     /*!\brief           Write a record in form of a std::tuple to the file.
@@ -561,26 +579,7 @@ public:
         requires tuple_like<tuple_t>
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
-
-        // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
-        write_record(detail::get_or<selected_field_ids::index_of(field::header_ptr)>(t, nullptr),
-                     detail::get_or<selected_field_ids::index_of(field::seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::qual)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::id)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::offset)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::ref_seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::ref_id)>(t, std::ignore),
-                     detail::get_or<selected_field_ids::index_of(field::ref_offset)>(t, std::optional<int32_t>{}),
-                     detail::get_or<selected_field_ids::index_of(field::alignment)>(t, default_align_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::cigar)>(t, std::vector<cigar>{}),
-                     detail::get_or<selected_field_ids::index_of(field::flag)>(t, sam_flag::none),
-                     detail::get_or<selected_field_ids::index_of(field::mapq)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::mate)>(t, default_mate_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::tags)>(t, sam_tag_dictionary{}),
-                     detail::get_or<selected_field_ids::index_of(field::evalue)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::bit_score)>(t, 0u));
+        write_record(get_stream(), format, std::forward<tuple_t>(t));
     }
 
     /*!\brief            Write a record to the file by passing individual fields.
@@ -619,7 +618,9 @@ public:
      *
      * \details
      *
-     * This function simply iterates over the argument and calls push_back() on each element.
+     * This function simply iterates over the argument and calls push_back() on each element. If
+     * seqan3::alignment_file_output_options::threads is greater than 1, the records are serialised by multiple threads
+     * instead, see the section on serialising with multiple threads in the class documentation.
      *
      * ### Complexity
      *
@@ -639,6 +640,18 @@ public:
         requires std::ranges::input_range<rng_t> && tuple_like<reference_t<rng_t>>
     //!\endcond
     {
+        if constexpr (std::same_as<stream_char_type, char> &&
+                      std::constructible_from<value_type_t<rng_t>, reference_t<rng_t>>)
+        {
+            // The index needs the position of every record in the file, i.e. it is only built sequentially.
+            // When sorting, the records are buffered by the format, which uses the threads for sorting instead.
+            if (options.threads > 1 && !options.bam_create_index && !options.bam_sort_by_coordinate)
+            {
+                write_range_parallel(range);
+                return *this;
+            }
+        }
+
         for (auto && record : range)
             push_back(std::forward<decltype(record)>(record));
         return *this;
@@ -702,6 +715,14 @@ public:
      */
     std::basic_ostream<stream_char_type> & get_stream()
     {
+        if (!secondary_stream)
+        {
+            secondary_stream = detail::make_compression_ostream(*primary_stream,
+                                                                compression_extension,
+                                                                options.compression_level,
+                                                                options.compression_threads);
+        }
+
         return *secondary_stream;
     }
     //!\endcond
@@ -725,6 +746,131 @@ public:
         return *header_ptr;
     }
 
+    /*!\brief Writes the sorted records and the index if requested by the options, and closes the file.
+     * \throws seqan3::format_error If a temporary file of the sorting cannot be read, or if the records were not sorted
+     *                              by coordinate although seqan3::alignment_file_output_options::bam_create_index is
+     *                              set.
+     * \throws std::logic_error If seqan3::alignment_file_output_options::bam_create_index is set, but the file is not a
+     *                          BGZF compressed BAM file; see index().
+     * \throws seqan3::file_open_error If the index file cannot be opened for writing.
+     * \throws std::ios_base::failure If the index file cannot be written.
+     *
+     * \details
+     *
+     * If seqan3::alignment_file_output_options::bam_sort_by_coordinate is set, the buffered records are written.
+     * If seqan3::alignment_file_output_options::bam_create_index is set and the file was constructed from the filename
+     * of a BAM file, the index is written to `<filename>.bai`, or to `<filename>.csi` if a reference is too long for
+     * the BAI format. Afterwards, the streams are flushed and released, also if an error is thrown; the file must not
+     * be used anymore. Calling close() again does nothing.
+     *
+     * The destructor calls this function, but has to ignore the errors; call it yourself to handle them.
+     */
+    void close()
+    {
+        if (!primary_stream)
+            return;
+
+        try
+        {
+            get_stream(); // an empty compressed file still needs the compression stream, e.g. for the BGZF EOF block
+            write_sorted_records();
+
+            if (options.bam_create_index && !file_name.empty())
+            {
+                bam_index const result = index();
+                std::filesystem::path index_file_name = file_name;
+                index_file_name += result.is_csi() ? ".csi" : ".bai";
+
+                std::ofstream index_stream{index_file_name, std::ios_base::out | std::ios::binary};
+
+                if (!index_stream.is_open())
+                    throw file_open_error{"Could not open file " + index_file_name.string() + " for writing."};
+
+                index_stream.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+                result.write(index_stream);
+                index_stream.close();
+            }
+        }
+        catch (...)
+        {
+            secondary_stream.reset();
+            primary_stream.reset();
+            throw;
+        }
+
+        // The compression stream writes its last blocks when it is destroyed, so it is released first.
+        secondary_stream.reset();
+        primary_stream.reset();
+    }
+
+    /*!\brief Returns the index of the records written so far.
+     * \throws std::logic_error If seqan3::alignment_file_output_options::bam_create_index was not set before writing
+     *                          the first record, or if the file is not a BGZF compressed BAM file.
+     * \throws seqan3::format_error If the records were not sorted by coordinate; already thrown while writing.
+     *
+     * \details
+     *
+     * Flushes the file, such that all records are in compressed blocks with known offsets. Usually, you do not need
+     * to call this function, because the index is written next to the file by close() if the file was opened by
+     * filename. If the records are sorted, the buffered records are written first, see write_sorted_records().
+     */
+    bam_index index()
+    {
+        write_sorted_records();
+
+        bam_index result{};
+        bool found = false;
+
+        std::visit([&] (auto & f)
+        {
+            if constexpr (std::same_as<std::remove_reference_t<decltype(f)>,
+                                       detail::alignment_file_output_format_exposer<format_bam>>)
+            {
+            #ifdef SEQAN3_HAS_ZLIB
+                auto * bgzf_stream = dynamic_cast<contrib::basic_bgzf_ostream<stream_char_type> *>(&get_stream());
+
+                if (f.index_builder && bgzf_stream != nullptr && block_index_recorded)
+                {
+                    bgzf_stream->flush();
+                    contrib::bgzf_index const & blocks = bgzf_stream->rdbuf()->block_index();
+                    result = f.index_builder->finish([&blocks] (uint64_t const offset)
+                    {
+                        return blocks.virtual_offset(offset);
+                    });
+                    found = true;
+                }
+            #endif // SEQAN3_HAS_ZLIB
+            }
+        }, format);
+
+        if (!found)
+            throw std::logic_error{"An index can only be created for BGZF compressed BAM files and the option "
+                                   "bam_create_index must be set before writing the first record."};
+
+        return result;
+    }
+
+    /*!\brief Writes the records buffered for sorting.
+     * \throws seqan3::format_error If a temporary file of the sorting cannot be read.
+     *
+     * \details
+     *
+     * Does nothing unless seqan3::alignment_file_output_options::bam_sort_by_coordinate is set. Usually, you do not
+     * need to call this function, because the records are written by close(). Records written afterwards are
+     * sorted separately and appended, i.e. the file is not sorted anymore.
+     */
+    void write_sorted_records()
+    {
+        std::visit([&] (auto & f)
+        {
+            if constexpr (std::same_as<std::remove_reference_t<decltype(f)>,
+                                       detail::alignment_file_output_format_exposer<format_bam>>)
+            {
+                f.write_sorted_records(get_stream());
+            }
+        }, format);
+    }
+
 protected:
     //!\privatesection
 
@@ -743,6 +889,8 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief The compression extension of the file name; the secondary stream is created from it on first use.
+    std::string compression_extension{};
 
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = typename detail::variant_from_tags<valid_formats,
@@ -760,6 +908,11 @@ protected:
     //!\brief The file header object (will be set on construction).
     std::unique_ptr<header_type> header_ptr;
 
+    //!\brief The name of the file if constructed from filename; the index is written next to it.
+    std::filesystem::path file_name{};
+    //!\brief Whether the BGZF stream records the offsets of its blocks for the index.
+    bool block_index_recorded{false};
+
     //!\brief Fill the header reference dictionary, with the given info.
     template <typename ref_ids_type_, typename ref_lengths_type>
     void initialise_header_information(ref_ids_type_ && ref_ids, ref_lengths_type && ref_lengths)
@@ -767,6 +920,8 @@ protected:
         assert(std::ranges::size(ref_ids) == std::ranges::size(ref_lengths));
 
         header_ptr = std::make_unique<alignment_file_header<ref_ids_type>>(std::forward<ref_ids_type_>(ref_ids));
+        header_ptr->ref_id_info.reserve(std::ranges::size(ref_lengths));
+        header_ptr->ref_dict.reserve(std::ranges::size(ref_lengths));
 
         for (int32_t idx = 0; idx < std::ranges::distance(ref_ids); ++idx)
         {
@@ -786,39 +941,165 @@ protected:
         }
     }
 
-    //!\brief Write record to format.
+    /*!\brief Write a seqan3::record or a tuple to the given stream.
+     * \param[in,out] stream The stream to write to; either the secondary stream or a buffer of a serialising thread.
+     * \param[in,out] f_variant The format used for writing; the threads use their own copy of the format.
+     * \param[in] r The record or tuple to write.
+     */
+    template <typename record_t>
+    void write_record(std::basic_ostream<stream_char_type> & stream, format_type & f_variant, record_t && r)
+    {
+        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
+        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
+
+        if constexpr (detail::is_type_specialisation_of_v<remove_cvref_t<record_t>, record>)
+        {
+            write_fields(stream,
+                         f_variant,
+                         detail::get_or<field::header_ptr>(r, nullptr),
+                         detail::get_or<field::seq>(r, std::string_view{}),
+                         detail::get_or<field::qual>(r, std::string_view{}),
+                         detail::get_or<field::id>(r, std::string_view{}),
+                         detail::get_or<field::offset>(r, 0u),
+                         detail::get_or<field::ref_seq>(r, std::string_view{}),
+                         detail::get_or<field::ref_id>(r, std::ignore),
+                         detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
+                         detail::get_or<field::alignment>(r, default_align_t{}),
+                         detail::get_or<field::cigar>(r, std::vector<cigar>{}),
+                         detail::get_or<field::flag>(r, sam_flag::none),
+                         detail::get_or<field::mapq>(r, 0u),
+                         detail::get_or<field::mate>(r, default_mate_t{}),
+                         detail::get_or<field::tags>(r, sam_tag_dictionary{}),
+                         detail::get_or<field::evalue>(r, 0u),
+                         detail::get_or<field::bit_score>(r, 0u));
+        }
+        else
+        {
+            // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
+            write_fields(stream,
+                         f_variant,
+                         detail::get_or<selected_field_ids::index_of(field::header_ptr)>(r, nullptr),
+                         detail::get_or<selected_field_ids::index_of(field::seq)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::qual)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::id)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::offset)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::ref_seq)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::ref_id)>(r, std::ignore),
+                         detail::get_or<selected_field_ids::index_of(field::ref_offset)>(r, std::optional<int32_t>{}),
+                         detail::get_or<selected_field_ids::index_of(field::alignment)>(r, default_align_t{}),
+                         detail::get_or<selected_field_ids::index_of(field::cigar)>(r, std::vector<cigar>{}),
+                         detail::get_or<selected_field_ids::index_of(field::flag)>(r, sam_flag::none),
+                         detail::get_or<selected_field_ids::index_of(field::mapq)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::mate)>(r, default_mate_t{}),
+                         detail::get_or<selected_field_ids::index_of(field::tags)>(r, sam_tag_dictionary{}),
+                         detail::get_or<selected_field_ids::index_of(field::evalue)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::bit_score)>(r, 0u));
+        }
+    }
+
+    //!\brief Write the fields of a record to the format.
     template <typename record_header_ptr_t, typename ...pack_type>
-    void write_record(record_header_ptr_t && record_header_ptr, pack_type && ...remainder)
+    void write_fields(std::basic_ostream<stream_char_type> & stream,
+                      format_type & f_variant,
+                      record_header_ptr_t && record_header_ptr,
+                      pack_type && ...remainder)
     {
-        static_assert((sizeof...(pack_type) == 15), "Wrong parameter list passed to write_record.");
+        static_assert((sizeof...(pack_type) == 15), "Wrong parameter list passed to write_fields.");
 
-        assert(!format.valueless_by_exception());
+        assert(!f_variant.valueless_by_exception());
+
+    #ifdef SEQAN3_HAS_ZLIB
+        // The index needs the offsets of all BGZF blocks, i.e. they must be recorded from the first record on.
+        if (options.bam_create_index && !block_index_recorded)
+        {
+            if (auto * bgzf_stream = dynamic_cast<contrib::basic_bgzf_ostream<stream_char_type> *>(&get_stream()))
+                bgzf_stream->rdbuf()->record_block_index();
+
+            block_index_recorded = true;
+        }
+    #endif // SEQAN3_HAS_ZLIB
 
         std::visit([&] (auto & f)
         {
             // use header from record if explicitly given, e.g. file_output = file_input
             if constexpr (!std::same_as<record_header_ptr_t, std::nullptr_t>)
             {
-                f.write_alignment_record(*secondary_stream,
+                f.write_alignment_record(stream,
                                          options,
                                          *record_header_ptr,
                                          std::forward<pack_type>(remainder)...);
             }
             else if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
             {
-                f.write_alignment_record(*secondary_stream,
+                f.write_alignment_record(stream,
                                          options,
                                          std::ignore,
                                          std::forward<pack_type>(remainder)...);
             }
             else
             {
-                f.write_alignment_record(*secondary_stream,
+                f.write_alignment_record(stream,
                                          options,
                                          *header_ptr,
                                          std::forward<pack_type>(remainder)...);
             }
-        }, format);
+        }, f_variant);
+    }
+
+    /*!\brief Write a range of records by serialising batches of records with multiple threads.
+     * \param[in] range The range of records.
+     *
+     * \details
+     *
+     * The first record is written by the calling thread, such that the header has been written before the format is
+     * copied for the batches. Every batch owns a copy of its records and of the format, because the formats keep
+     * buffers and state between the records.
+     */
+    template <typename rng_t>
+    void write_range_parallel(rng_t && range)
+    {
+        using record_batch_type = std::vector<value_type_t<rng_t>>;
+        constexpr size_t batch_size = 1024;
+
+        auto it = std::ranges::begin(range);
+        auto end = std::ranges::end(range);
+
+        if (it == end)
+            return;
+
+        push_back(*it);
+        ++it;
+
+        detail::parallel_record_writer writer{get_stream(), options.threads};
+        std::shared_ptr<record_batch_type> batch{};
+
+        auto schedule_batch = [&] ()
+        {
+            writer.push([this, batch = std::move(batch), f_variant = format] (std::ostream & stream) mutable
+            {
+                for (auto & record : *batch)
+                    write_record(stream, f_variant, record);
+            });
+        };
+
+        for (; it != end; ++it)
+        {
+            if (!batch)
+            {
+                batch = std::make_shared<record_batch_type>();
+                batch->reserve(batch_size);
+            }
+
+            batch->emplace_back(*it);
+
+            if (batch->size() == batch_size)
+                schedule_batch();
+        }
+
+        if (batch)
+            schedule_batch();
+
+        writer.finish();
     }
 
     //!\brief Befriend iterator so it can access the buffers.
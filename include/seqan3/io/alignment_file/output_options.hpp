@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <optional>
+
 #include <seqan3/core/platform.hpp>
+#include <seqan3/std/filesystem>
 
 namespace seqan3
 {
@@ -39,6 +42,75 @@ struct alignment_file_output_options
      * `false`.
      */
     bool sam_require_header = true;
+
+    /*!\brief Whether to build a seqan3::bam_index while writing a BAM file.
+     *
+     * \details
+     *
+     * The records must be written sorted by coordinate, otherwise writing fails with a seqan3::format_error.
+     * If the file was opened by filename, the index is written to `<filename>.bai` (or `<filename>.csi` if a
+     * reference is too long for the BAI format) by seqan3::alignment_file_output::close. The index can also be
+     * retrieved with seqan3::alignment_file_output::index.
+     */
+    bool bam_create_index = false;
+
+    /*!\brief Whether to sort the records of a BAM file by coordinate.
+     *
+     * \details
+     *
+     * The records are buffered until seqan3::alignment_file_output_options::bam_sort_memory_limit is reached, sorted
+     * by reference id and position, and written to temporary files. seqan3::alignment_file_output::close merges the
+     * temporary files into the BAM file, and the sorting in the header is set to "coordinate". This replaces sorting
+     * the file afterwards, e.g. with `samtools sort`, and can be combined with
+     * seqan3::alignment_file_output_options::bam_create_index. The option has no effect on SAM files.
+     * The option must be set before the first record is written.
+     *
+     * Most of the records are only written when the file is closed. Call seqan3::alignment_file_output::close
+     * yourself: the destructor calls it as well, but it must ignore errors, so a failure would leave an incomplete
+     * file without notice.
+     */
+    bool bam_sort_by_coordinate = false;
+
+    //!\brief The number of bytes of records that are kept in memory while sorting.
+    size_t bam_sort_memory_limit = size_t{768} << 20;
+
+    //!\brief The directory of the temporary files created while sorting; the system's temporary directory if empty.
+    std::filesystem::path bam_sort_tmp_directory{};
+
+    /*!\brief The number of threads used to serialise the records when a range of records is written.
+     *
+     * \details
+     *
+     * If set to a value greater than 1, assigning a range of records to the file (e.g. `fin | fout`) copies the
+     * records into batches, which are serialised by the given number of threads. The serialised batches are written
+     * in the order of the range, i.e. the output is identical to the sequential output. Records written with
+     * seqan3::alignment_file_output::push_back are always serialised by the calling thread, and so are all records if
+     * seqan3::alignment_file_output_options::bam_create_index or
+     * seqan3::alignment_file_output_options::bam_sort_by_coordinate is set. The latter sorts the buffered records with
+     * the given number of threads instead.
+     */
+    size_t threads = 1;
+
+    /*!\brief The compression level of files opened by filename with a compression extension, e.g. ".gz" or ".zst";
+     *        the default level of the compression if not set.
+     *
+     * \details
+     *
+     * BGZF (used for ".gz", ".bgzf" and ".bam" files) supports the levels 0 (no compression) to 9, or to 12 if
+     * libdeflate is available, and defaults to 1. zstd supports the levels 1 to 22 and negative levels for faster
+     * compression, and defaults to 3. For bzip2 the level selects the block size (1 to 9).
+     * The option must be set before the first record is written.
+     */
+    std::optional<int> compression_level{};
+
+    /*!\brief The number of threads compressing files opened by filename with a compression extension.
+     *
+     * \details
+     *
+     * If 0, seqan3::contrib::bgzf_thread_count threads are used for BGZF and seqan3::contrib::zstd_thread_count
+     * threads for zstd; bzip2 always uses a single thread. The option must be set before the first record is written.
+     */
+    size_t compression_threads = 0;
 };
 
 } // namespace seqan3
@@ -0,0 +1,267 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::reference_id_map.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/std/algorithm>
+
+namespace seqan3::detail
+{
+
+/*!\brief Maps reference ids to their position in seqan3::alignment_file_header::ref_ids().
+ * \ingroup alignment_file
+ * \tparam key_t       The type of the reference ids, usually a view on the id.
+ * \tparam hash_t      The hash function of the keys.
+ * \tparam key_equal_t The equality comparison of the keys.
+ *
+ * \details
+ *
+ * The map provides the subset of the std::unordered_map interface used for the reference dictionary of the
+ * alignment file header. The entries are stored contiguously in the order of their insertion, together with their
+ * hash values; an open-addressing table with linear probing stores the positions of the entries as 32 bit integers.
+ * A lookup compares keys only if their hash values are equal.
+ * Call reserve() before inserting many references to build the table in one go.
+ *
+ * Entries cannot be erased; iterators and references to entries are invalidated by insertions.
+ */
+template <typename key_t, typename hash_t = std::hash<key_t>, typename key_equal_t = view_equality_fn>
+class reference_id_map
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    using key_type = key_t;                                                    //!< The type of the keys.
+    using mapped_type = int32_t;                                               //!< The type of the positions.
+    using value_type = std::pair<key_type, mapped_type>;                       //!< The type of the entries.
+    using size_type = size_t;                                                  //!< The size type.
+    using iterator = typename std::vector<value_type>::iterator;              //!< The iterator type.
+    using const_iterator = typename std::vector<value_type>::const_iterator;  //!< The const iterator type.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    reference_id_map() = default;                                     //!< Defaulted.
+    reference_id_map(reference_id_map const &) = default;             //!< Defaulted.
+    reference_id_map(reference_id_map &&) = default;                  //!< Defaulted.
+    reference_id_map & operator=(reference_id_map const &) = default; //!< Defaulted.
+    reference_id_map & operator=(reference_id_map &&) = default;      //!< Defaulted.
+    ~reference_id_map() = default;                                    //!< Defaulted.
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first entry; the entries are in the order of their insertion.
+    iterator begin() noexcept
+    {
+        return entries.begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return entries.begin();
+    }
+
+    //!\brief Returns an iterator behind the last entry.
+    iterator end() noexcept
+    {
+        return entries.end();
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return entries.end();
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of entries.
+    size_type size() const noexcept
+    {
+        return entries.size();
+    }
+
+    //!\brief Checks whether the map is empty.
+    bool empty() const noexcept
+    {
+        return entries.empty();
+    }
+
+    /*!\brief Allocates memory for `count` entries, such that inserting them does not rebuild the table.
+     * \param[in] count The number of entries.
+     */
+    void reserve(size_type const count)
+    {
+        entries.reserve(count);
+        hashes.reserve(count);
+
+        if (size_type const slot_count = slot_count_for(count); slot_count > slots.size())
+            rebuild(slot_count);
+    }
+    //!\}
+
+    /*!\name Lookup and modifiers
+     * \{
+     */
+    /*!\brief Returns an iterator to the entry of `key` or end() if there is none.
+     * \param[in] key The key to search for.
+     */
+    iterator find(key_type const & key)
+    {
+        size_type const slot = find_slot(key, hasher(key));
+        return slots.empty() || slots[slot] == empty_slot ? end() : begin() + slots[slot];
+    }
+
+    //!\copydoc find()
+    const_iterator find(key_type const & key) const
+    {
+        size_type const slot = find_slot(key, hasher(key));
+        return slots.empty() || slots[slot] == empty_slot ? end() : begin() + slots[slot];
+    }
+
+    /*!\brief Returns 1 if the map contains `key` and 0 otherwise.
+     * \param[in] key The key to search for.
+     */
+    size_type count(key_type const & key) const
+    {
+        return find(key) != end();
+    }
+
+    /*!\brief Returns the position stored for `key`; inserts the key with position 0 if it is not contained.
+     * \param[in] key The key to search for.
+     */
+    mapped_type & operator[](key_type const & key)
+    {
+        size_t const hash = hasher(key);
+        size_type slot = find_slot(key, hash);
+
+        if (!slots.empty() && slots[slot] != empty_slot)
+            return entries[slots[slot]].second;
+
+        if (slot_count_for(entries.size() + 1) > slots.size())
+        {
+            rebuild(std::max<size_type>(2 * slots.size(), 16));
+            slot = find_slot(key, hash);
+        }
+
+        slots[slot] = static_cast<uint32_t>(entries.size());
+        entries.emplace_back(key, mapped_type{});
+        hashes.push_back(hash);
+        return entries.back().second;
+    }
+
+    //!\brief Removes all entries; keeps the allocated memory.
+    void clear() noexcept
+    {
+        entries.clear();
+        hashes.clear();
+        std::ranges::fill(slots, empty_slot);
+    }
+    //!\}
+
+private:
+    //!\brief Marks a slot of the table that does not refer to an entry.
+    static constexpr uint32_t empty_slot = std::numeric_limits<uint32_t>::max();
+
+    //!\brief Returns the size of the table for `count` entries; the table is at most half full.
+    static size_type slot_count_for(size_type const count) noexcept
+    {
+        return next_power_of_two(std::max<size_type>(2 * count, 2));
+    }
+
+    /*!\brief Returns the slot at which the search for a key with the hash value `hash` begins.
+     * \param[in] hash The hash value.
+     *
+     * \details
+     *
+     * The hash value is multiplied by 2^64 divided by the golden ratio and the upper bits of the product select the
+     * slot, such that all bits of the hash value contribute to the slot and not only the lowest ones.
+     */
+    size_type first_slot(size_t const hash) const noexcept
+    {
+        return static_cast<size_type>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    /*!\brief Returns the slot of `key`, or the empty slot at which `key` would be inserted.
+     * \param[in] key  The key to search for.
+     * \param[in] hash The hash value of `key`.
+     */
+    size_type find_slot(key_type const & key, size_t const hash) const
+    {
+        if (slots.empty())
+            return 0;
+
+        size_type const mask = slots.size() - 1;
+        size_type slot = first_slot(hash);
+
+        for (; slots[slot] != empty_slot; slot = (slot + 1) & mask)
+        {
+            uint32_t const entry = slots[slot];
+
+            if (hashes[entry] == hash && key_equal(entries[entry].first, key))
+                break;
+        }
+
+        return slot;
+    }
+
+    /*!\brief Rebuilds the table with `slot_count` slots from the stored hash values.
+     * \param[in] slot_count The number of slots; a power of two.
+     */
+    void rebuild(size_type const slot_count)
+    {
+        slots.assign(slot_count, empty_slot);
+        shift = 64 - count_trailing_zeros(static_cast<uint64_t>(slot_count));
+
+        size_type const mask = slot_count - 1;
+
+        for (uint32_t entry = 0; entry < entries.size(); ++entry)
+        {
+            size_type slot = first_slot(hashes[entry]);
+
+            while (slots[slot] != empty_slot)
+                slot = (slot + 1) & mask;
+
+            slots[slot] = entry;
+        }
+    }
+
+    //!\brief The entries in the order of their insertion.
+    std::vector<value_type> entries{};
+    //!\brief The hash values of the entries.
+    std::vector<size_t> hashes{};
+    //!\brief The open-addressing table of positions in `entries`; its size is zero or a power of two.
+    std::vector<uint32_t> slots{};
+    //!\brief The number of bits the multiplied hash value is shifted to select a slot.
+    int shift{64};
+
+    //!\brief The hash function.
+    hash_t hasher{};
+    //!\brief The equality comparison.
+    key_equal_t key_equal{};
+};
+
+} // namespace seqan3::detail
@@ -12,14 +12,28 @@
 
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
 #include <variant>
+#include <vector>
 
+#include <seqan3/core/bit_manipulation.hpp>
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/concept/core_language.hpp>
 #include <seqan3/core/type_traits/template_inspection.hpp>
+#include <seqan3/io/exception.hpp>
 #include <seqan3/range/container/small_string.hpp>
 #include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
 
 namespace seqan3::detail
 {
@@ -316,20 +330,290 @@ template <> struct sam_tag_type<"UQ"_tag> { using type = int32_t; };
  * for the tag "XZ" or learn more about an std::variant at
  * https://en.cppreference.com/w/cpp/utility/variant.
  *
+ * ### Memory layout
+ *
+ * The dictionary has the interface of an associative container, but stores the tags in a single vector sorted by
+ * the tag id. Records usually carry only a handful of tags, for which a binary search in contiguous memory is faster
+ * than a node-based map, and clearing the dictionary (e.g. when the next record is read) keeps the allocated memory.
+ *
+ * When reading BAM files, the dictionary only stores a copy of the binary representation of the tags. The tags are
+ * decoded on first access, such that tags which are never accessed cost no parsing and no allocations. Since
+ * decoding modifies the dictionary, concurrent (const) access to a dictionary that was not accessed before is not
+ * thread-safe, and a malformed record throws seqan3::format_error on first access instead of on reading.
+ *
  * \sa seqan3::sam_tag_type
  * \sa https://en.cppreference.com/w/cpp/utility/variant
  * \sa https://samtools.github.io/hts-specs/SAMv1.pdf
  * \sa https://samtools.github.io/hts-specs/SAMtags.pdf
  */
-class sam_tag_dictionary : public std::map<uint16_t, detail::sam_tag_variant>
+class sam_tag_dictionary
 {
-private:
-    //!\brief The base type.
-    using base_type = std::map<uint16_t, detail::sam_tag_variant>;
-
 public:
+    /*!\name Member types
+     * \{
+     */
     //!\brief The variant type defining all valid SAM tag field types.
     using variant_type = detail::sam_tag_variant;
+    //!\brief The type of the keys, i.e. of the tag ids.
+    using key_type = uint16_t;
+    //!\brief The type of the values.
+    using mapped_type = variant_type;
+    //!\brief The type of the elements, i.e. pairs of tag ids and values; like for std::map, the tag id is const.
+    using value_type = std::pair<key_type const, mapped_type>;
+    //!\brief The reference type.
+    using reference = value_type &;
+    //!\brief The const reference type.
+    using const_reference = value_type const &;
+    //!\brief The iterator type; iterates over the tags in ascending order of the tag id.
+    using iterator = typename std::vector<value_type>::iterator;
+    //!\brief The const iterator type.
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    //!\brief An unsigned integer type, usually std::size_t.
+    using size_type = size_t;
+    //!\brief A signed integer type, usually std::ptrdiff_t.
+    using difference_type = std::ptrdiff_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_tag_dictionary() = default;                                       //!< Defaulted.
+    sam_tag_dictionary(sam_tag_dictionary const &) = default;             //!< Defaulted.
+    sam_tag_dictionary(sam_tag_dictionary &&) = default;                  //!< Defaulted.
+    sam_tag_dictionary & operator=(sam_tag_dictionary &&) = default;      //!< Defaulted.
+    ~sam_tag_dictionary() = default;                                      //!< Defaulted.
+
+    /*!\brief Copy assignment; keeps the allocated memory.
+     *
+     * \details
+     *
+     * The elements are copy-constructed, because std::vector's copy assignment would assign to the const tag ids.
+     */
+    sam_tag_dictionary & operator=(sam_tag_dictionary const & other)
+    {
+        if (this != &other)
+        {
+            entries.clear();
+            entries.reserve(other.entries.size());
+
+            for (value_type const & element : other.entries)
+                entries.push_back(element);
+
+            binary = other.binary;
+        }
+
+        return *this;
+    }
+
+    /*!\brief Constructs the dictionary from a list of tags; for duplicate tags the first value is kept.
+     * \param[in] init The tags and their values.
+     */
+    sam_tag_dictionary(std::initializer_list<value_type> init)
+    {
+        for (value_type const & element : init)
+            insert(element);
+    }
+
+    /*!\brief Replaces the content by a list of tags; for duplicate tags the first value is kept.
+     * \param[in] init The tags and their values.
+     *
+     * \details
+     *
+     * In contrast to the copy and move assignment, the allocated memory is kept, e.g. for `dictionary = {}`.
+     */
+    sam_tag_dictionary & operator=(std::initializer_list<value_type> init)
+    {
+        clear();
+
+        for (value_type const & element : init)
+            insert(element);
+
+        return *this;
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the tag with the smallest id.
+    iterator begin()
+    {
+        decode();
+        return entries.begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const
+    {
+        decode();
+        return entries.begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    //!\brief Returns an iterator behind the last tag.
+    iterator end()
+    {
+        decode();
+        return entries.end();
+    }
+
+    //!\copydoc end()
+    const_iterator end() const
+    {
+        decode();
+        return entries.end();
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const
+    {
+        return end();
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of tags.
+    size_type size() const
+    {
+        decode();
+        return entries.size();
+    }
+
+    //!\brief Returns whether the dictionary contains no tags.
+    bool empty() const
+    {
+        return binary.empty() && entries.empty();
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    //!\brief Returns the value of a tag; inserts a default initialised value if the tag is not contained.
+    mapped_type & operator[](key_type const tag)
+    {
+        decode();
+        return find_or_insert(tag)->second;
+    }
+
+    /*!\brief Returns the value of a tag.
+     * \throws std::out_of_range If the dictionary does not contain the tag.
+     */
+    mapped_type & at(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == entries.end())
+            throw std::out_of_range{"The SAM tag dictionary does not contain the requested tag."};
+
+        return it->second;
+    }
+
+    //!\copydoc at()
+    mapped_type const & at(key_type const tag) const
+    {
+        const_iterator it = find(tag);
+
+        if (it == entries.end())
+            throw std::out_of_range{"The SAM tag dictionary does not contain the requested tag."};
+
+        return it->second;
+    }
+
+    //!\brief Returns an iterator to a tag or end() if the dictionary does not contain it.
+    iterator find(key_type const tag)
+    {
+        decode();
+        iterator it = lower_bound(tag);
+        return (it != entries.end() && it->first == tag) ? it : entries.end();
+    }
+
+    //!\copydoc find()
+    const_iterator find(key_type const tag) const
+    {
+        decode();
+        const_iterator it = lower_bound(tag);
+        return (it != entries.end() && it->first == tag) ? it : entries.end();
+    }
+
+    //!\brief Returns 1 if the dictionary contains the tag and 0 otherwise.
+    size_type count(key_type const tag) const
+    {
+        return find(tag) != end();
+    }
+
+    //!\brief Returns whether the dictionary contains the tag.
+    bool contains(key_type const tag) const
+    {
+        return find(tag) != end();
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all tags, but keeps the allocated memory.
+    void clear() noexcept
+    {
+        entries.clear();
+        binary.clear();
+    }
+
+    /*!\brief Inserts a tag if it is not contained yet.
+     * \returns An iterator to the tag and whether it was inserted.
+     */
+    std::pair<iterator, bool> insert(value_type const & element)
+    {
+        return emplace(element.first, element.second);
+    }
+
+    //!\copydoc insert()
+    std::pair<iterator, bool> insert(value_type && element)
+    {
+        return emplace(element.first, std::move(element.second));
+    }
+
+    /*!\brief Constructs the value of a tag in place if the tag is not contained yet.
+     * \returns An iterator to the tag and whether it was inserted.
+     */
+    template <typename ...arg_types>
+    std::pair<iterator, bool> emplace(key_type const tag, arg_types && ...args)
+    {
+        decode();
+        iterator it = lower_bound(tag);
+
+        if (it != entries.end() && it->first == tag)
+            return {it, false};
+
+        return {emplace_at(it, std::piecewise_construct, std::forward_as_tuple(tag),
+                           std::forward_as_tuple(std::forward<arg_types>(args)...)), true};
+    }
+
+    //!\brief Removes the tag the iterator points to and returns an iterator to the following tag.
+    iterator erase(const_iterator const position)
+    {
+        return erase_at(position);
+    }
+
+    //!\brief Removes a tag and returns the number of removed tags (0 or 1).
+    size_type erase(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == entries.end())
+            return 0;
+
+        erase_at(it);
+        return 1;
+    }
+    //!\}
 
     /*!\name Getter function for the seqan3::sam_tag_dictionary.
      *\brief Gets the value of known SAM tags by its correct type instead of the std::variant.
@@ -394,6 +678,298 @@ public:
         return std::get<sam_tag_type_t<tag>>(std::move((*this).at(tag)));
     }
     //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Checks whether both dictionaries contain the same tags with the same values.
+    friend bool operator==(sam_tag_dictionary const & lhs, sam_tag_dictionary const & rhs)
+    {
+        lhs.decode();
+        rhs.decode();
+        return lhs.entries == rhs.entries;
+    }
+
+    //!\brief Checks whether the dictionaries differ.
+    friend bool operator!=(sam_tag_dictionary const & lhs, sam_tag_dictionary const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Replaces the content by the tags of a BAM record, which are decoded on first access.
+     *        [public, but not documented as part of the API]
+     * \param[in] bytes The binary representation of all tags of the record.
+     *
+     * \details
+     *
+     * Only the bytes are copied, such that reading records whose tags are not accessed does not allocate memory
+     * besides the (reused) byte buffer. A seqan3::format_error for malformed tags is thrown on access.
+     */
+    template <std::ranges::input_range bytes_type>
+    void assign_bam_tags(bytes_type && bytes)
+    {
+        clear();
+        std::ranges::copy(bytes, std::back_inserter(binary));
+    }
+
+    /*!\brief Returns the binary representation of the tags if they were not decoded yet and an empty string
+     *        otherwise. [public, but not documented as part of the API]
+     *
+     * \details
+     *
+     * Allows writing BAM records that were read from a BAM file without decoding and encoding their tags.
+     */
+    std::string_view bam_tags() const noexcept
+    {
+        return binary;
+    }
+    //!\endcond
+
+private:
+    //!\brief Returns the first element whose tag is not smaller than the given tag.
+    iterator lower_bound(key_type const tag) const
+    {
+        return std::lower_bound(entries.begin(), entries.end(), tag, [] (value_type const & element, key_type key)
+        {
+            return element.first < key;
+        });
+    }
+
+    //!\brief Returns an iterator to the tag; inserts a default initialised value if the tag is not contained.
+    iterator find_or_insert(key_type const tag) const
+    {
+        iterator it = lower_bound(tag);
+
+        if (it == entries.end() || it->first != tag)
+            it = emplace_at(it, tag, mapped_type{});
+
+        return it;
+    }
+
+    /*!\brief Constructs an element in front of `position` and returns an iterator to it.
+     *
+     * \details
+     *
+     * Since the tag ids are const, the elements cannot be move-assigned as std::vector::emplace requires for an
+     * insertion in the middle. Instead, the elements are move-constructed into a second vector, which is kept with
+     * its memory for the next insertion.
+     */
+    template <typename ...arg_types>
+    iterator emplace_at(const_iterator const position, arg_types && ...args) const
+    {
+        size_t const index = position - entries.cbegin();
+
+        if (index == entries.size())
+        {
+            entries.emplace_back(std::forward<arg_types>(args)...);
+            return entries.begin() + index;
+        }
+
+        scratch.clear();
+        scratch.reserve(entries.size() + 1);
+        std::move(entries.begin(), entries.begin() + index, std::back_inserter(scratch));
+        scratch.emplace_back(std::forward<arg_types>(args)...);
+        std::move(entries.begin() + index, entries.end(), std::back_inserter(scratch));
+
+        entries.swap(scratch);
+        scratch.clear();
+        return entries.begin() + index;
+    }
+
+    //!\brief Removes the element at `position` and returns an iterator to the following element; see emplace_at().
+    iterator erase_at(const_iterator const position) const
+    {
+        size_t const index = position - entries.cbegin();
+
+        if (index + 1 == entries.size())
+        {
+            entries.pop_back();
+            return entries.end();
+        }
+
+        scratch.clear();
+        scratch.reserve(entries.size());
+        std::move(entries.begin(), entries.begin() + index, std::back_inserter(scratch));
+        std::move(entries.begin() + index + 1, entries.end(), std::back_inserter(scratch));
+
+        entries.swap(scratch);
+        scratch.clear();
+        return entries.begin() + index;
+    }
+
+    //!\brief Reads a little-endian number of the BAM representation.
+    template <typename number_type>
+    static number_type read_number(std::string_view & bytes)
+    {
+        if (bytes.size() < sizeof(number_type))
+            throw format_error{"The tags of the BAM record are truncated."};
+
+        number_type value{};
+        std::memcpy(&value, bytes.data(), sizeof(number_type));
+        bytes.remove_prefix(sizeof(number_type));
+
+        if constexpr (std::integral<number_type>)
+            return detail::to_little_endian(value);
+        else
+            return value;
+    }
+
+    //!\brief Reads an array of the BAM representation.
+    template <typename number_type>
+    static std::vector<number_type> read_array(std::string_view & bytes)
+    {
+        int32_t const count = read_number<int32_t>(bytes);
+
+        if (count < 0 || bytes.size() / sizeof(number_type) < static_cast<size_t>(count))
+            throw format_error{"The tags of the BAM record are truncated."};
+
+        std::vector<number_type> values(count);
+        for (number_type & value : values)
+            value = read_number<number_type>(bytes);
+
+        return values;
+    }
+
+    //!\brief Reads a NUL-terminated string of the BAM representation.
+    static std::string_view read_string(std::string_view & bytes)
+    {
+        size_t const length = bytes.find('\0');
+
+        if (length == std::string_view::npos)
+            throw format_error{"The tags of the BAM record are truncated."};
+
+        std::string_view const value = bytes.substr(0, length);
+        bytes.remove_prefix(length + 1);
+        return value;
+    }
+
+    /*!\brief Decodes the binary representation of a BAM record if it was not decoded yet.
+     * \throws seqan3::format_error If the representation is malformed.
+     *
+     * \details
+     *
+     * Every tag has the format "[TAG][TYPE_ID][VALUE]", where TAG is a two letter name and TYPE_ID one of [AcCsSiIfZHB]
+     * describing the type of the value. If TYPE_ID is 'B', the value is an array whose value type is given by the next
+     * character, one of [cCsSiIf], followed by the length of the array (int32_t) and the values. All integers are
+     * stored as int32_t, because the SAM format does not distinguish their sizes.
+     */
+    void decode() const
+    {
+        if (binary.empty())
+            return;
+
+        assert(entries.empty()); // assign_bam_tags() clears the dictionary and every access decodes first
+        scratch.clear();
+        std::string_view bytes{binary};
+
+        while (!bytes.empty())
+        {
+            if (bytes.size() < 3)
+                throw format_error{"The tags of the BAM record are truncated."};
+
+            key_type const tag = static_cast<key_type>(static_cast<uint8_t>(bytes[0]) << 8 |
+                                                       static_cast<uint8_t>(bytes[1]));
+            char const type_id = bytes[2];
+            bytes.remove_prefix(3);
+
+            scratch.emplace_back(tag, mapped_type{});
+            variant_type & value = scratch.back().second;
+
+            switch (type_id)
+            {
+                case 'A' : value = read_number<char>(bytes);                                break;
+                case 'c' : value = static_cast<int32_t>(read_number<int8_t>(bytes));        break;
+                case 'C' : value = static_cast<int32_t>(read_number<uint8_t>(bytes));       break;
+                case 's' : value = static_cast<int32_t>(read_number<int16_t>(bytes));       break;
+                case 'S' : value = static_cast<int32_t>(read_number<uint16_t>(bytes));      break;
+                case 'i' : value = read_number<int32_t>(bytes);                             break;
+                case 'I' : value = static_cast<int32_t>(read_number<uint32_t>(bytes));      break;
+                case 'f' : value = read_number<float>(bytes);                               break;
+                case 'Z' : value = std::string{read_string(bytes)};                         break;
+                case 'H' : value = std::string{read_string(bytes)};                         break; // hex string
+                case 'B' :
+                {
+                    if (bytes.empty())
+                        throw format_error{"The tags of the BAM record are truncated."};
+
+                    char const array_type_id = bytes[0];
+                    bytes.remove_prefix(1);
+
+                    switch (array_type_id)
+                    {
+                        case 'c' : value = read_array<int8_t>(bytes);   break;
+                        case 'C' : value = read_array<uint8_t>(bytes);  break;
+                        case 's' : value = read_array<int16_t>(bytes);  break;
+                        case 'S' : value = read_array<uint16_t>(bytes); break;
+                        case 'i' : value = read_array<int32_t>(bytes);  break;
+                        case 'I' : value = read_array<uint32_t>(bytes); break;
+                        case 'f' : value = read_array<float>(bytes);    break;
+                        default:
+                            throw format_error{std::string{"The first character in the numerical id of a SAM tag "
+                                               "must be one of [cCsSiIf] but '"} + array_type_id + "' was given."};
+                    }
+                    break;
+                }
+                default:
+                    throw format_error{std::string{"The second character in the numerical id of a SAM tag must be "
+                                       "one of [A,i,Z,H,B,f] but '"} + type_id + "' was given."};
+            }
+        }
+
+        sort_decoded_tags();
+        binary.clear();
+    }
+
+    /*!\brief Moves the decoded tags from `scratch` into `entries`, sorted by tag id.
+     *
+     * \details
+     *
+     * The tags are decoded in the order of the record and sorted once, instead of inserting every tag at its sorted
+     * position. Since the tag ids are const, the elements are not sorted in place, but their positions are, and the
+     * elements are move-constructed in that order. If a tag occurs more than once, the last value is kept, like when
+     * reading a SAM file.
+     */
+    void sort_decoded_tags() const
+    {
+        auto const not_increasing = [] (value_type const & lhs, value_type const & rhs)
+        {
+            return lhs.first >= rhs.first;
+        };
+
+        if (std::adjacent_find(scratch.begin(), scratch.end(), not_increasing) == scratch.end()) // usual case
+        {
+            entries.swap(scratch);
+            return;
+        }
+
+        std::vector<uint32_t> order(scratch.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [this] (uint32_t const lhs, uint32_t const rhs)
+        {
+            return scratch[lhs].first < scratch[rhs].first;
+        });
+
+        entries.reserve(scratch.size());
+
+        for (uint32_t const position : order)
+        {
+            if (!entries.empty() && entries.back().first == scratch[position].first)
+                entries.back().second = std::move(scratch[position].second);
+            else
+                entries.push_back(std::move(scratch[position]));
+        }
+
+        scratch.clear();
+    }
+
+    //!\brief The decoded tags, sorted by tag id; mutable, because the tags are decoded on first (const) access.
+    mutable std::vector<value_type> entries{};
+    //!\brief The buffer the elements are moved to when inserting or erasing in the middle, see emplace_at().
+    mutable std::vector<value_type> scratch{};
+    //!\brief The binary representation of the tags of a BAM record that was not decoded yet.
+    mutable std::string binary{};
 };
 
 } // namespace seqan3
@@ -23,6 +23,7 @@
  * | GZip       | `.gz`¹          | [zlib](https://zlib.net/)        | GNU-Zip, most common format on UNIX               |
  * | BGZF       | `.gz`, `.bgzf`² | [zlib](https://zlib.net/)        | [Blocked GZip](https://samtools.github.io/hts-specs/SAMv1.pdf), compatible extension to GZip, features parallelisation|
  * | BZip2      | `.bz2`          | [libbz2](https://www.bzip.org)   | Stronger compression than GZip, slower to compress |
+ * | ZStandard  | `.zst`          | [libzstd](https://facebook.github.io/zstd/) | Fast (de)compression at a ratio similar to GZip, features parallel compression |
  *
  * <small>¹ SeqAn always assumes GZip and does not handle pure `.Z`.<br>
  * ² Some file formats like `.bam` or `.bcf` are implicitly BGZF-compressed without showing this in the
@@ -33,6 +34,10 @@
  *
  * SeqAn file types apply compression/decompression streams transparently, i.e. if the given file-extension or
  * "magic-header" of a file suggest this, the respective stream is automatically (de-)compressed.
+ * The compression level and the number of compression threads of output files can be set in their options, e.g.
+ * seqan3::sequence_file_output_options::compression_level. If SeqAn is configured with `SEQAN3_LIBDEFLATE`, BGZF
+ * blocks are (de)compressed with [libdeflate](https://github.com/ebiggers/libdeflate) instead of zlib, which is
+ * considerably faster.
  *
  * The (de)compression stream wrappers are currently only used internally and not part of the API.
  *
@@ -0,0 +1,249 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::basic_async_istream.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A stream buffer that reads ahead from another stream on a background thread.
+ * \ingroup io
+ * \tparam char_t   The character type of the stream.
+ * \tparam traits_t The character traits of the stream.
+ *
+ * \details
+ *
+ * The background thread reads fixed-size blocks from the source stream into a pool of buffers, while the calling
+ * thread consumes the previously read blocks. If the source stream decompresses its input, the decompression thus
+ * runs concurrently to the parsing. With two buffers this is classical double buffering; more buffers compensate for
+ * fluctuations in the speed of the reader or the consumer.
+ *
+ * The waiting threads are blocked on a condition variable instead of spinning, because usually one of both sides
+ * is considerably slower and the other one would otherwise occupy a core while waiting.
+ * Exceptions thrown by the source stream are rethrown by underflow() after all blocks read before have been consumed.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_async_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+public:
+    //!\brief The integer type of the characters.
+    using int_type = typename traits_t::int_type;
+    //!\brief The type of the source stream.
+    using source_stream_type = std::basic_istream<char_t, traits_t>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_async_istreambuf() = delete;                                           //!< Deleted.
+    basic_async_istreambuf(basic_async_istreambuf const &) = delete;             //!< Deleted.
+    basic_async_istreambuf(basic_async_istreambuf &&) = delete;                  //!< Deleted.
+    basic_async_istreambuf & operator=(basic_async_istreambuf const &) = delete; //!< Deleted.
+    basic_async_istreambuf & operator=(basic_async_istreambuf &&) = delete;      //!< Deleted.
+
+    /*!\brief Takes ownership of the source stream and starts reading ahead.
+     * \param[in] source_      The stream to read from.
+     * \param[in] block_size_  The number of characters read at once.
+     * \param[in] block_count_ The number of blocks that are read ahead; at least 2.
+     */
+    basic_async_istreambuf(std::unique_ptr<source_stream_type> source_,
+                           size_t const block_size_,
+                           size_t const block_count_) :
+        source{std::move(source_)},
+        block_size{std::max<size_t>(block_size_, 1)}
+    {
+        // The buffers are not initialised, the reader overwrites them anyway.
+        for (size_t i = 0; i < std::max<size_t>(block_count_, 2); ++i)
+            free_blocks.push_back(block_type{std::unique_ptr<char_t[]>(new char_t[block_size]), 0});
+
+        this->setg(nullptr, nullptr, nullptr);
+        reader = std::thread{[this] () { read_ahead(); }};
+    }
+
+    //!\brief Stops the background thread.
+    ~basic_async_istreambuf()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stopped = true;
+        }
+        condition.notify_all();
+        reader.join();
+    }
+    //!\}
+
+    //!\brief Hands the consumed block back to the reader and waits for the next one.
+    int_type underflow() override
+    {
+        if (this->gptr() < this->egptr())
+            return traits_t::to_int_type(*this->gptr());
+
+        std::unique_lock lock{mutex};
+
+        if (current_block.data)
+        {
+            free_blocks.push_back(std::move(current_block));
+            condition.notify_all();
+        }
+
+        condition.wait(lock, [this] () { return !filled_blocks.empty() || finished; });
+
+        if (filled_blocks.empty()) // The reader has finished and all blocks are consumed.
+        {
+            current_block = block_type{};
+            this->setg(nullptr, nullptr, nullptr);
+
+            if (reader_exception)
+                std::rethrow_exception(std::exchange(reader_exception, nullptr));
+
+            return traits_t::eof();
+        }
+
+        current_block = std::move(filled_blocks.front());
+        filled_blocks.pop_front();
+        char_t * const begin = current_block.data.get();
+        this->setg(begin, begin, begin + current_block.size);
+
+        return traits_t::to_int_type(*this->gptr());
+    }
+
+private:
+    //!\brief A buffer of `block_size` characters.
+    struct block_type
+    {
+        //!\brief The characters; allocated without initialisation.
+        std::unique_ptr<char_t[]> data{};
+        //!\brief The number of characters read into the buffer.
+        size_t size{};
+    };
+
+    //!\brief The function executed by the background thread.
+    void read_ahead()
+    {
+        try
+        {
+            // Report errors of the source stream as exceptions instead of silently ending the stream.
+            source->exceptions(std::ios_base::badbit);
+
+            while (true)
+            {
+                block_type block{};
+
+                {
+                    std::unique_lock lock{mutex};
+                    condition.wait(lock, [this] () { return !free_blocks.empty() || stopped; });
+
+                    if (stopped)
+                        break;
+
+                    block = std::move(free_blocks.front());
+                    free_blocks.pop_front();
+                }
+
+                source->read(block.data.get(), block_size);
+                block.size = static_cast<size_t>(source->gcount());
+
+                if (block.size == 0) // End of the source stream.
+                    break;
+
+                {
+                    std::lock_guard lock{mutex};
+                    filled_blocks.push_back(std::move(block));
+                }
+                condition.notify_all();
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard lock{mutex};
+            reader_exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard lock{mutex};
+            finished = true;
+        }
+        condition.notify_all();
+    }
+
+    //!\brief The stream to read from; only accessed by the background thread.
+    std::unique_ptr<source_stream_type> source;
+    //!\brief The number of characters read at once.
+    size_t block_size;
+
+    //!\brief Guards the blocks and the flags.
+    std::mutex mutex{};
+    //!\brief Signals changes of the blocks and the flags.
+    std::condition_variable condition{};
+    //!\brief The blocks that can be filled by the reader.
+    std::deque<block_type> free_blocks{};
+    //!\brief The blocks that were read, but not yet consumed.
+    std::deque<block_type> filled_blocks{};
+    //!\brief The block that is currently consumed; the get area of the stream buffer.
+    block_type current_block{};
+    //!\brief The exception thrown by the source stream, if any.
+    std::exception_ptr reader_exception{};
+    //!\brief Whether the reader has reached the end of the source stream.
+    bool finished{false};
+    //!\brief Whether the stream buffer is destroyed.
+    bool stopped{false};
+
+    //!\brief The background thread.
+    std::thread reader{};
+};
+
+/*!\brief An input stream that reads ahead from another stream on a background thread.
+ * \ingroup io
+ * \tparam char_t   The character type of the stream.
+ * \tparam traits_t The character traits of the stream.
+ * \see seqan3::detail::basic_async_istreambuf
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_async_istream : public std::basic_istream<char_t, traits_t>
+{
+public:
+    //!\brief The default number of characters read at once.
+    static constexpr size_t default_block_size = 1ull << 20;
+    //!\brief The default number of blocks that are read ahead.
+    static constexpr size_t default_block_count = 4;
+
+    /*!\brief Takes ownership of the source stream and starts reading ahead.
+     * \param[in] source      The stream to read from.
+     * \param[in] block_size  The number of characters read at once.
+     * \param[in] block_count The number of blocks that are read ahead; at least 2.
+     */
+    explicit basic_async_istream(std::unique_ptr<std::basic_istream<char_t, traits_t>> source,
+                                 size_t const block_size = default_block_size,
+                                 size_t const block_count = default_block_count) :
+        std::basic_istream<char_t, traits_t>{nullptr},
+        buffer{std::move(source), block_size, block_count}
+    {
+        this->init(&buffer);
+    }
+
+private:
+    //!\brief The stream buffer.
+    basic_async_istreambuf<char_t, traits_t> buffer;
+};
+
+} // namespace seqan3::detail
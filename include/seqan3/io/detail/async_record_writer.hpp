@@ -0,0 +1,224 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::async_record_writer.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Writes records on a separate thread while the calling thread continues.
+ * \ingroup io
+ *
+ * \details
+ *
+ * Every record is handed over together with a function that writes it; the record must own everything the function
+ * needs, i.e. copies of the fields. The records are collected into batches, which are passed to the writer thread
+ * through a bounded queue and written in the order they were pushed. If the queue is full, push() blocks until the
+ * writer thread has caught up.
+ *
+ * The type of the records and of the write function is erased once per batch and not per record: a batch stores the
+ * records in a vector and a copy of the function. A record of a different type than the previous one starts a new
+ * batch.
+ *
+ * If writing a record throws, the writer thread stops writing and the exception is rethrown by the next call to
+ * push() or by finish(); the records that have not been written at that point are discarded. The destructor writes
+ * the remaining records, but discards exceptions.
+ */
+class async_record_writer
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    async_record_writer(async_record_writer const &) = delete;             //!< Deleted.
+    async_record_writer(async_record_writer &&) = delete;                  //!< Deleted.
+    async_record_writer & operator=(async_record_writer const &) = delete; //!< Deleted.
+    async_record_writer & operator=(async_record_writer &&) = delete;      //!< Deleted.
+
+    /*!\brief Constructs the writer and spawns the writer thread.
+     * \param[in] batch_size     The number of records that are handed to the writer thread at once.
+     * \param[in] queue_capacity The number of batches that may wait for the writer thread.
+     */
+    async_record_writer(size_t const batch_size = 256, size_t const queue_capacity = 8) :
+        batch_size{std::max<size_t>(batch_size, 1)},
+        batch_queue{std::max<size_t>(queue_capacity, 1)}
+    {
+        writer = std::thread{[this] ()
+        {
+            std::shared_ptr<batch_base> batch{};
+
+            while (batch_queue.wait_pop(batch) != contrib::queue_op_status::closed)
+            {
+                if (failed.load(std::memory_order_acquire))
+                    continue; // Drain the queue, so that push() cannot block forever.
+
+                try
+                {
+                    batch->write();
+                }
+                catch (...)
+                {
+                    exception = std::current_exception();
+                    failed.store(true, std::memory_order_release);
+                    batch_queue.close();
+                }
+            }
+        }};
+    }
+
+    //!\brief Writes the remaining records and waits for the writer thread; exceptions are discarded.
+    ~async_record_writer()
+    {
+        try
+        {
+            finish();
+        }
+        catch (...)
+        {}
+    }
+    //!\}
+
+    /*!\brief Schedules a record for writing.
+     * \tparam    record_t   The type of the record.
+     * \tparam    write_fn_t The type of the function; must be invocable with `record_t &`.
+     * \param[in] record     The record.
+     * \param[in] write      The function writing the record; copied once per batch.
+     * \throws Any exception thrown while writing a previous record.
+     */
+    template <typename record_t, typename write_fn_t>
+    void push(record_t record, write_fn_t const & write)
+    {
+        using typed_batch_t = typed_batch<record_t, write_fn_t>;
+
+        rethrow_if_failed();
+
+        if (batch_type != &batch_type_id<typed_batch_t>)
+        {
+            if (batch)
+                push_batch();
+
+            batch = std::make_shared<typed_batch_t>(write, batch_size);
+            batch_type = &batch_type_id<typed_batch_t>;
+        }
+
+        auto & records = static_cast<typed_batch_t &>(*batch).records;
+        records.push_back(std::move(record));
+
+        if (records.size() == batch_size)
+        {
+            push_batch();
+            rethrow_if_failed();
+        }
+    }
+
+    /*!\brief Waits until all scheduled records have been written and stops the writer thread.
+     * \throws Any exception thrown while writing a record.
+     */
+    void finish()
+    {
+        if (writer.joinable())
+        {
+            if (batch)
+                push_batch();
+
+            batch_queue.close();
+            writer.join();
+        }
+
+        rethrow_if_failed();
+    }
+
+private:
+    //!\brief The interface of a batch that hides the type of its records.
+    struct batch_base
+    {
+        //!\brief Virtual destructor.
+        virtual ~batch_base() = default;
+        //!\brief Writes all records of the batch.
+        virtual void write() = 0;
+    };
+
+    //!\brief A batch of records of the same type.
+    template <typename record_t, typename write_fn_t>
+    struct typed_batch final : batch_base
+    {
+        //!\brief Stores the function and allocates memory for `capacity` records.
+        typed_batch(write_fn_t const & write_fn, size_t const capacity) : write_fn{write_fn}
+        {
+            records.reserve(capacity);
+        }
+
+        //!\copydoc batch_base::write()
+        void write() override
+        {
+            for (record_t & record : records)
+                write_fn(record);
+        }
+
+        //!\brief The records.
+        std::vector<record_t> records{};
+        //!\brief The function writing a record.
+        write_fn_t write_fn;
+    };
+
+    //!\brief A distinct address for every batch type, used to recognise the type of the current batch.
+    template <typename batch_t>
+    static constexpr char batch_type_id{};
+
+    //!\brief Hands the current batch to the writer thread; blocks while the queue is full.
+    void push_batch()
+    {
+        // The queue is only closed by the writer thread after an exception, or by finish(). The batch is discarded
+        // in this case and the caller rethrows the exception.
+        batch_queue.wait_push(std::move(batch));
+        batch.reset();
+        batch_type = nullptr;
+    }
+
+    //!\brief Rethrows the exception of the writer thread, if any.
+    void rethrow_if_failed() const
+    {
+        if (failed.load(std::memory_order_acquire))
+            std::rethrow_exception(exception);
+    }
+
+    //!\brief The number of records handed to the writer thread at once.
+    size_t batch_size;
+    //!\brief The batch that is currently filled by the calling thread; shared, because the queue requires copyable
+    //!       values.
+    std::shared_ptr<batch_base> batch{};
+    //!\brief The address of seqan3::detail::async_record_writer::batch_type_id for the type of the current batch.
+    char const * batch_type{nullptr};
+
+    //!\brief The queue of batches waiting for the writer thread.
+    contrib::fixed_buffer_queue<std::shared_ptr<batch_base>> batch_queue;
+
+    //!\brief The first exception thrown by the writer thread; only valid if `failed` is set.
+    std::exception_ptr exception{};
+    //!\brief Whether the writer thread stopped because of an exception.
+    std::atomic<bool> failed{false};
+
+    //!\brief The writer thread.
+    std::thread writer{};
+};
+
+} // namespace seqan3::detail
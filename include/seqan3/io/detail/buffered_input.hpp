@@ -0,0 +1,202 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides helper functions to parse the buffered characters of a stream in bulk.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/io/stream/iterator.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The category of a character when being parsed with the seqan3::detail::char_conversion_table.
+ * \ingroup io
+ */
+enum struct char_category : uint8_t
+{
+    take,   //!< The character is converted and appended to the target range.
+    skip,   //!< The character is ignored, e.g. whitespace.
+    reject  //!< The character is not allowed at this position.
+};
+
+/*!\brief A lookup table that classifies and converts all characters in a single step.
+ * \ingroup io
+ * \tparam target_alphabet_t The alphabet to convert the characters to; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * Instead of evaluating a chain of predicates and the conversion for every single character, the table is built
+ * once and afterwards a single lookup determines whether a character is taken, skipped or rejected and which letter
+ * of the target alphabet it represents. This is used to convert whole spans of the stream buffer at once.
+ */
+template <writable_alphabet target_alphabet_t>
+class char_conversion_table
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    char_conversion_table() = default;                                          //!< Defaulted.
+    char_conversion_table(char_conversion_table const &) = default;             //!< Defaulted.
+    char_conversion_table(char_conversion_table &&) = default;                  //!< Defaulted.
+    char_conversion_table & operator=(char_conversion_table const &) = default; //!< Defaulted.
+    char_conversion_table & operator=(char_conversion_table &&) = default;      //!< Defaulted.
+    ~char_conversion_table() = default;                                         //!< Defaulted.
+
+    /*!\brief Builds the table from the given predicates.
+     * \tparam skip_predicate_t The type of the predicate for skipped characters.
+     * \tparam take_predicate_t The type of the predicate for taken characters.
+     * \param is_skipped A predicate that returns `true` for characters that are ignored.
+     * \param is_taken   A predicate that returns `true` for characters that are converted; only evaluated for
+     *                   characters that are not skipped.
+     *
+     * \details
+     *
+     * All characters that are neither skipped nor taken are rejected.
+     */
+    template <typename skip_predicate_t, typename take_predicate_t>
+    char_conversion_table(skip_predicate_t && is_skipped, take_predicate_t && is_taken)
+    {
+        for (size_t i = 0; i < table_size; ++i)
+        {
+            char const c = static_cast<char>(i);
+
+            if (is_skipped(c))
+            {
+                categories[i] = char_category::skip;
+            }
+            else if (is_taken(c))
+            {
+                categories[i] = char_category::take;
+                values[i] = assign_char_to(c, target_alphabet_t{});
+            }
+            else
+            {
+                categories[i] = char_category::reject;
+            }
+        }
+    }
+    //!\}
+
+    //!\brief Returns the category of the given character.
+    char_category category(char const c) const noexcept
+    {
+        return categories[static_cast<unsigned char>(c)];
+    }
+
+    //!\brief Returns the converted character; only meaningful if the category is seqan3::detail::char_category::take.
+    target_alphabet_t value(char const c) const noexcept
+    {
+        return values[static_cast<unsigned char>(c)];
+    }
+
+private:
+    //!\brief The number of different characters.
+    static constexpr size_t table_size = static_cast<size_t>(std::numeric_limits<unsigned char>::max()) + 1;
+
+    //!\brief The category of every character.
+    std::array<char_category, table_size> categories{};
+    //!\brief The converted value of every taken character.
+    std::array<target_alphabet_t, table_size> values{};
+};
+
+/*!\brief Passes the buffered characters chunk-wise to the given consumer until it stops or the input ends.
+ * \ingroup io
+ * \tparam traits_t The traits type of the stream.
+ * \tparam consumer_t The type of the consumer; must be invocable with a std::string_view and return the number of
+ *                    consumed characters.
+ * \param[in,out] it The stream iterator to advance.
+ * \param[in] consumer The function processing a chunk of characters.
+ * \returns `true` if the consumer stopped before the end of the input, `false` otherwise.
+ *
+ * \details
+ *
+ * Instead of advancing the iterator for every single character, the consumer gets the complete window of the stream
+ * buffer that is currently available. The consumer returns how many characters it has processed. If it consumed
+ * the entire chunk, the stream is rebuffered and the consumer is invoked with the next chunk. Otherwise, the
+ * iterator is placed on the first character that was not consumed and the function returns. Thus, the consumer must
+ * be able to continue its work across chunk boundaries.
+ */
+template <typename traits_t, typename consumer_t>
+inline bool consume_buffered(fast_istreambuf_iterator<char, traits_t> & it, consumer_t && consumer)
+{
+    for (std::string_view chunk = it.buffered_chars(); !chunk.empty(); chunk = it.buffered_chars())
+    {
+        size_t const consumed = consumer(chunk);
+        assert(consumed <= chunk.size());
+
+        it.skip_buffered(consumed);
+
+        if (consumed < chunk.size())
+            return true;
+    }
+
+    return false;
+}
+
+/*!\brief Returns the position of the first occurrence of any of the delimiters or the size of the chunk.
+ * \ingroup io
+ * \tparam delimiters The characters to search for.
+ * \param[in] chunk The characters to search in.
+ *
+ * \details
+ *
+ * Uses std::memchr for every delimiter, which is vectorised by the standard library.
+ */
+template <char ... delimiters>
+inline size_t find_first_delimiter(std::string_view const chunk) noexcept
+{
+    size_t position = chunk.size();
+
+    auto search = [&] (char const delimiter)
+    {
+        if (void const * hit = std::memchr(chunk.data(), delimiter, position); hit != nullptr)
+            position = static_cast<char const *>(hit) - chunk.data();
+    };
+
+    (search(delimiters), ...);
+
+    return position;
+}
+
+/*!\brief Passes the buffered characters chunk-wise to the given consumer until one of the delimiters is found.
+ * \ingroup io
+ * \tparam delimiters The characters that end the consumption.
+ * \tparam traits_t The traits type of the stream.
+ * \tparam consumer_t The type of the consumer; must be invocable with a std::string_view.
+ * \param[in,out] it The stream iterator to advance.
+ * \param[in] consumer The function processing a chunk of characters.
+ * \returns `true` if a delimiter was found, `false` if the end of the input was reached.
+ *
+ * \details
+ *
+ * The consumer is invoked with every chunk of characters before the delimiter. Afterwards, the iterator is placed
+ * on the delimiter.
+ */
+template <char ... delimiters, typename traits_t, typename consumer_t>
+inline bool consume_buffered_until(fast_istreambuf_iterator<char, traits_t> & it, consumer_t && consumer)
+{
+    return consume_buffered(it, [&] (std::string_view const chunk)
+    {
+        size_t const end = find_first_delimiter<delimiters...>(chunk);
+        consumer(chunk.substr(0, end));
+        return end;
+    });
+}
+
+} // namespace seqan3::detail
@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <fstream>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -25,7 +27,12 @@
     #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
     #include <seqan3/contrib/stream/gz_istream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_istream.hpp>
+#endif
+#include <seqan3/io/detail/async_istream.hpp>
 #include <seqan3/io/detail/magic_header.hpp>
+#include <seqan3/io/detail/mmap_istream.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/concepts>
 #include <seqan3/std/filesystem>
@@ -68,6 +75,34 @@ inline bool starts_with(ref_t && reference, query_t && query)
     }
 }
 
+/*!\brief Open the given file for reading, memory-mapped if possible.
+ * \tparam char_t The character type of the stream.
+ * \param[in] filename The file to open.
+ * \returns An owning pointer to the (device) stream; check good() to see whether the file could be opened.
+ *
+ * \details
+ *
+ * Regular files are memory-mapped (see seqan3::detail::basic_mmap_istream), so that the parsers read directly from
+ * the mapping without copying the file into a stream buffer. For everything else, e.g. pipes, character devices and
+ * files reporting size 0 (like empty files or files in procfs), or if the platform does not support memory-mapping,
+ * a std::basic_ifstream is returned.
+ */
+template <builtin_character char_t>
+inline std::unique_ptr<std::basic_istream<char_t>> make_primary_istream(std::filesystem::path const & filename)
+{
+#ifdef SEQAN3_HAS_MMAP
+    if constexpr (sizeof(char_t) == 1)
+    {
+        auto stream = std::make_unique<basic_mmap_istream<char_t>>(filename);
+
+        if (stream->is_open())
+            return stream;
+    }
+#endif // SEQAN3_HAS_MMAP
+
+    return std::make_unique<std::basic_ifstream<char_t>>(filename, std::ios_base::in | std::ios::binary);
+}
+
 /*!\brief Depending on the magic bytes of the given stream, return a decompression stream or forward the primary stream.
  * \param[in] primary_stream The primary (device) stream for reading.
  * \param[in,out] filename  The associated filename; compression extensions will be stripped. [optional]
@@ -132,7 +167,9 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
         if (contains_extension(gz_compression{}, extension) || contains_extension(bgzf_compression{}, extension))
             filename.replace_extension();
 
-        return {new contrib::basic_gz_istream<char_t>{primary_stream}, stream_deleter_default};
+        // Plain GZip cannot be decompressed in parallel, but it can be decompressed concurrently to the parsing.
+        return {new basic_async_istream<char_t>{std::make_unique<contrib::basic_gz_istream<char_t>>(primary_stream)},
+                stream_deleter_default};
     #else
         throw file_open_error{"Trying to read from a gzipped file, but no ZLIB available."};
     #endif
@@ -150,7 +187,14 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
     }
     else if (starts_with(magic_number, zstd_compression::magic_header)) // ZStd
     {
-        throw file_open_error{"Trying to read from a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        if (contains_extension(zstd_compression{}, extension))
+            filename.replace_extension();
+
+        return {new contrib::basic_zstd_istream<char_t>{primary_stream}, stream_deleter_default};
+    #else
+        throw file_open_error{"Trying to read from a zst'ed file, but no libzstd available."};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
@@ -12,7 +12,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 
@@ -24,26 +28,21 @@
     #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_ostream.hpp>
+#endif
 #include <seqan3/std/filesystem>
 
 namespace seqan3::detail
 {
 
-/*!\brief Depending on the given filename/extension, create a compression stream or just forward the primary stream.
- * \param[in] primary_stream The primary (uncompressed) stream for writing.
- * \param[in,out] filename  The associated filename; compression extensions will be stripped.
- * \returns A pointer to the secondary stream with defaulted or NOP'ed deleter.
+/*!\brief Strips a compression extension from the filename.
+ * \param[in,out] filename The associated filename; compression extensions will be stripped, except for ".bam".
+ * \returns The compression extension (including ".bam") or an empty string if the file is not compressed.
  * \throws seqan3::file_open_error If a compression-extension is used, but is not supported/available.
  */
-template <builtin_character char_t>
-inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream, std::filesystem::path & filename)
-    -> std::unique_ptr<std::basic_ostream<char_t>, std::function<void(std::basic_ostream<char_t>*)>>
+inline std::string strip_compression_extension(std::filesystem::path & filename)
 {
-    // don't assume ownership
-    constexpr auto stream_deleter_noop     = [] (std::basic_ostream<char_t> *) {};
-    // assume ownership
-    [[maybe_unused]] constexpr auto stream_deleter_default  = [] (std::basic_ostream<char_t> * ptr) { delete ptr; };
-
     std::string extension = filename.extension().string();
 
     if ((extension == ".gz") || (extension == ".bgzf") || (extension == ".bam"))
@@ -51,9 +50,6 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     #ifdef SEQAN3_HAS_ZLIB
         if (extension != ".bam") // remove extension except for bam
             filename.replace_extension("");
-
-        return {new contrib::basic_bgzf_ostream<char_t>{primary_stream},
-                stream_deleter_default};
     #else
         throw file_open_error{"Trying to write a gzipped file, but no ZLIB available."};
     #endif
@@ -62,17 +58,92 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     {
     #ifdef SEQAN3_HAS_BZIP2
         filename.replace_extension("");
-        return {new contrib::basic_bz2_ostream<char_t>{primary_stream}, stream_deleter_default};
     #else
         throw file_open_error{"Trying to write a bzipped file, but no libbz2 available."};
     #endif
     }
     else if (extension == ".zst")
     {
-        throw file_open_error{"Trying to write a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        filename.replace_extension("");
+    #else
+        throw file_open_error{"Trying to write a zst'ed file, but no libzstd available."};
+    #endif
+    }
+    else
+    {
+        extension.clear();
+    }
+
+    return extension;
+}
+
+/*!\brief Depending on the given compression extension, create a compression stream or just forward the primary stream.
+ * \param[in] primary_stream    The primary (uncompressed) stream for writing.
+ * \param[in] extension         The compression extension as returned by seqan3::detail::strip_compression_extension.
+ * \param[in] compression_level The compression level; the default level of the compression if not set.
+ * \param[in] thread_count      The number of compression threads; the default number of the compression if 0.
+ * \returns A pointer to the secondary stream with defaulted or NOP'ed deleter.
+ *
+ * \details
+ *
+ * The compression level of BGZF ranges from 0 to 9 (12 if libdeflate is available), the one of zstd from 1 to 22
+ * (negative levels are faster). For bzip2 the level is the block size in 100k (1 to 9), and only one thread is used.
+ */
+template <builtin_character char_t>
+inline auto make_compression_ostream(std::basic_ostream<char_t> & primary_stream,
+                                     std::string const & extension,
+                                     [[maybe_unused]] std::optional<int> const compression_level = std::nullopt,
+                                     [[maybe_unused]] size_t const thread_count = 0)
+    -> std::unique_ptr<std::basic_ostream<char_t>, std::function<void(std::basic_ostream<char_t>*)>>
+{
+    // don't assume ownership
+    constexpr auto stream_deleter_noop     = [] (std::basic_ostream<char_t> *) {};
+    // assume ownership
+    [[maybe_unused]] constexpr auto stream_deleter_default  = [] (std::basic_ostream<char_t> * ptr) { delete ptr; };
+
+    if ((extension == ".gz") || (extension == ".bgzf") || (extension == ".bam"))
+    {
+    #ifdef SEQAN3_HAS_ZLIB
+        return {new contrib::basic_bgzf_ostream<char_t>{primary_stream,
+                                                        compression_level.value_or(
+                                                            contrib::bgzf_default_compression_level),
+                                                        thread_count ? thread_count : contrib::bgzf_thread_count},
+                stream_deleter_default};
+    #endif
+    }
+    else if (extension == ".bz2")
+    {
+    #ifdef SEQAN3_HAS_BZIP2
+        size_t const block_size_100k = std::clamp(compression_level.value_or(9), 1, 9);
+        return {new contrib::basic_bz2_ostream<char_t>{primary_stream, block_size_100k}, stream_deleter_default};
+    #endif
+    }
+    else if (extension == ".zst")
+    {
+    #ifdef SEQAN3_HAS_ZSTD
+        return {new contrib::basic_zstd_ostream<char_t>{primary_stream,
+                                                        compression_level.value_or(
+                                                            contrib::zstd_default_compression_level),
+                                                        thread_count ? thread_count : contrib::zstd_thread_count},
+                stream_deleter_default};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
 }
 
+/*!\brief Depending on the given filename/extension, create a compression stream or just forward the primary stream.
+ * \param[in] primary_stream The primary (uncompressed) stream for writing.
+ * \param[in,out] filename  The associated filename; compression extensions will be stripped.
+ * \returns A pointer to the secondary stream with defaulted or NOP'ed deleter.
+ * \throws seqan3::file_open_error If a compression-extension is used, but is not supported/available.
+ */
+template <builtin_character char_t>
+inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream, std::filesystem::path & filename)
+    -> std::unique_ptr<std::basic_ostream<char_t>, std::function<void(std::basic_ostream<char_t>*)>>
+{
+    return make_compression_ostream(primary_stream, strip_compression_extension(filename));
+}
+
 } // namespace seqan3::detail
@@ -0,0 +1,206 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::basic_mmap_istream.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string_view>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/filesystem>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    //!\brief Whether files can be memory-mapped on this platform.
+    #define SEQAN3_HAS_MMAP 1
+#endif
+
+namespace seqan3::detail
+{
+
+#ifdef SEQAN3_HAS_MMAP
+/*!\brief A read-only stream buffer whose get area is a memory-mapped file.
+ * \ingroup io
+ * \tparam char_t   The character type of the stream; must have the size of a byte.
+ * \tparam traits_t The character traits of the stream.
+ *
+ * \details
+ *
+ * The complete file is mapped on construction and advised to be read sequentially, so the kernel reads ahead and
+ * the parsers read the characters directly from the page cache instead of copying them into a stream buffer first.
+ * The whole file is available as contiguous range via view(). Seeking moves the read position within the mapping.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_mmap_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1, "Only files of single-byte characters can be memory-mapped.");
+
+public:
+    //!\brief The position type.
+    using pos_type = typename traits_t::pos_type;
+    //!\brief The offset type.
+    using off_type = typename traits_t::off_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_mmap_istreambuf() = delete;                                          //!< Deleted.
+    basic_mmap_istreambuf(basic_mmap_istreambuf const &) = delete;             //!< Deleted.
+    basic_mmap_istreambuf(basic_mmap_istreambuf &&) = delete;                  //!< Deleted.
+    basic_mmap_istreambuf & operator=(basic_mmap_istreambuf const &) = delete; //!< Deleted.
+    basic_mmap_istreambuf & operator=(basic_mmap_istreambuf &&) = delete;      //!< Deleted.
+
+    /*!\brief Maps the given file.
+     * \param[in] filename The file to map.
+     *
+     * \details
+     *
+     * Check is_open() afterwards; the mapping fails e.g. if the file does not exist, is not a regular file or has
+     * size 0.
+     */
+    explicit basic_mmap_istreambuf(std::filesystem::path const & filename)
+    {
+        this->setg(nullptr, nullptr, nullptr);
+
+        int const fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        // Files of size 0 are not mapped: they cannot be mapped, and files in e.g. procfs, sysfs or some FUSE file
+        // systems report size 0 although they have content. Such files are read through std::ifstream instead.
+        struct stat file_status{};
+        if (::fstat(fd, &file_status) == 0 && S_ISREG(file_status.st_mode) && file_status.st_size > 0)
+        {
+            void * const address = ::mmap(nullptr, file_status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (address != MAP_FAILED)
+            {
+                length = file_status.st_size;
+                opened = true;
+                ::madvise(address, length, MADV_SEQUENTIAL);
+                data = static_cast<char_t *>(address);
+                this->setg(data, data, data + length);
+            }
+        }
+
+        ::close(fd); // the mapping stays valid after closing the file
+    }
+
+    //!\brief Unmaps the file.
+    ~basic_mmap_istreambuf()
+    {
+        if (data != nullptr)
+            ::munmap(data, length);
+    }
+    //!\}
+
+    //!\brief Whether the file was mapped successfully.
+    bool is_open() const noexcept
+    {
+        return opened;
+    }
+
+    //!\brief Returns the complete file.
+    std::basic_string_view<char_t, traits_t> view() const noexcept
+    {
+        return {data, length};
+    }
+
+protected:
+    //!\brief Moves the read position relative to the beginning, the current position or the end of the file.
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        off_type position = off;
+
+        if (dir == std::ios_base::cur)
+            position += this->gptr() - this->eback();
+        else if (dir == std::ios_base::end)
+            position += length;
+
+        if (position < 0 || position > static_cast<off_type>(length))
+            return pos_type(off_type(-1));
+
+        this->setg(data, data + position, data + length);
+        return pos_type(position);
+    }
+
+    //!\brief Moves the read position to the given position.
+    pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+
+    //!\brief Returns the number of characters that can be read without blocking, i.e. the rest of the file.
+    std::streamsize showmanyc() override
+    {
+        return (this->gptr() < this->egptr()) ? this->egptr() - this->gptr() : -1;
+    }
+
+private:
+    //!\brief The beginning of the mapping.
+    char_t * data{nullptr};
+    //!\brief The size of the file.
+    size_t length{0};
+    //!\brief Whether the file was mapped successfully.
+    bool opened{false};
+};
+
+/*!\brief An input stream that reads a memory-mapped file.
+ * \ingroup io
+ * \tparam char_t   The character type of the stream; must have the size of a byte.
+ * \tparam traits_t The character traits of the stream.
+ * \see seqan3::detail::basic_mmap_istreambuf
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_mmap_istream : public std::basic_istream<char_t, traits_t>
+{
+public:
+    /*!\brief Maps the given file; sets the failbit if the mapping fails.
+     * \param[in] filename The file to map.
+     */
+    explicit basic_mmap_istream(std::filesystem::path const & filename) :
+        std::basic_istream<char_t, traits_t>{nullptr},
+        buffer{filename}
+    {
+        this->init(&buffer);
+
+        if (!buffer.is_open())
+            this->setstate(std::ios_base::failbit);
+    }
+
+    //!\brief Whether the file was mapped successfully.
+    bool is_open() const noexcept
+    {
+        return buffer.is_open();
+    }
+
+    //!\brief Returns the complete file.
+    std::basic_string_view<char_t, traits_t> view() const noexcept
+    {
+        return buffer.view();
+    }
+
+private:
+    //!\brief The stream buffer.
+    basic_mmap_istreambuf<char_t, traits_t> buffer;
+};
+#endif // SEQAN3_HAS_MMAP
+
+} // namespace seqan3::detail
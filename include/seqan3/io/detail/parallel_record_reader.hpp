@@ -0,0 +1,330 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::parallel_record_reader.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the position of the last FASTA record that begins after the first character of the buffer.
+ * \ingroup io
+ * \param[in] buffer The characters to search in.
+ * \returns The position of the '>' or ';' that begins the last record or std::string_view::npos if no record begins
+ *          within the buffer after its first character.
+ */
+inline size_t find_last_fasta_record_start(std::string_view const buffer) noexcept
+{
+    // The record start must be followed by at least one character to be recognised.
+    for (size_t end = buffer.size() - std::min<size_t>(buffer.size(), 1); end > 0;)
+    {
+        size_t const line_end = buffer.rfind('\n', end - 1);
+
+        if (line_end == std::string_view::npos)
+            break;
+
+        if (buffer[line_end + 1] == '>' || buffer[line_end + 1] == ';')
+            return line_end + 1;
+
+        end = line_end;
+    }
+
+    return std::string_view::npos;
+}
+
+/*!\brief Returns the position of the last FASTQ record that begins after the first character of the buffer.
+ * \ingroup io
+ * \param[in] buffer The characters to search in.
+ * \returns The position of the '@' that begins the last record or std::string_view::npos if no record begins
+ *          within the buffer after its first character.
+ *
+ * \details
+ *
+ * Since a quality line may also begin with '@', a line beginning with '@' is only considered to be the ID line of a
+ * record if the line after the next one begins with '+'. If the quality line begins with '@', the line after the
+ * next one is the sequence of the following record, which never begins with '+'. Thus, only records whose sequence
+ * is stored on a single line are used as split points.
+ *
+ * This only holds if every record is stored on four lines. If the qualities are wrapped, a quality line beginning
+ * with '@' may be followed by another quality line and a quality line beginning with '+', and it is mistaken for a
+ * record start. Since this cannot be told apart without parsing the file from its beginning, FASTQ files with
+ * wrapped records must be parsed by a single thread.
+ */
+inline size_t find_last_fastq_record_start(std::string_view const buffer) noexcept
+{
+    for (size_t end = buffer.size() - std::min<size_t>(buffer.size(), 1); end > 0;)
+    {
+        size_t const line_end = buffer.rfind('\n', end - 1);
+
+        if (line_end == std::string_view::npos)
+            break;
+
+        if (buffer[line_end + 1] == '@')
+        {
+            size_t const id_line_end = buffer.find('\n', line_end + 1);
+            size_t const sequence_line_end = (id_line_end == std::string_view::npos)
+                                           ? std::string_view::npos
+                                           : buffer.find('\n', id_line_end + 1);
+
+            if (sequence_line_end != std::string_view::npos &&
+                sequence_line_end + 1 < buffer.size() &&
+                buffer[sequence_line_end + 1] == '+')
+            {
+                return line_end + 1;
+            }
+        }
+
+        end = line_end;
+    }
+
+    return std::string_view::npos;
+}
+
+/*!\brief A read-only stream buffer whose get area is a range of characters it does not own.
+ * \ingroup io
+ *
+ * \details
+ *
+ * Used to parse a chunk directly from its buffer; in contrast to std::istringstream, the characters are not copied.
+ * The characters must stay valid as long as the stream buffer is used.
+ */
+class span_istreambuf : public std::streambuf
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    span_istreambuf() = delete;                                    //!< Deleted.
+    span_istreambuf(span_istreambuf const &) = delete;             //!< Deleted.
+    span_istreambuf(span_istreambuf &&) = delete;                  //!< Deleted.
+    span_istreambuf & operator=(span_istreambuf const &) = delete; //!< Deleted.
+    span_istreambuf & operator=(span_istreambuf &&) = delete;      //!< Deleted.
+    ~span_istreambuf() override = default;                         //!< Defaulted.
+
+    /*!\brief Constructs the stream buffer from the characters in [begin, end).
+     * \param[in] begin The first character.
+     * \param[in] end   Behind the last character.
+     */
+    span_istreambuf(char * const begin, char * const end)
+    {
+        this->setg(begin, begin, end);
+    }
+    //!\}
+};
+
+/*!\brief Reads records from a stream by parsing chunks of the stream with multiple threads.
+ * \ingroup io
+ * \tparam record_t The type of the records.
+ *
+ * \details
+ *
+ * The calling thread reads the stream in chunks of a fixed size and cuts every chunk behind the last complete
+ * record, such that every chunk contains only complete records. The remainder is prepended to the next chunk.
+ * The records are parsed directly from the chunk buffers through a seqan3::detail::span_istreambuf.
+ * The chunks are parsed into batches of records by a pool of worker threads. To keep the memory bounded, at most
+ * two chunks per thread are processed or waiting at the same time. The batches are handed out in the order of the
+ * chunks and thus the records are returned in the same order as they are stored in the stream.
+ * If parsing a chunk fails, the exception is rethrown when the respective record would have been returned.
+ */
+template <typename record_t>
+class parallel_record_reader
+{
+public:
+    //!\brief The type of a batch of records parsed from a single chunk.
+    using record_batch_type = std::vector<record_t>;
+    //!\brief The type of the function that finds the last record start in a buffer.
+    using split_function_type = std::function<size_t(std::string_view)>;
+    //!\brief The type of the function that parses all records from the given stream into the batch.
+    using parse_function_type = std::function<void(std::istream &, record_batch_type &)>;
+
+    //!\brief The default number of bytes read from the stream at once.
+    static constexpr size_t default_chunk_size = 1ull << 22;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parallel_record_reader() = delete;                                           //!< Deleted.
+    parallel_record_reader(parallel_record_reader const &) = delete;             //!< Deleted.
+    parallel_record_reader(parallel_record_reader &&) = delete;                  //!< Deleted.
+    parallel_record_reader & operator=(parallel_record_reader const &) = delete; //!< Deleted.
+    parallel_record_reader & operator=(parallel_record_reader &&) = delete;      //!< Deleted.
+
+    /*!\brief Constructs the reader and spawns the worker threads.
+     * \param[in] stream The stream to read from.
+     * \param[in] thread_count The number of worker threads; must be greater than 0.
+     * \param[in] split_function The function returning the last record start within a buffer.
+     * \param[in] parse_function The function parsing all records of a chunk.
+     * \param[in] chunk_size The number of bytes read from the stream at once.
+     */
+    parallel_record_reader(std::istream & stream,
+                           size_t const thread_count,
+                           split_function_type split_function,
+                           parse_function_type parse_function,
+                           size_t const chunk_size = default_chunk_size) :
+        stream{stream},
+        split_function{std::move(split_function)},
+        parse_function{std::move(parse_function)},
+        chunk_size{std::max<size_t>(chunk_size, 1)},
+        max_pending_chunks{2 * std::max<size_t>(thread_count, 1)},
+        task_queue{max_pending_chunks}
+    {
+        for (size_t i = 0; i < std::max<size_t>(thread_count, 1); ++i)
+        {
+            workers.emplace_back([this] ()
+            {
+                std::function<void()> task{};
+                while (task_queue.wait_pop(task) != contrib::queue_op_status::closed)
+                    task();
+            });
+        }
+    }
+
+    //!\brief Waits for the worker threads to finish.
+    ~parallel_record_reader()
+    {
+        task_queue.close();
+
+        for (auto & worker : workers)
+            if (worker.joinable())
+                worker.join();
+    }
+    //!\}
+
+    /*!\brief Moves the next record into the given record.
+     * \param[out] record The record to be overwritten.
+     * \returns `true` if a record was read, `false` at the end of the stream.
+     * \throws Any exception thrown while parsing the chunk of the record.
+     */
+    bool next(record_t & record)
+    {
+        while (batch_position == current_batch.size())
+        {
+            fill_pipeline();
+
+            if (pending_batches.empty())
+                return false;
+
+            current_batch = pending_batches.front().get(); // Rethrows exceptions of the parser.
+            pending_batches.pop_front();
+            batch_position = 0;
+        }
+
+        record = std::move(current_batch[batch_position++]);
+        return true;
+    }
+
+private:
+    //!\brief Reads chunks from the stream and schedules them for parsing until enough chunks are pending.
+    void fill_pipeline()
+    {
+        while (pending_batches.size() < max_pending_chunks && !end_of_stream)
+        {
+            std::string chunk = read_chunk();
+
+            if (chunk.empty())
+                break;
+
+            auto promise = std::make_shared<std::promise<record_batch_type>>();
+            pending_batches.push_back(promise->get_future());
+
+            task_queue.wait_push([promise, chunk = std::move(chunk), parse = parse_function] () mutable
+            {
+                try
+                {
+                    span_istreambuf chunk_buffer{chunk.data(), chunk.data() + chunk.size()};
+                    std::istream chunk_stream{&chunk_buffer};
+                    record_batch_type batch{};
+                    parse(chunk_stream, batch);
+                    promise->set_value(std::move(batch));
+                }
+                catch (...)
+                {
+                    promise->set_exception(std::current_exception());
+                }
+            });
+        }
+    }
+
+    //!\brief Reads the next chunk that ends behind the last complete record.
+    std::string read_chunk()
+    {
+        std::string buffer = std::move(remainder);
+        remainder.clear();
+
+        while (true)
+        {
+            size_t const old_size = buffer.size();
+            buffer.resize(old_size + chunk_size);
+            stream.read(buffer.data() + old_size, chunk_size);
+            size_t const read_size = static_cast<size_t>(stream.gcount());
+            buffer.resize(old_size + read_size);
+
+            if (read_size < chunk_size) // The whole stream has been read.
+            {
+                end_of_stream = true;
+                return buffer;
+            }
+
+            // Cut the chunk before the last record, which might be incomplete. If no record begins within the buffer,
+            // the record is bigger than the chunk and more characters are read.
+            if (size_t const split_position = split_function(buffer); split_position != std::string_view::npos)
+            {
+                remainder.assign(buffer, split_position);
+                buffer.resize(split_position);
+                return buffer;
+            }
+        }
+    }
+
+    //!\brief The stream to read from.
+    std::istream & stream;
+    //!\brief The function returning the last record start within a buffer.
+    split_function_type split_function;
+    //!\brief The function parsing all records of a chunk.
+    parse_function_type parse_function;
+    //!\brief The number of bytes read from the stream at once.
+    size_t chunk_size;
+    //!\brief The maximal number of chunks that are parsed or waiting at the same time.
+    size_t max_pending_chunks;
+    //!\brief Whether the whole stream has been read.
+    bool end_of_stream{false};
+    //!\brief The beginning of an incomplete record at the end of the last chunk.
+    std::string remainder{};
+
+    //!\brief The batches in the order of their chunks.
+    std::deque<std::future<record_batch_type>> pending_batches{};
+    //!\brief The batch the records are currently taken from.
+    record_batch_type current_batch{};
+    //!\brief The position of the next record within the current batch.
+    size_t batch_position{0};
+
+    //!\brief The queue of parse tasks.
+    contrib::fixed_buffer_queue<std::function<void()>> task_queue;
+    //!\brief The worker threads.
+    std::vector<std::thread> workers{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,155 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::parallel_record_writer.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Writes batches of records to a stream by serialising them with multiple threads.
+ * \ingroup io
+ *
+ * \details
+ *
+ * Every batch is handed over as a function that writes the records of the batch to the given stream. The functions
+ * are executed by a pool of worker threads, each on its own string stream, and the resulting buffers are written to
+ * the output stream by the calling thread in the order the batches were pushed. To keep the memory bounded, at most
+ * two batches per thread are serialised or waiting at the same time; push() blocks until the oldest batch has been
+ * written otherwise. If serialising a batch fails, the exception is rethrown when the batch would have been written.
+ */
+class parallel_record_writer
+{
+public:
+    //!\brief The type of the function that writes all records of a batch to the given stream.
+    using serialise_function_type = std::function<void(std::ostream &)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parallel_record_writer() = delete;                                           //!< Deleted.
+    parallel_record_writer(parallel_record_writer const &) = delete;             //!< Deleted.
+    parallel_record_writer(parallel_record_writer &&) = delete;                  //!< Deleted.
+    parallel_record_writer & operator=(parallel_record_writer const &) = delete; //!< Deleted.
+    parallel_record_writer & operator=(parallel_record_writer &&) = delete;      //!< Deleted.
+
+    /*!\brief Constructs the writer and spawns the worker threads.
+     * \param[in] stream The stream to write to.
+     * \param[in] thread_count The number of worker threads; must be greater than 0.
+     */
+    parallel_record_writer(std::ostream & stream, size_t const thread_count) :
+        stream{stream},
+        max_pending_batches{2 * std::max<size_t>(thread_count, 1)},
+        task_queue{max_pending_batches}
+    {
+        for (size_t i = 0; i < std::max<size_t>(thread_count, 1); ++i)
+        {
+            workers.emplace_back([this] ()
+            {
+                std::function<void()> task{};
+                while (task_queue.wait_pop(task) != contrib::queue_op_status::closed)
+                    task();
+            });
+        }
+    }
+
+    /*!\brief Waits for the worker threads to finish.
+     *
+     * \details
+     *
+     * Batches that have not been written by finish() are discarded.
+     */
+    ~parallel_record_writer()
+    {
+        task_queue.close();
+
+        for (auto & worker : workers)
+            if (worker.joinable())
+                worker.join();
+    }
+    //!\}
+
+    /*!\brief Schedules a batch for serialisation.
+     * \param[in] serialise The function writing all records of the batch to the given stream.
+     * \throws Any exception thrown while serialising the oldest batch, if it had to be written to make room.
+     */
+    void push(serialise_function_type serialise)
+    {
+        while (pending_buffers.size() >= max_pending_batches)
+            write_front();
+
+        auto promise = std::make_shared<std::promise<std::string>>();
+        pending_buffers.push_back(promise->get_future());
+
+        task_queue.wait_push([promise, serialise = std::move(serialise)] ()
+        {
+            try
+            {
+                std::ostringstream buffer_stream{};
+                serialise(buffer_stream);
+                promise->set_value(std::move(buffer_stream).str());
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        });
+    }
+
+    /*!\brief Waits for all scheduled batches and writes them to the stream.
+     * \throws Any exception thrown while serialising a batch.
+     */
+    void finish()
+    {
+        while (!pending_buffers.empty())
+            write_front();
+    }
+
+private:
+    //!\brief Waits for the oldest batch and writes it to the stream.
+    void write_front()
+    {
+        std::future<std::string> buffer = std::move(pending_buffers.front());
+        pending_buffers.pop_front();
+
+        std::string const bytes = buffer.get(); // Rethrows exceptions of the serialisation.
+        stream.write(bytes.data(), bytes.size());
+    }
+
+    //!\brief The stream to write to.
+    std::ostream & stream;
+    //!\brief The maximal number of batches that are serialised or waiting at the same time.
+    size_t max_pending_batches;
+
+    //!\brief The buffers of the batches in the order they were pushed.
+    std::deque<std::future<std::string>> pending_buffers{};
+
+    //!\brief The queue of serialisation tasks.
+    contrib::fixed_buffer_queue<std::function<void()>> task_queue;
+    //!\brief The worker threads.
+    std::vector<std::thread> workers{};
+};
+
+} // namespace seqan3::detail
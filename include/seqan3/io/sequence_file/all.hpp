@@ -22,7 +22,9 @@
 #pragma GCC diagnostic push // buggy deprecation warning is triggered in the ranges library
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
+#include <seqan3/io/sequence_file/fasta_index.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
+#include <seqan3/io/sequence_file/indexed_fasta_file.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
@@ -0,0 +1,272 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fasta_index.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <charconv>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <seqan3/core/detail/to_string.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The index of a FASTA file, as stored in `.fai` files.
+ * \ingroup sequence
+ *
+ * \details
+ *
+ * For every sequence, the index stores its length, the offset of its first base in the file and the line layout.
+ * As all lines of a sequence but the last one must contain the same number of bases, the offset of any base can be
+ * computed without reading the file, see offset(). The format is the one written by `samtools faidx`.
+ *
+ * If the FASTA file is BGZF compressed, the offsets refer to the uncompressed data and are translated with the
+ * `.gzi` index of the file (seqan3::contrib::bgzf_index).
+ *
+ * Usually, you do not use this class yourself, but read the sequences via seqan3::indexed_fasta_file.
+ */
+class fasta_index
+{
+public:
+    //!\brief The index of a single sequence; one line of a `.fai` file.
+    struct entry
+    {
+        //!\brief The name of the sequence, i.e. the id up to the first whitespace.
+        std::string name{};
+        //!\brief The number of bases.
+        uint64_t length{};
+        //!\brief The offset of the first base in the (uncompressed) file.
+        uint64_t offset{};
+        //!\brief The number of bases per line.
+        uint64_t line_bases{};
+        //!\brief The number of characters per line, including the line ending.
+        uint64_t line_width{};
+
+        //!\brief Compares all members.
+        friend bool operator==(entry const & lhs, entry const & rhs) noexcept
+        {
+            return lhs.name == rhs.name && lhs.length == rhs.length && lhs.offset == rhs.offset &&
+                   lhs.line_bases == rhs.line_bases && lhs.line_width == rhs.line_width;
+        }
+
+        //!\brief Compares all members.
+        friend bool operator!=(entry const & lhs, entry const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fasta_index() = default;                                //!< Defaulted.
+    fasta_index(fasta_index const &) = default;             //!< Defaulted.
+    fasta_index(fasta_index &&) = default;                  //!< Defaulted.
+    fasta_index & operator=(fasta_index const &) = default; //!< Defaulted.
+    fasta_index & operator=(fasta_index &&) = default;      //!< Defaulted.
+    ~fasta_index() = default;                               //!< Defaulted.
+    //!\}
+
+    /*!\brief Builds the index by reading a FASTA file.
+     * \param[in] fasta_stream The stream over the (uncompressed) FASTA file, positioned at its beginning.
+     * \returns The index of all sequences.
+     * \throws seqan3::format_error If the lines of a sequence have different lengths or a name occurs twice.
+     */
+    static fasta_index build(std::istream & fasta_stream)
+    {
+        fasta_index index{};
+        std::string line{};
+        uint64_t position{};     // The offset of the current line.
+        bool short_line = false; // Whether the current sequence had a line shorter than the first one.
+
+        while (std::getline(fasta_stream, line))
+        {
+            uint64_t const line_start = position;
+            bool const has_newline = !fasta_stream.eof();
+            position += line.size() + has_newline;
+
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (!line.empty() && line.front() == '>')
+            {
+                std::string_view name{line};
+                name.remove_prefix(1);
+                name = name.substr(0, name.find_first_of(" \t\v\f"));
+
+                index.push_back(entry{std::string{name}, 0, position, 0, 0});
+                short_line = false;
+                continue;
+            }
+
+            if (index.entries.empty())
+            {
+                if (line.empty())
+                    continue;
+
+                throw format_error{"Building the FASTA index failed: the file does not start with '>'."};
+            }
+
+            entry & current = index.entries.back();
+            uint64_t const bases = line.size();
+
+            if (current.line_bases == 0 && bases > 0 && !short_line) // The first line of the sequence.
+            {
+                current.line_bases = bases;
+                current.line_width = position - line_start;
+            }
+            else if (bases > 0 && (short_line || bases > current.line_bases))
+            {
+                throw format_error{detail::to_string("Building the FASTA index failed: the lines of sequence '",
+                                                     current.name, "' have different lengths.")};
+            }
+
+            short_line = short_line || bases < current.line_bases || bases == 0;
+            current.length += bases;
+        }
+
+        return index;
+    }
+
+    /*!\brief Reads the index from a `.fai` file.
+     * \param[in] index_stream The stream over the `.fai` file.
+     * \throws seqan3::format_error If a line is malformed or a name occurs twice.
+     */
+    void read(std::istream & index_stream)
+    {
+        entries.clear();
+        names.clear();
+
+        std::string line{};
+        while (std::getline(index_stream, line))
+        {
+            if (line.empty())
+                continue;
+
+            std::string_view remaining{line};
+            entry current{};
+            current.name = std::string{next_column(remaining)};
+            current.length = parse_column(remaining);
+            current.offset = parse_column(remaining);
+            current.line_bases = parse_column(remaining);
+            current.line_width = parse_column(remaining); // The column of the quality offset of FASTQ is ignored.
+
+            push_back(std::move(current));
+        }
+    }
+
+    /*!\brief Writes the index in the `.fai` format.
+     * \param[in] index_stream The stream to write to.
+     */
+    void write(std::ostream & index_stream) const
+    {
+        for (entry const & current : entries)
+        {
+            index_stream << current.name << '\t' << current.length << '\t' << current.offset << '\t'
+                         << current.line_bases << '\t' << current.line_width << '\n';
+        }
+    }
+
+    /*!\brief Returns the entry of a sequence.
+     * \param[in] name The name of the sequence.
+     * \returns A pointer to the entry or `nullptr` if the index does not contain the sequence.
+     */
+    entry const * find(std::string_view const name) const
+    {
+        auto it = names.find(std::string{name});
+        return it == names.end() ? nullptr : &entries[it->second];
+    }
+
+    /*!\brief Returns the offset of a base in the (uncompressed) FASTA file.
+     * \param[in] sequence The entry of the sequence.
+     * \param[in] position The position of the base in the sequence.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant.
+     */
+    static uint64_t offset(entry const & sequence, uint64_t const position) noexcept
+    {
+        if (sequence.line_bases == 0)
+            return sequence.offset;
+
+        return sequence.offset + position / sequence.line_bases * sequence.line_width +
+               position % sequence.line_bases;
+    }
+
+    //!\brief The entries of all sequences in the order of the file.
+    std::vector<entry> const & sequences() const noexcept
+    {
+        return entries;
+    }
+
+    //!\brief Compares the entries of both indices.
+    friend bool operator==(fasta_index const & lhs, fasta_index const & rhs) noexcept
+    {
+        return lhs.entries == rhs.entries;
+    }
+
+    //!\brief Compares the entries of both indices.
+    friend bool operator!=(fasta_index const & lhs, fasta_index const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    //!\brief Appends an entry and throws if its name is not unique.
+    void push_back(entry current)
+    {
+        if (!names.emplace(current.name, entries.size()).second)
+        {
+            throw format_error{detail::to_string("The FASTA index contains the sequence name '", current.name,
+                                                 "' twice.")};
+        }
+
+        entries.push_back(std::move(current));
+    }
+
+    //!\brief Returns the next tab-separated column and removes it from the line.
+    static std::string_view next_column(std::string_view & remaining)
+    {
+        size_t const end = remaining.find('\t');
+        std::string_view const column = remaining.substr(0, end);
+        remaining.remove_prefix(end == std::string_view::npos ? remaining.size() : end + 1);
+        return column;
+    }
+
+    //!\brief Returns the next tab-separated column as number.
+    static uint64_t parse_column(std::string_view & remaining)
+    {
+        std::string_view const column = next_column(remaining);
+        uint64_t value{};
+        auto [ptr, error] = std::from_chars(column.data(), column.data() + column.size(), value);
+
+        if (column.empty() || error != std::errc{} || ptr != column.data() + column.size())
+            throw format_error{"The FASTA index contains a malformed line."};
+
+        return value;
+    }
+
+    //!\brief The entries of all sequences in the order of the file.
+    std::vector<entry> entries{};
+    //!\brief Maps the names of the sequences to their position in entries.
+    std::unordered_map<std::string, size_t> names{};
+};
+
+} // namespace seqan3
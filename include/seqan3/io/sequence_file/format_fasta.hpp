@@ -22,6 +22,7 @@
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/io/detail/buffered_input.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
@@ -228,16 +229,12 @@ private:
                 for (; (it != e) && (is_id || is_blank)(*it); ++it)
                 {}
 
-                bool at_delimiter = false;
-                for (; it != e; ++it)
+                // Read the rest of the line buffer-wise.
+                bool const at_delimiter = detail::consume_buffered_until<'\n'>(it, [&] (std::string_view const chunk)
                 {
-                    if ((is_char<'\n'>)(*it))
-                    {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, value_type_t<id_type>{}));
-                }
+                    for (char const c : chunk)
+                        id.push_back(assign_char_to(c, value_type_t<id_type>{}));
+                });
 
                 if (!at_delimiter)
                     throw unexpected_end_of_input{"FastA ID line did not end in newline."};
@@ -265,29 +262,38 @@ private:
                    sequence_file_input_options<seq_legal_alph_type, seq_qual_combined> const &,
                    seq_type & seq)
     {
-        auto constexpr is_id = is_char<'>'> || is_char<';'>;
+        [[maybe_unused]] auto constexpr is_id = is_char<'>'> || is_char<';'>;
 
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
             auto constexpr not_in_alph = !is_in_alphabet<seq_legal_alph_type>;
 
         #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+            // Classify and convert all characters with a single lookup; whitespace and numbers are ignored.
+            static detail::char_conversion_table<value_type_t<seq_type>> const table{is_space || is_digit,
+                                                                                     !not_in_alph};
+
+            // Process the sequence buffer-wise until the next header (or end).
             auto it = stream_view.begin();
-            auto e = stream_view.end();
-            for (; (it != e) && ((!is_id)(*it)); ++it)
+            detail::consume_buffered_until<'>', ';'>(it, [&] (std::string_view const chunk)
             {
-                if ((is_space || is_digit)(*it))
-                    continue;
-                else if (not_in_alph(*it))
+                for (char const c : chunk)
                 {
-                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                        not_in_alph.msg +
-                                        " evaluated to true on " +
-                                        detail::make_printable(*it)};
+                    switch (table.category(c))
+                    {
+                        case detail::char_category::take:
+                            seq.push_back(table.value(c));
+                            break;
+                        case detail::char_category::skip:
+                            break;
+                        default:
+                            throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                              not_in_alph.msg +
+                                              " evaluated to true on " +
+                                              detail::make_printable(c)};
+                    }
                 }
-
-                seq.push_back(assign_char_to(*it, value_type_t<seq_type>{}));
-            }
+            });
 
         #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
 
@@ -310,7 +316,12 @@ private:
         }
         else
         {
+        #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+            auto it = stream_view.begin();
+            detail::consume_buffered_until<'>', ';'>(it, [] (std::string_view const) {});
+        #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
             detail::consume(stream_view | views::take_until(is_id));
+        #endif // SEQAN3_WORKAROUND_VIEW_PERFORMANCE
         }
     }
 
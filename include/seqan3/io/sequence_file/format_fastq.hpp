@@ -22,6 +22,7 @@
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/io/detail/buffered_input.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
@@ -148,37 +149,45 @@ protected:
         }
 
         /* Sequence */
-        auto seq_view = stream_view | views::take_until_or_throw(is_char<'+'>)    // until 2nd ID line
-                                    | std::views::filter(!is_space);           // ignore whitespace
+        // The sequence is processed buffer-wise until the 2nd ID line, whitespace is ignored.
+        bool at_second_id_line{};
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
             auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
-            std::ranges::copy(seq_view | std::views::transform([is_legal_alph] (char const c) // enforce legal alphabet
-                                    {
-                                        if (!is_legal_alph(c))
-                                        {
-                                            throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                                is_legal_alph.msg +
-                                                                " evaluated to false on " +
-                                                                detail::make_printable(c)};
-                                        }
-                                        return c;
-                                    })
-                                        | views::char_to<value_type_t<seq_type>>,         // convert to actual target alphabet
-                              std::ranges::back_inserter(sequence));
+            static detail::char_conversion_table<value_type_t<seq_type>> const seq_table{is_space, is_legal_alph};
+
+            at_second_id_line = detail::consume_buffered_until<'+'>(stream_it, [&] (std::string_view const chunk)
+            {
+                for (char const c : chunk)
+                {
+                    switch (seq_table.category(c))
+                    {
+                        case detail::char_category::take:
+                            sequence.push_back(seq_table.value(c));
+                            break;
+                        case detail::char_category::skip:
+                            break;
+                        default:
+                            throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                              is_legal_alph.msg +
+                                              " evaluated to false on " +
+                                              detail::make_printable(c)};
+                    }
+                }
+            });
             sequence_size_after = size(sequence);
         }
         else // consume, but count
         {
-            auto it = begin(seq_view);
-            auto it_end = end(seq_view);
-            while (it != it_end)
+            at_second_id_line = detail::consume_buffered_until<'+'>(stream_it, [&] (std::string_view const chunk)
             {
-                ++it;
-                ++sequence_size_after;
-            }
+                sequence_size_after += static_cast<size_t>(std::ranges::count_if(chunk, !is_space));
+            });
         }
 
+        if (!at_second_id_line) // [[unlikely]]
+            throw unexpected_end_of_input{"Reached end of input before the 2nd ID line."};
+
         /* 2nd ID line */
         if (*stream_it != '+') // [[unlikely]]
         {
@@ -188,23 +197,58 @@ protected:
         detail::consume(stream_view | views::take_line_or_throw);
 
         /* Qualities */
-        auto qview = stream_view | std::views::filter(!is_space)                  // this consumes trailing newline
-                                 | views::take_exactly_or_throw(sequence_size_after - sequence_size_before);
+        // Reads as many qualities as there are letters in the sequence and consumes the trailing whitespace.
+        auto read_qualities = [&] (auto const & qual_table, auto && store_quality)
+        {
+            size_t remaining = sequence_size_after - sequence_size_before;
+            detail::consume_buffered(stream_it, [&] (std::string_view const chunk)
+            {
+                size_t position = 0;
+                for (; position < chunk.size(); ++position)
+                {
+                    if (qual_table.category(chunk[position]) == detail::char_category::skip)
+                        continue;
+                    if (remaining == 0)
+                        break;
+
+                    store_quality(qual_table.value(chunk[position]));
+                    --remaining;
+                }
+                return position;
+            });
+
+            if (remaining > 0) // [[unlikely]]
+                throw unexpected_end_of_input{"Reached end of input before reading all qualities."};
+        };
+
         if constexpr (seq_qual_combined)
         {
             // seq_qual field implies that they are the same variable
             assert(std::addressof(sequence) == std::addressof(qualities));
-            std::ranges::copy(qview | views::char_to<typename value_type_t<qual_type>::quality_alphabet_type>,
-                              begin(qualities) + sequence_size_before);
+            using quality_alphabet_t = typename value_type_t<qual_type>::quality_alphabet_type;
+            static detail::char_conversion_table<quality_alphabet_t> const qual_table{is_space, !is_space};
+
+            auto qual_it = begin(qualities) + sequence_size_before;
+            read_qualities(qual_table, [&] (quality_alphabet_t const quality)
+            {
+                *qual_it = quality;
+                ++qual_it;
+            });
         }
         else if constexpr (!detail::decays_to_ignore_v<qual_type>)
         {
-            std::ranges::copy(qview | views::char_to<value_type_t<qual_type>>,
-                              std::ranges::back_inserter(qualities));
+            using quality_alphabet_t = value_type_t<qual_type>;
+            static detail::char_conversion_table<quality_alphabet_t> const qual_table{is_space, !is_space};
+
+            read_qualities(qual_table, [&] (quality_alphabet_t const quality)
+            {
+                qualities.push_back(quality);
+            });
         }
         else
         {
-            detail::consume(qview);
+            static detail::char_conversion_table<char> const qual_table{is_space, !is_space};
+            read_qualities(qual_table, [] (char const) {});
         }
     }
 
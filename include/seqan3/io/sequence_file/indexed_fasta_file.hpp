@@ -0,0 +1,221 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::indexed_fasta_file.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/detail/to_string.hpp>
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+#include <seqan3/std/filesystem>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_index.hpp>
+#endif
+
+namespace seqan3
+{
+
+/*!\brief Reads arbitrary subsequences of an indexed FASTA file.
+ * \ingroup sequence
+ *
+ * \details
+ *
+ * In contrast to seqan3::sequence_file_input, which reads whole records one after the other, this file reads a
+ * window of a sequence by seeking to the offsets computed with the `.fai` index (seqan3::fasta_index). Only the
+ * lines containing the window are read, such that no sequence needs to be held in memory:
+ *
+ * ```cpp
+ * seqan3::indexed_fasta_file reference{"genome.fa"};   // Reads genome.fa.fai or builds the index.
+ *
+ * // The bases [1'000'000, 1'000'100) of chr1.
+ * seqan3::dna5_vector window = reference.sequence("chr1", 1'000'000, 1'000'100);
+ * std::vector<seqan3::dna4> window4 = reference.sequence<seqan3::dna4>("chr1", 1'000'000, 1'000'100);
+ * ```
+ *
+ * The file may be uncompressed or BGZF compressed (`bgzip`); other compressions do not support random access.
+ * For BGZF files, the `.gzi` index maps the offsets of the `.fai` index to the compressed blocks.
+ *
+ * If no index file exists, the index is built by reading the file once on construction. The built index is not
+ * written to disk; use `index().write()` to store it.
+ */
+class indexed_fasta_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    indexed_fasta_file() = delete;                                       //!< Deleted.
+    indexed_fasta_file(indexed_fasta_file const &) = delete;             //!< Deleted.
+    indexed_fasta_file(indexed_fasta_file &&) = default;                 //!< Defaulted.
+    indexed_fasta_file & operator=(indexed_fasta_file const &) = delete; //!< Deleted.
+    indexed_fasta_file & operator=(indexed_fasta_file &&) = default;     //!< Defaulted.
+    ~indexed_fasta_file() = default;                                     //!< Defaulted.
+
+    /*!\brief Opens the FASTA file and reads its indices.
+     * \param[in] filename Path to the FASTA file.
+     * \throws seqan3::file_open_error If the file could not be opened or is compressed, but not with BGZF.
+     * \throws seqan3::format_error If an index is invalid or could not be built.
+     *
+     * \details
+     *
+     * The `.fai` index is read from `<filename>.fai` and the `.gzi` index of BGZF files from `<filename>.gzi`.
+     * Missing indices are built.
+     */
+    explicit indexed_fasta_file(std::filesystem::path const & filename) :
+        primary_stream{std::make_unique<std::ifstream>(filename, std::ios_base::in | std::ios::binary)}
+    {
+        if (!primary_stream->good())
+            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+        std::filesystem::path decompressed_name = filename;
+        secondary_stream = detail::make_secondary_istream(*primary_stream, decompressed_name);
+
+        bool const is_compressed = &*secondary_stream != primary_stream.get();
+    #ifdef SEQAN3_HAS_ZLIB
+        is_bgzf = dynamic_cast<contrib::basic_bgzf_istream<char> *>(&*secondary_stream) != nullptr;
+    #endif
+
+        if (is_compressed && !is_bgzf)
+            throw file_open_error{"Random access into " + filename.string() + " is not possible, because it is "
+                                  "compressed, but not with BGZF."};
+
+    #ifdef SEQAN3_HAS_ZLIB
+        if (is_bgzf)
+        {
+            if (std::ifstream gzi_stream{append_extension(filename, ".gzi"), std::ios::binary}; gzi_stream.good())
+            {
+                block_index.read(gzi_stream);
+            }
+            else
+            {
+                std::ifstream compressed_stream{filename, std::ios_base::in | std::ios::binary};
+                block_index = contrib::bgzf_index::build(compressed_stream);
+            }
+        }
+    #endif
+
+        if (std::ifstream index_stream{append_extension(filename, ".fai")}; index_stream.good())
+        {
+            sequence_index.read(index_stream);
+        }
+        else
+        {
+            sequence_index = fasta_index::build(*secondary_stream);
+        }
+    }
+    //!\}
+
+    /*!\brief Reads a window of a sequence.
+     * \tparam alphabet_type The alphabet of the returned sequence; must model seqan3::nucleotide_alphabet.
+     * \param[in] name  The name of the sequence, i.e. the id up to the first whitespace.
+     * \param[in] begin The first position of the window (0-based).
+     * \param[in] end   The position behind the window; reduced to the length of the sequence if it is longer.
+     * \returns The bases in `[begin, end)`, converted via seqan3::assign_char_to; empty if `begin >= end`.
+     * \throws std::out_of_range If the file contains no sequence with the name.
+     * \throws seqan3::io_error If the file could not be read.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the window; the position of the window in the file does not matter.
+     */
+    template <nucleotide_alphabet alphabet_type = dna5>
+    std::vector<alphabet_type> sequence(std::string_view const name, uint64_t const begin, uint64_t end)
+    {
+        fasta_index::entry const * entry = sequence_index.find(name);
+
+        if (entry == nullptr)
+            throw std::out_of_range{detail::to_string("The FASTA file contains no sequence '", name, "'.")};
+
+        std::vector<alphabet_type> result{};
+        end = std::min(end, entry->length);
+
+        if (begin >= end)
+            return result;
+
+        uint64_t const first = fasta_index::offset(*entry, begin);
+        uint64_t const last = fasta_index::offset(*entry, end - 1) + 1;
+
+        buffer.resize(last - first);
+        seek(first);
+
+        if (!secondary_stream->read(buffer.data(), buffer.size()))
+            throw io_error{detail::to_string("Reading the sequence '", name, "' failed; the index does not match "
+                                             "the file.")};
+
+        result.reserve(end - begin);
+        for (char const c : buffer)
+            if (c != '\n' && c != '\r')
+                result.push_back(assign_char_to(c, alphabet_type{}));
+
+        return result;
+    }
+
+    //!\brief Returns the index of the sequences.
+    fasta_index const & index() const noexcept
+    {
+        return sequence_index;
+    }
+
+private:
+    //!\brief Returns the filename with the extension appended.
+    static std::filesystem::path append_extension(std::filesystem::path filename, char const * const extension)
+    {
+        return filename += extension;
+    }
+
+    //!\brief Moves the stream to an offset of the uncompressed data.
+    void seek(uint64_t const offset)
+    {
+        secondary_stream->clear();
+
+    #ifdef SEQAN3_HAS_ZLIB
+        if (is_bgzf)
+        {
+            secondary_stream->seekg(block_index.virtual_offset(offset));
+            return;
+        }
+    #endif
+
+        secondary_stream->seekg(offset);
+    }
+
+    //!\brief The file stream.
+    std::unique_ptr<std::ifstream> primary_stream;
+    //!\brief The decompression stream on top of the file stream, or the file stream if it is not compressed.
+    std::unique_ptr<std::istream, std::function<void(std::istream *)>> secondary_stream{nullptr};
+    //!\brief The `.fai` index.
+    fasta_index sequence_index{};
+    //!\brief The characters of the lines containing the window; reused between calls.
+    std::vector<char> buffer{};
+    //!\brief Whether the file is BGZF compressed.
+    bool is_bgzf{false};
+#ifdef SEQAN3_HAS_ZLIB
+    //!\brief The `.gzi` index of a BGZF compressed file.
+    contrib::bgzf_index block_index{};
+#endif
+};
+
+} // namespace seqan3
@@ -14,7 +14,11 @@
 
 #include <cassert>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -35,12 +39,14 @@
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/parallel_record_reader.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
 #include <seqan3/io/sequence_file/format_fastq.hpp>
 #include <seqan3/io/sequence_file/format_genbank.hpp>
+#include <seqan3/io/sequence_file/record_batch.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/range/container/concatenated_sequences.hpp>
 
@@ -295,6 +301,15 @@ struct sequence_file_input_default_traits_aa : sequence_file_input_default_trait
  *
  * \include test/snippet/io/sequence_file/sequence_file_input_file_view.cpp
  *
+ * ### Parsing with multiple threads
+ *
+ * For FASTA and FASTQ files, the parsing of the records can be distributed over multiple threads by setting
+ * seqan3::sequence_file_input_options::threads before the first record is read. The file is then read in large
+ * chunks that are cut at record boundaries and parsed concurrently, while the records are still returned in the
+ * order of the file:
+ *
+ * \include test/snippet/io/sequence_file/sequence_file_input_parallel.cpp
+ *
  * ### End of file
  *
  * You can check whether a file is at end by comparing begin() and end() (if they are the same, the file is at end).
@@ -382,6 +397,13 @@ public:
     //!\brief The type of the record, a specialisation of seqan3::record; acts as a tuple of the selected field types.
     using record_type           = record<detail::select_types_with_ids_t<field_types, field_ids, selected_field_ids>,
                                          selected_field_ids>;
+    //!\brief The type of the batch returned by read_batch(), a specialisation of seqan3::sequence_record_batch.
+    using batch_type            = sequence_record_batch<
+                                    std::conditional_t<selected_field_ids::contains(field::seq_qual),
+                                                       sequence_quality_type,
+                                                       sequence_type>,
+                                    id_type,
+                                    quality_type>;
     //!\}
 
     /*!\name Range associated types
@@ -432,6 +454,9 @@ public:
      * In addition to the file name, you may specify a custom seqan3::fields type which may be easier than
      * defining all the template parameters.
      *
+     * Regular files are memory-mapped and read directly from the mapping; other files, e.g. named pipes or files
+     * reporting size 0, are read through a std::ifstream.
+     *
      * ### Decompression
      *
      * This constructor transparently applies a decompression stream on top of the file stream in case
@@ -440,7 +465,7 @@ public:
      */
     sequence_file_input(std::filesystem::path filename,
                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{filename, std::ios_base::in | std::ios::binary}, stream_deleter_default}
+        primary_stream{detail::make_primary_istream<stream_char_type>(filename).release(), stream_deleter_default}
     {
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
@@ -587,6 +612,88 @@ public:
     }
     //!\}
 
+    /*!\brief Reads the next records into a batch that stores every field contiguously.
+     * \param[in] count The maximal number of records to read.
+     * \returns A reference to the internal batch buffer holding at most `count` records.
+     * \throws seqan3::format_error
+     *
+     * \details
+     *
+     * The records are appended to the columns of a seqan3::sequence_record_batch, which is reused by every call.
+     * In contrast to moving the records out of the file, this does not allocate memory for every record once the
+     * buffers have grown to the size of a batch. FASTA and FASTQ records are parsed directly into the columns if they
+     * are read by a single thread; otherwise, the records are parsed first and copied into the batch. The returned
+     * batch contains fewer than `count` records only at the end of the file and is empty if the file is at end.
+     *
+     * Record-wise reading and batch reading can be mixed: the batch starts at the current record and afterwards
+     * begin() points to the first record that is not contained in the batch.
+     * The returned reference is invalidated by the next call to read_batch().
+     *
+     * \include test/snippet/io/sequence_file/sequence_file_input_read_batch.cpp
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the read records.
+     *
+     * ### Exceptions
+     *
+     * Throws seqan3::format_error if a record could not be read.
+     */
+    batch_type & read_batch(size_type const count)
+    {
+        batch_buffer.clear();
+
+        if (count == 0)
+            return batch_buffer;
+
+        // The current record has already been parsed, e.g. by begin(); it is copied and the next one is read afresh.
+        if (first_record_was_read && !at_end)
+        {
+            batch_buffer.push_back(record_buffer);
+            first_record_was_read = false;
+        }
+
+        // FASTA and FASTQ records are parsed directly into the columns of the batch.
+        if (!parallel_reader && options.threads <= 1 && parses_into_batch())
+        {
+            while (batch_buffer.size() < count)
+            {
+                if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
+                    std::istreambuf_iterator<stream_char_type>{})
+                {
+                    at_end = true;
+                    break;
+                }
+
+                batch_buffer.template push_back_parsed<selected_field_ids>([this] (auto & sequences,
+                                                                                  auto & ids,
+                                                                                  auto & qualities)
+                {
+                    std::visit([&] (auto & f)
+                    {
+                        using format_t = remove_cvref_t<decltype(f)>;
+
+                        if constexpr (std::derived_from<format_t, format_fasta> ||
+                                      std::derived_from<format_t, format_fastq>)
+                        {
+                            if constexpr (selected_field_ids::contains(field::seq_qual))
+                                f.read_sequence_record(*secondary_stream, options, sequences, ids, sequences);
+                            else
+                                f.read_sequence_record(*secondary_stream, options, sequences, ids, qualities);
+                        }
+                    }, format);
+                });
+            }
+
+            return batch_buffer;
+        }
+
+        for (auto it = begin(); batch_buffer.size() < count && it != end(); ++it)
+            batch_buffer.push_back(*it);
+
+        return batch_buffer;
+    }
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
                              selected_field_ids::contains(field::seq_qual)> options;
@@ -598,6 +705,8 @@ protected:
      */
     //!\brief Buffer for a single record.
     record_type record_buffer;
+    //!\brief Buffer for the batch returned by read_batch().
+    batch_type batch_buffer;
     //!\}
 
     /*!\name Stream / file access
@@ -628,11 +737,41 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief The parallel reader; only initialised if the records are parsed with multiple threads.
+    std::unique_ptr<detail::parallel_record_reader<record_type>> parallel_reader{};
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
-        // clear the record
-        record_buffer.clear();
+        // clear the record, but keep the memory of the fields
+        clear_record_buffer(std::make_index_sequence<selected_field_ids::as_array.size()>{});
+
+        // Parse the records with multiple threads if requested and supported by the format.
+        if (!parallel_reader && options.threads > 1)
+        {
+            if (auto split_function = record_split_function(); split_function)
+            {
+                parallel_reader = std::make_unique<detail::parallel_record_reader<record_type>>(
+                    *secondary_stream,
+                    options.threads,
+                    std::move(split_function),
+                    [format = format, options = options] (std::basic_istream<stream_char_type> & stream,
+                                                          std::vector<record_type> & batch) mutable
+                    {
+                        while (std::istreambuf_iterator<stream_char_type>{stream} !=
+                               std::istreambuf_iterator<stream_char_type>{})
+                        {
+                            read_record(stream, options, format, batch.emplace_back());
+                        }
+                    });
+            }
+        }
+
+        if (parallel_reader)
+        {
+            at_end = !parallel_reader->next(record_buffer);
+            return;
+        }
 
         // at end if we could not read further
         if ((std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
@@ -642,29 +781,74 @@ protected:
             return;
         }
 
+        read_record(*secondary_stream, options, format, record_buffer);
+    }
+
+    //!\brief Clears all fields of the record buffer without releasing their memory.
+    template <size_t ... field_indices>
+    void clear_record_buffer(std::index_sequence<field_indices...> const &)
+    {
+        (std::get<field_indices>(record_buffer).clear(), ...);
+    }
+
+    //!\brief Reads a single record from the stream with the given format.
+    static void read_record(std::basic_istream<stream_char_type> & stream,
+                            sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
+                                                        selected_field_ids::contains(field::seq_qual)> const & options,
+                            format_type & format,
+                            record_type & record)
+    {
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
             // read new record
             if constexpr (selected_field_ids::contains(field::seq_qual))
             {
-                f.read_sequence_record(*secondary_stream,
+                f.read_sequence_record(stream,
                                        options,
-                                       detail::get_or_ignore<field::seq_qual>(record_buffer),
-                                       detail::get_or_ignore<field::id>(record_buffer),
-                                       detail::get_or_ignore<field::seq_qual>(record_buffer));
+                                       detail::get_or_ignore<field::seq_qual>(record),
+                                       detail::get_or_ignore<field::id>(record),
+                                       detail::get_or_ignore<field::seq_qual>(record));
             }
             else
             {
-                f.read_sequence_record(*secondary_stream,
+                f.read_sequence_record(stream,
                                        options,
-                                       detail::get_or_ignore<field::seq>(record_buffer),
-                                       detail::get_or_ignore<field::id>(record_buffer),
-                                       detail::get_or_ignore<field::qual>(record_buffer));
+                                       detail::get_or_ignore<field::seq>(record),
+                                       detail::get_or_ignore<field::id>(record),
+                                       detail::get_or_ignore<field::qual>(record));
             }
         }, format);
     }
 
+    //!\brief Whether read_batch() can parse the records of the selected format directly into the batch.
+    bool parses_into_batch() const
+    {
+        return std::visit([] (auto const & f)
+        {
+            using format_t = remove_cvref_t<decltype(f)>;
+            return std::derived_from<format_t, format_fasta> || std::derived_from<format_t, format_fastq>;
+        }, format);
+    }
+
+    /*!\brief Returns the function that finds the last record start in a buffer for the selected format.
+     * \returns The function or an empty std::function if the format cannot be split into chunks.
+     */
+    std::function<size_t(std::string_view)> record_split_function() const
+    {
+        return std::visit([] (auto const & f) -> std::function<size_t(std::string_view)>
+        {
+            using format_t = remove_cvref_t<decltype(f)>;
+
+            if constexpr (std::derived_from<format_t, format_fasta>)
+                return detail::find_last_fasta_record_start;
+            else if constexpr (std::derived_from<format_t, format_fastq>)
+                return detail::find_last_fastq_record_start;
+            else
+                return {};
+        }, format);
+    }
+
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
 };
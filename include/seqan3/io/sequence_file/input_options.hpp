@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -28,6 +30,19 @@ struct sequence_file_input_options
     bool truncate_ids = false;
     //!\brief Read the complete_header into the seqan3::field::id for embl or genbank format.
     bool embl_genbank_complete_header = false;
+    /*!\brief The number of threads used to parse the records.
+     *
+     * \details
+     *
+     * If set to a value greater than 1, the file is read in chunks that are cut at record boundaries and parsed
+     * by the given number of threads. The records are still returned in the order of the file.
+     * Currently, only seqan3::format_fasta and seqan3::format_fastq support parallel parsing, the other formats are
+     * always read sequentially. The option must be set before the first record is read.
+     *
+     * The records of FASTQ files must be stored on four lines each, i.e. the sequences and qualities must not be
+     * wrapped, otherwise a quality line may be taken for the beginning of a record; read such files with one thread.
+     */
+    size_t threads = 1;
 };
 
 } // namespace seqan3
@@ -13,8 +13,11 @@
 #pragma once
 
 #include <cassert>
+#include <exception>
 #include <fstream>
+#include <memory>
 #include <string>
+#include <tuple>
 #include <variant>
 #include <vector>
 
@@ -29,6 +32,7 @@
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
 #include <seqan3/io/record.hpp>
+#include <seqan3/io/detail/async_record_writer.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/detail/misc_output.hpp>
 #include <seqan3/io/detail/out_file_iterator.hpp>
@@ -156,6 +160,16 @@ namespace seqan3
  *
  * \include test/snippet/io/sequence_file/sequence_file_output_col_based_writing.cpp
  *
+ * ### Writing asynchronously
+ *
+ * If seqan3::sequence_file_output_options::async_write is set, the records are formatted and written by a separate
+ * thread: push() only copies the fields of the record and returns, unless too many records are waiting to be written.
+ * Exceptions thrown while writing are rethrown by the next push() or by flush(). The records that have not been
+ * written at that point are discarded and the writer thread is stopped; a subsequent push() starts a new writer
+ * thread that writes to the same stream, which is usually unusable after the error. Records that have not been written
+ * when the file is destroyed are written by the destructor, which cannot report errors; call flush() before if you
+ * need to know whether all records were written.
+ *
  * ### Formats
  *
  * We currently support writing the following formats:
@@ -241,8 +255,23 @@ public:
     sequence_file_output(sequence_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     sequence_file_output & operator=(sequence_file_output &&) = default;
-    //!\brief Destructor is defaulted.
-    ~sequence_file_output() = default;
+    /*!\brief Writes the records that are still waiting for the asynchronous writer and creates the compression
+     *        stream of an empty compressed file, so that it is a valid compressed file.
+     */
+    ~sequence_file_output()
+    {
+        async_context.reset();
+
+        if (primary_stream && !secondary_stream)
+        {
+            try
+            {
+                get_stream();
+            }
+            catch (...)
+            {}
+        }
+    }
 
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
@@ -266,8 +295,8 @@ public:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for writing."};
 
-        // possibly add intermediate compression stream
-        secondary_stream = detail::make_secondary_ostream(*primary_stream, filename);
+        // possibly add intermediate compression stream, which is created on first use to apply the options
+        compression_extension = detail::strip_compression_extension(filename);
 
         // initialise format handler or throw if format is not found
         detail::set_format(format, filename);
@@ -538,6 +567,23 @@ public:
     }
     //!\}
 
+    /*!\brief Waits until all records have been written and flushes the stream.
+     * \throws Any exception thrown while writing a record asynchronously.
+     *
+     * \details
+     *
+     * If seqan3::sequence_file_output_options::async_write is set, this waits for the writer thread to write all
+     * records that have been pushed so far. The writer thread is restarted by the next record, also if writing
+     * failed.
+     */
+    void flush()
+    {
+        if (async_context)
+            finish_async_write();
+
+        get_stream().flush();
+    }
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_output_options options{};
 
@@ -546,6 +592,14 @@ public:
      */
     std::basic_ostream<stream_char_type> & get_stream()
     {
+        if (!secondary_stream)
+        {
+            secondary_stream = detail::make_compression_ostream(*primary_stream,
+                                                                compression_extension,
+                                                                options.compression_level,
+                                                                options.compression_threads);
+        }
+
         return *secondary_stream;
     }
     //!\endcond
@@ -563,10 +617,22 @@ protected:
     //!\brief Stream deleter with default behaviour (ownership assumed).
     static void stream_deleter_default(std::basic_ostream<stream_char_type> * ptr) { delete ptr; }
 
+    struct async_context_type;
+    /*!\brief The asynchronous writer; created by the first record if seqan3::sequence_file_output_options::async_write.
+     *
+     * \details
+     *
+     * Declared before the streams, so that a move assignment finishes the writer before the streams it writes to are
+     * replaced.
+     */
+    std::unique_ptr<async_context_type> async_context{};
+
     //!\brief The primary stream is the user provided stream or the file stream if constructed from filename.
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief The compression extension of the file name; the secondary stream is created from it on first use.
+    std::string compression_extension{};
 
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = typename detail::variant_from_tags<valid_formats,
@@ -575,6 +641,19 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief The state of the asynchronous writer; on the heap, so that the file can be moved while writing.
+    struct async_context_type
+    {
+        //!\brief The stream to write to; does not change when the file is moved.
+        std::basic_ostream<stream_char_type> * stream;
+        //!\brief The format, moved here from the file while the writer thread uses it.
+        format_type format;
+        //!\brief A copy of the options of the file.
+        sequence_file_output_options options;
+        //!\brief The writer; destroyed first, so that it writes the remaining records with the format above.
+        detail::async_record_writer writer{};
+    };
+
     //!\brief Write record to format.
     template <typename seq_t, typename id_t, typename qual_t, typename seq_qual_t>
     void write_record(seq_t && seq, id_t && id, qual_t && qual, seq_qual_t && seq_qual)
@@ -587,26 +666,128 @@ protected:
             static_assert(detail::is_type_specialisation_of_v<value_type_t<seq_qual_t>, qualified>,
                           "The SEQ_QUAL field must contain a range over the seqan3::qualified alphabet.");
 
-        assert(!format.valueless_by_exception());
+        if (options.async_write || async_context)
+        {
+            write_record_async(owning_copy(seq), owning_copy(id), owning_copy(qual), owning_copy(seq_qual));
+        }
+        else
+        {
+            assert(!format.valueless_by_exception());
+            write_record(get_stream(), format, options, seq, id, qual, seq_qual);
+        }
+    }
+
+    /*!\brief Hand a record whose fields are owned by the arguments to the asynchronous writer.
+     * \throws Any exception thrown while writing a previous record; the writer is stopped before.
+     */
+    template <typename seq_t, typename id_t, typename qual_t, typename seq_qual_t>
+    void write_record_async(seq_t && seq, id_t && id, qual_t && qual, seq_qual_t && seq_qual)
+    {
+        if (!async_context)
+        {
+            assert(!format.valueless_by_exception());
+            async_context.reset(new async_context_type{&get_stream(), std::move(format), options});
+        }
+
+        auto write = [context = async_context.get()] (auto & record)
+        {
+            auto & [seq, id, qual, seq_qual] = record;
+            write_record(*context->stream, context->format, context->options, seq, id, qual, seq_qual);
+        };
+
+        try
+        {
+            async_context->writer.push(std::tuple{std::move(seq), std::move(id), std::move(qual), std::move(seq_qual)},
+                                       write);
+        }
+        catch (...)
+        {
+            finish_async_write(); // Rethrows the exception of the writer, if it failed.
+            throw;
+        }
+    }
+
+    /*!\brief Stops the asynchronous writer and moves the format back into the file, also if writing failed.
+     * \throws Any exception thrown while writing a record asynchronously.
+     */
+    void finish_async_write()
+    {
+        std::unique_ptr<async_context_type> context = std::move(async_context);
+        std::exception_ptr error{};
+
+        try
+        {
+            context->writer.finish();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        format = std::move(context->format);
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    //!\brief Write record to the given format and stream.
+    template <typename seq_t, typename id_t, typename qual_t, typename seq_qual_t>
+    static void write_record(std::basic_ostream<stream_char_type> & stream,
+                             format_type & f_variant,
+                             sequence_file_output_options const & opts,
+                             seq_t && seq,
+                             id_t && id,
+                             qual_t && qual,
+                             seq_qual_t && seq_qual)
+    {
         std::visit([&] (auto & f)
         {
             if constexpr (!detail::decays_to_ignore_v<seq_qual_t>)
             {
-                f.write_sequence_record(*secondary_stream,
-                                        options,
+                f.write_sequence_record(stream,
+                                        opts,
                                         seq_qual | views::get<0>,
                                         id,
                                         seq_qual | views::get<1>);
             }
             else
             {
-                f.write_sequence_record(*secondary_stream,
-                                        options,
+                f.write_sequence_record(stream,
+                                        opts,
                                         seq,
                                         id,
                                         qual);
             }
-        }, format);
+        }, f_variant);
+    }
+
+    //!\brief Copy a field into a container, so that it can be written after the caller's data has changed.
+    template <typename field_t>
+    static auto owning_copy(field_t && field)
+    {
+        if constexpr (detail::decays_to_ignore_v<field_t>)
+        {
+            return std::ignore;
+        }
+        else
+        {
+            std::vector<value_type_t<remove_cvref_t<field_t>>> copy{};
+
+            if constexpr (std::ranges::contiguous_range<field_t> && std::ranges::sized_range<field_t>)
+            {
+                copy.assign(std::ranges::data(field), std::ranges::data(field) + std::ranges::size(field));
+            }
+            else
+            {
+                if constexpr (std::ranges::sized_range<field_t>)
+                    copy.reserve(std::ranges::size(field));
+
+                for (auto && element : field)
+                    copy.push_back(element);
+            }
+
+            return copy;
+        }
     }
 
     //!\brief Befriend iterator so it can access the buffers.
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -40,6 +42,38 @@ struct sequence_file_output_options
 
     //!\brief Complete header given for embl or genbank
     bool        embl_genbank_complete_header  = false;
+
+    /*!\brief The compression level of files opened by filename with a compression extension, e.g. ".gz" or ".zst";
+     *        the default level of the compression if not set.
+     *
+     * \details
+     *
+     * BGZF (used for ".gz", ".bgzf" and ".bam" files) supports the levels 0 (no compression) to 9, or to 12 if
+     * libdeflate is available, and defaults to 1. zstd supports the levels 1 to 22 and negative levels for faster
+     * compression, and defaults to 3. For bzip2 the level selects the block size (1 to 9).
+     * The option must be set before the first record is written.
+     */
+    std::optional<int> compression_level{};
+
+    /*!\brief The number of threads compressing files opened by filename with a compression extension.
+     *
+     * \details
+     *
+     * If 0, seqan3::contrib::bgzf_thread_count threads are used for BGZF and seqan3::contrib::zstd_thread_count
+     * threads for zstd; bzip2 always uses a single thread. The option must be set before the first record is written.
+     */
+    size_t compression_threads = 0;
+
+    /*!\brief Whether the records are formatted and written by a separate thread.
+     *
+     * \details
+     *
+     * If set, seqan3::sequence_file_output::push_back copies the fields of the record and hands them to a writer
+     * thread. If the writer thread falls behind, push_back blocks until it has caught up. Exceptions thrown while
+     * writing are rethrown by the next push_back or by seqan3::sequence_file_output::flush. The option must be set
+     * before the first record is written; the other options cannot be changed while writing asynchronously.
+     */
+    bool async_write = false;
 };
 
 } // namespace seqan3
@@ -0,0 +1,241 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_record_batch.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <tuple>
+
+#include <seqan3/io/record.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A batch of sequence records that stores every field in a seqan3::concatenated_sequences.
+ * \ingroup sequence
+ * \tparam sequence_type The type of a single sequence, i.e. of seqan3::field::seq or seqan3::field::seq_qual.
+ * \tparam id_type       The type of a single id, i.e. of seqan3::field::id.
+ * \tparam quality_type  The type of a single quality sequence, i.e. of seqan3::field::qual.
+ *
+ * \details
+ *
+ * The batch is a column-based representation of multiple records: all sequences, ids and qualities are stored in
+ * one contiguous buffer per field. Clearing the batch keeps the allocated memory, such that refilling a batch of
+ * similar size does not allocate any memory. The columns can be passed as a whole to algorithms that take a range of
+ * sequences, e.g. seqan3::align_pairwise or seqan3::search.
+ *
+ * Fields that are not contained in the records that are appended stay empty, while size() always returns the
+ * number of appended records.
+ *
+ * You usually do not create this type yourself, but obtain it from seqan3::sequence_file_input::read_batch:
+ *
+ * \include test/snippet/io/sequence_file/sequence_file_input_read_batch.cpp
+ */
+template <typename sequence_type, typename id_type, typename quality_type>
+class sequence_record_batch
+{
+public:
+    //!\brief The type of the sequence column.
+    using sequences_type = concatenated_sequences<sequence_type>;
+    //!\brief The type of the id column.
+    using ids_type = concatenated_sequences<id_type>;
+    //!\brief The type of the quality column.
+    using qualities_type = concatenated_sequences<quality_type>;
+    //!\brief An unsigned integer type, usually std::size_t.
+    using size_type = size_t;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_record_batch() = default;                                          //!< Defaulted.
+    sequence_record_batch(sequence_record_batch const &) = default;             //!< Defaulted.
+    sequence_record_batch(sequence_record_batch &&) = default;                  //!< Defaulted.
+    sequence_record_batch & operator=(sequence_record_batch const &) = default; //!< Defaulted.
+    sequence_record_batch & operator=(sequence_record_batch &&) = default;      //!< Defaulted.
+    ~sequence_record_batch() = default;                                         //!< Defaulted.
+    //!\}
+
+    /*!\name Columns
+     * \{
+     */
+    //!\brief The sequences of all records; contains seqan3::field::seq or seqan3::field::seq_qual.
+    sequences_type const & sequences() const noexcept
+    {
+        return sequence_column;
+    }
+
+    //!\brief The ids of all records.
+    ids_type const & ids() const noexcept
+    {
+        return id_column;
+    }
+
+    //!\brief The qualities of all records.
+    qualities_type const & qualities() const noexcept
+    {
+        return quality_column;
+    }
+    //!\}
+
+    /*!\name Capacity and modifiers
+     * \{
+     */
+    //!\brief Returns the number of records in the batch.
+    size_type size() const noexcept
+    {
+        return record_count;
+    }
+
+    //!\brief Returns whether the batch contains no records.
+    bool empty() const noexcept
+    {
+        return record_count == 0;
+    }
+
+    /*!\brief Removes all records, but keeps the allocated memory.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of records.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void clear() noexcept
+    {
+        sequence_column.clear();
+        id_column.clear();
+        quality_column.clear();
+        record_count = 0;
+    }
+
+    /*!\brief Appends the fields of the given record to the columns.
+     * \tparam field_types The types of the fields of the record.
+     * \tparam field_ids   The seqan3::field IDs of the record.
+     * \param[in] r The record to append.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Amortised linear in the size of the fields.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    template <typename field_types, typename field_ids>
+    void push_back(record<field_types, field_ids> const & r)
+    {
+        if constexpr (field_ids::contains(field::seq))
+            sequence_column.push_back(get<field::seq>(r));
+        else if constexpr (field_ids::contains(field::seq_qual))
+            sequence_column.push_back(get<field::seq_qual>(r));
+
+        if constexpr (field_ids::contains(field::id))
+            id_column.push_back(get<field::id>(r));
+
+        if constexpr (field_ids::contains(field::qual))
+            quality_column.push_back(get<field::qual>(r));
+
+        ++record_count;
+    }
+
+    /*!\brief Appends a record whose fields are parsed directly into the columns.
+     * \tparam field_ids The seqan3::field IDs of the fields that are parsed.
+     * \tparam parse_t   The type of the parse function.
+     * \param[in] parse The function that appends the fields of one record to the containers it is invoked with.
+     *
+     * \details
+     *
+     * The function is invoked with the underlying containers of the sequence, id and quality columns, or with
+     * std::ignore for the columns of fields that are not contained in `field_ids`. It must only append to the
+     * containers. This avoids parsing the record into a seqan3::record and copying it into the batch afterwards.
+     *
+     * ### Complexity
+     *
+     * Amortised linear in the size of the appended fields.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee if `parse` only appends: the fields appended by a throwing `parse` are removed.
+     */
+    template <typename field_ids, typename parse_t>
+    void push_back_parsed(parse_t && parse)
+    {
+        constexpr bool has_sequence = field_ids::contains(field::seq) || field_ids::contains(field::seq_qual);
+        constexpr bool has_id = field_ids::contains(field::id);
+        constexpr bool has_quality = field_ids::contains(field::qual);
+
+        try
+        {
+            parse(values_or_ignore<has_sequence>(sequence_column),
+                  values_or_ignore<has_id>(id_column),
+                  values_or_ignore<has_quality>(quality_column));
+        }
+        catch (...)
+        {
+            finish_column<has_sequence>(sequence_column, false);
+            finish_column<has_id>(id_column, false);
+            finish_column<has_quality>(quality_column, false);
+            throw;
+        }
+
+        finish_column<has_sequence>(sequence_column, true);
+        finish_column<has_id>(id_column, true);
+        finish_column<has_quality>(quality_column, true);
+        ++record_count;
+    }
+    //!\}
+
+private:
+    //!\brief Returns the underlying container of the column if `contained` is true, and std::ignore otherwise.
+    template <bool contained, typename column_type>
+    static auto & values_or_ignore(column_type & column) noexcept
+    {
+        if constexpr (contained)
+            return column.raw_data().first;
+        else
+            return std::ignore;
+    }
+
+    /*!\brief Adds the values appended to the underlying container of the column as new element or removes them.
+     * \param[in] column The column.
+     * \param[in] keep   Whether the values form a new element or are removed.
+     */
+    template <bool contained, typename column_type>
+    static void finish_column(column_type & column, bool const keep)
+    {
+        if constexpr (contained)
+        {
+            auto & values = column.raw_data().first;
+            auto & delimiters = column.raw_data().second;
+
+            if (keep)
+                delimiters.push_back(values.size());
+            else
+                values.erase(values.begin() + delimiters.back(), values.end());
+        }
+    }
+
+    //!\brief The concatenated sequences.
+    sequences_type sequence_column{};
+    //!\brief The concatenated ids.
+    ids_type id_column{};
+    //!\brief The concatenated qualities.
+    qualities_type quality_column{};
+    //!\brief The number of records.
+    size_type record_count{0};
+};
+
+} // namespace seqan3
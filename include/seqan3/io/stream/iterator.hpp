@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <cassert>
 #include <iterator>
+#include <string_view>
 
 #ifndef __cpp_lib_ranges
 #include <range/v3/iterator/stream_iterators.hpp>
@@ -136,6 +138,39 @@ public:
         return *stream_buf->gptr();
     }
 
+    /*!\name Buffer access
+     * \brief Allows to process the buffered characters in bulk instead of one character at a time.
+     * \{
+     */
+    /*!\brief Returns the currently buffered characters beginning with the current position (no vtable lookup).
+     *
+     * \details
+     *
+     * The returned view is only empty at the end of the input. It is invalidated by every operation that advances
+     * the iterator.
+     */
+    std::basic_string_view<char_t, traits_t> buffered_chars() const noexcept
+    {
+        assert(stream_buf != nullptr);
+        return {stream_buf->gptr(), static_cast<size_t>(stream_buf->egptr() - stream_buf->gptr())};
+    }
+
+    /*!\brief Advances by the given number of buffered characters and rebuffers if necessary (vtable lookup iff
+     *        rebuffering).
+     * \param count The number of characters to skip; must not be greater than the size of
+     *              seqan3::detail::fast_istreambuf_iterator::buffered_chars.
+     */
+    void skip_buffered(size_t const count)
+    {
+        assert(stream_buf != nullptr);
+        assert(count <= static_cast<size_t>(stream_buf->egptr() - stream_buf->gptr()));
+
+        stream_buf->gbump(static_cast<int>(count));
+        if (stream_buf->gptr() == stream_buf->egptr())
+            stream_buf->underflow();
+    }
+    //!\}
+
     /*!\name Comparison operators
      * \brief We define comparison only against the sentinel.
      * \{
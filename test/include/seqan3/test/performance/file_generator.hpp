@@ -0,0 +1,166 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides generators for the contents of FASTQ and SAM files for the I/O benchmarks.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::test
+{
+
+/*!\brief The length of the reads generated by seqan3::test::generate_fastq_file and
+ *        seqan3::test::generate_sam_file.
+ */
+inline constexpr size_t generated_read_length = 150;
+
+/*!\brief Appends a random read of seqan3::test::generated_read_length bases; about every thousandth base is an N.
+ * \param[in,out] out The string to append to.
+ * \param[in,out] gen The random number generator.
+ */
+inline void generate_read_sequence(std::string & out, std::mt19937 & gen)
+{
+    std::uniform_int_distribution<size_t> dis_base(0, 999);
+
+    for (size_t i = 0; i < generated_read_length; ++i)
+    {
+        size_t const r = dis_base(gen);
+        out.push_back(r == 0 ? 'N' : "ACGT"[r % 4]);
+    }
+}
+
+/*!\brief Appends Illumina-like qualities for a read of seqan3::test::generated_read_length bases.
+ * \param[in,out] out The string to append to.
+ * \param[in,out] gen The random number generator.
+ *
+ * \details
+ *
+ * The mean Phred score decreases from 38 at the beginning of the read to 28 at its end, every score varies around
+ * the mean and some reads end with a run of '#' (Phred score 2), like reads trimmed by the Illumina pipeline.
+ */
+inline void generate_read_qualities(std::string & out, std::mt19937 & gen)
+{
+    std::normal_distribution<double> dis_noise(0.0, 3.0);
+    std::uniform_int_distribution<size_t> dis_trim(0, 9);
+
+    size_t const trimmed_from = dis_trim(gen) == 0 ? generated_read_length - 20 : generated_read_length;
+
+    for (size_t i = 0; i < generated_read_length; ++i)
+    {
+        double const relative_position = static_cast<double>(i) / generated_read_length;
+        double const mean = 38.0 - 10.0 * relative_position * relative_position;
+        int const phred = (i >= trimmed_from) ? 2 : std::clamp(static_cast<int>(mean + dis_noise(gen)), 2, 41);
+        out.push_back(static_cast<char>('!' + phred));
+    }
+}
+
+/*!\brief Generates the content of a FASTQ file with reads of seqan3::test::generated_read_length bases.
+ * \param[in] record_count The number of records.
+ * \param[in] seed         The seed of the random number generator.
+ */
+inline std::string generate_fastq_file(size_t const record_count, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::string file{};
+    file.reserve(record_count * (2 * generated_read_length + 48));
+
+    for (size_t i = 0; i < record_count; ++i)
+    {
+        file += "@SRR062634." + std::to_string(i + 1) + " HWI-ST1234:8:1101:" + std::to_string(1000 + i % 20000) +
+                ":" + std::to_string(2000 + i % 30000) + " length=150\n";
+        generate_read_sequence(file, gen);
+        file += "\n+\n";
+        generate_read_qualities(file, gen);
+        file += '\n';
+    }
+
+    return file;
+}
+
+/*!\brief Generates the content of a coordinate-sorted SAM file with paired reads of
+ *        seqan3::test::generated_read_length bases.
+ * \param[in] record_count The number of records.
+ * \param[in] with_tags    Whether the records have the tags NM, MD, AS, XS and RG, like the output of BWA.
+ * \param[in] seed         The seed of the random number generator.
+ *
+ * \details
+ *
+ * Most reads are aligned without gaps; some are soft-clipped or contain an insertion or a deletion.
+ */
+inline std::string generate_sam_file(size_t const record_count, bool const with_tags, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> dis_percent(0, 99);
+    std::uniform_int_distribution<size_t> dis_gap(0, 299);
+    std::uniform_int_distribution<size_t> dis_insert_size(200, 500);
+    std::uniform_int_distribution<size_t> dis_mismatch(0, 149);
+
+    std::string file{"@HD\tVN:1.6\tSO:coordinate\n"
+                     "@SQ\tSN:chr1\tLN:248956422\n"
+                     "@SQ\tSN:chr2\tLN:242193529\n"
+                     "@SQ\tSN:chr3\tLN:198295559\n"
+                     "@RG\tID:group1\tSM:sample1\tPL:ILLUMINA\n"
+                     "@PG\tID:bwa\tPN:bwa\tVN:0.7.17\n"};
+    file.reserve(file.size() + record_count * (2 * generated_read_length + (with_tags ? 140 : 80)));
+
+    char const * const chromosomes[] = {"chr1", "chr2", "chr3"};
+    size_t const records_per_chromosome = std::max<size_t>(record_count / 6 * 2, 2); // keep pairs together
+    size_t chromosome = 0;
+    size_t position = 10'000;
+
+    for (size_t i = 0; i < record_count; ++i)
+    {
+        if (size_t const current = std::min<size_t>(i / records_per_chromosome, 2); current != chromosome)
+        {
+            chromosome = current;
+            position = 10'000;
+        }
+
+        position += dis_gap(gen);
+
+        bool const first_in_pair = i % 2 == 0;
+        size_t const insert_size = dis_insert_size(gen);
+        size_t const kind = dis_percent(gen);
+        char const * const cigar = kind < 80 ? "150M" : kind < 90 ? "5S145M" : kind < 95 ? "70M2I78M" : "60M3D90M";
+        size_t const mismatches = kind % 4;
+
+        file += "SRR062634." + std::to_string(i / 2 + 1) + '\t' + (first_in_pair ? "99" : "147") + '\t' +
+                chromosomes[chromosome] + '\t' + std::to_string(position) +
+                '\t' + (kind % 10 == 0 ? std::to_string(kind % 60) : std::string{"60"}) + '\t' + cigar + "\t=\t" +
+                std::to_string(first_in_pair ? position + insert_size - generated_read_length
+                                             : position + generated_read_length - insert_size) + '\t' +
+                (first_in_pair ? "" : "-") + std::to_string(insert_size) + '\t';
+        generate_read_sequence(file, gen);
+        file += '\t';
+        generate_read_qualities(file, gen);
+
+        if (with_tags)
+        {
+            size_t const mismatch_position = dis_mismatch(gen);
+            file += "\tNM:i:" + std::to_string(mismatches) + "\tMD:Z:" +
+                    (mismatches == 0 ? std::string{"150"}
+                                     : std::to_string(mismatch_position) + "A" +
+                                       std::to_string(149 - mismatch_position)) +
+                    "\tAS:i:" + std::to_string(150 - 5 * mismatches) + "\tXS:i:" + std::to_string(kind) +
+                    "\tRG:Z:group1";
+        }
+
+        file += '\n';
+    }
+
+    return file;
+}
+
+} // namespace seqan3::test
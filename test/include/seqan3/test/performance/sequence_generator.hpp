@@ -13,6 +13,8 @@
 #pragma once
 
 #include <random>
+#include <utility>
+#include <vector>
 
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/test/seqan2.hpp>
@@ -72,6 +74,74 @@ auto generate_sequence_pairs(size_t const sequence_length, size_t const set_size
     return vec;
 }
 
+/*!\brief Generates a mutated copy of the given sequence.
+ * \param sequence   The sequence to mutate.
+ * \param divergence The percentage of positions to mutate; every mutation is either a substitution, an insertion or
+ *                   a deletion with equal probability.
+ * \param seed       The seed for the random number generator.
+ */
+template <typename alphabet_t>
+auto generate_divergent_sequence(std::vector<alphabet_t> const & sequence,
+                                 size_t const divergence,
+                                 size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> dis_alpha(0ull, alphabet_size<alphabet_t> - 1ull);
+    std::uniform_int_distribution<size_t> dis_percent(0ull, 99ull);
+    std::uniform_int_distribution<size_t> dis_mutation(0ull, 2ull);
+
+    std::vector<alphabet_t> mutated_sequence;
+    mutated_sequence.reserve(sequence.size());
+
+    for (alphabet_t const value : sequence)
+    {
+        if (dis_percent(gen) >= divergence)
+        {
+            mutated_sequence.push_back(value);
+            continue;
+        }
+
+        switch (dis_mutation(gen))
+        {
+            case 0: // substitution with a different letter
+                mutated_sequence.push_back(assign_rank_to((to_rank(value) + 1 + dis_alpha(gen) %
+                                                           (alphabet_size<alphabet_t> - 1)) %
+                                                          alphabet_size<alphabet_t>, alphabet_t{}));
+                break;
+            case 1: // insertion of a random letter
+                mutated_sequence.push_back(assign_rank_to(dis_alpha(gen), alphabet_t{}));
+                mutated_sequence.push_back(value);
+                break;
+            default: // deletion
+                break;
+        }
+    }
+
+    return mutated_sequence;
+}
+
+/*!\brief Generates pairs of sequences, where the second sequence is a mutated copy of the first one.
+ * \param sequence_length The length of the first sequence of every pair.
+ * \param divergence      The percentage of mutated positions in the second sequence of every pair.
+ * \param set_size        The number of sequence pairs.
+ */
+template <typename alphabet_t>
+auto generate_divergent_sequence_pairs(size_t const sequence_length, size_t const divergence, size_t const set_size)
+{
+    using sequence_t = decltype(generate_sequence<alphabet_t>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+
+    for (unsigned i = 0; i < set_size; ++i)
+    {
+        sequence_t seq1 = generate_sequence<alphabet_t>(sequence_length, 0, i);
+        sequence_t seq2 = generate_divergent_sequence(seq1, divergence, i + set_size);
+        vec.push_back(std::pair{std::move(seq1), std::move(seq2)});
+    }
+
+    return vec;
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 template <typename alphabet_t>
 auto generate_sequence_seqan2(size_t const len = 500,
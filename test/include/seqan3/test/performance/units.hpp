@@ -14,6 +14,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/core/platform.hpp>
@@ -34,13 +38,51 @@ inline benchmark::Counter bytes_per_second(size_t bytes)
                               benchmark::Counter::OneK::kIs1024);
 }
 
-//!\brief Calculates the number of cell updates for given sequences for a specific alignment config.
+/*!\brief This returns a counter which represents how many records were read or written per second.
+ *
+ * \param  records The total number of records processed of a complete benchmark run.
+ * \return         Returns a benchmark Counter which represents records/s.
+ */
+inline benchmark::Counter records_per_second(size_t records)
+{
+    return benchmark::Counter(records,
+                              benchmark::Counter::kIsIterationInvariantRate,
+                              benchmark::Counter::OneK::kIs1000);
+}
+
+/*!\brief Calculates the number of cell updates for given sequences for a specific alignment config.
+ *
+ * \details
+ *
+ * If the configuration contains a seqan3::align_cfg::band, only the cells within the band are counted.
+ */
 template <typename sequences_range_t>
-inline size_t pairwise_cell_updates(sequences_range_t const & sequences_range, auto && /*align_cfg*/)
+inline size_t pairwise_cell_updates(sequences_range_t const & sequences_range, auto && align_cfg)
 {
+    using config_t = remove_cvref_t<decltype(align_cfg)>;
+
     size_t matrix_cells = 0u;
     for (auto && [seq1, seq2]: sequences_range)
-        matrix_cells += (std::ranges::size(seq1) + 1) * (std::ranges::size(seq2) + 1);
+    {
+        int64_t const columns = std::ranges::size(seq1) + 1;
+        int64_t const rows = std::ranges::size(seq2) + 1;
+
+        if constexpr (config_t::template exists<seqan3::align_cfg::band>())
+        {
+            // Only count the cells (row, column) with lower_bound <= column - row <= upper_bound.
+            auto const & band = seqan3::get<seqan3::align_cfg::band>(align_cfg).value;
+            for (int64_t column = 0; column < columns; ++column)
+            {
+                int64_t const first_row = std::max<int64_t>(0, column - band.upper_bound);
+                int64_t const last_row = std::min<int64_t>(rows - 1, column - band.lower_bound);
+                matrix_cells += std::max<int64_t>(0, last_row - first_row + 1);
+            }
+        }
+        else
+        {
+            matrix_cells += columns * rows;
+        }
+    }
     return matrix_cells;
 }
 
@@ -56,4 +98,16 @@ inline benchmark::Counter cell_updates_per_second(size_t cells)
                               benchmark::Counter::OneK::kIs1000);
 }
 
+/*!\brief This returns a counter which represents how many sequence pairs were aligned per second.
+ *
+ * \param  pairs The total number of sequence pairs processed of a complete benchmark run.
+ * \return       Returns a benchmark Counter which represents pairs/s.
+ */
+inline benchmark::Counter pairs_per_second(size_t pairs)
+{
+    return benchmark::Counter(pairs,
+                              benchmark::Counter::kIsIterationInvariantRate,
+                              benchmark::Counter::OneK::kIs1000);
+}
+
 } // namespace seqan3::test
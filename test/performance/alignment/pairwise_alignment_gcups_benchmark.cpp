@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+using namespace seqan3::test;
+
+// This benchmark sweeps the pairwise alignment over different workloads and reports the cell updates per second
+// (CUPS) as well as the aligned sequence pairs per second. The arguments of every benchmark are:
+//
+// 0: the sequence length,
+// 1: the divergence in percent between both sequences of a pair,
+// 2: the number of threads; 0 computes the alignments without seqan3::align_cfg::parallel.
+
+// Aliases to beautify the benchmark output
+using score = seqan3::detail::with_score_type;
+using trace = seqan3::detail::with_alignment_type;
+using global = seqan3::detail::global_alignment_type;
+using local = seqan3::detail::local_alignment_type;
+
+//!\brief Tag to compute the alignment with a band as wide as the expected number of mutations.
+struct banded {};
+//!\brief Tag to compute the alignment without a band.
+struct unbanded {};
+//!\brief Tag to compute the alignment with scalar instructions.
+struct scalar {};
+//!\brief Tag to compute the alignment with seqan3::align_cfg::vectorise.
+struct vectorised {};
+
+// Align roughly the same number of residues independent of the sequence length.
+inline constexpr size_t total_residues = 200'000;
+
+template <typename mode_t, typename band_t, typename execution_t, typename result_t>
+auto make_config(size_t const sequence_length, size_t const divergence)
+{
+    auto cfg = seqan3::align_cfg::mode{mode_t{}} |
+               seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+               seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                            seqan3::mismatch_score{-5}}} |
+               seqan3::align_cfg::result{result_t{}};
+
+    if constexpr (std::same_as<band_t, banded>)
+    {
+        int64_t const width = std::max<int64_t>(10, sequence_length * divergence / 100);
+        return cfg | seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-width},
+                                                                 seqan3::upper_bound{width}}};
+    }
+    else if constexpr (std::same_as<execution_t, vectorised>)
+    {
+        return cfg | seqan3::align_cfg::vectorise;
+    }
+    else
+    {
+        return cfg;
+    }
+}
+
+template <typename mode_t, typename band_t, typename execution_t, typename result_t>
+void seqan3_affine_dna4(benchmark::State & state)
+{
+    size_t const sequence_length = state.range(0);
+    size_t const divergence = state.range(1);
+    size_t const thread_count = state.range(2);
+    size_t const set_size = std::max<size_t>(1, total_residues / sequence_length);
+
+    auto sequences = generate_divergent_sequence_pairs<seqan3::dna4>(sequence_length, divergence, set_size);
+    auto cfg = make_config<mode_t, band_t, execution_t, result_t>(sequence_length, divergence);
+
+    auto run = [&] (auto const & run_cfg)
+    {
+        int64_t total = 0;
+        for (auto _ : state)
+        {
+            for (auto && res : seqan3::align_pairwise(sequences, run_cfg))
+                total += res.score();
+        }
+
+        state.counters["cells"] = pairwise_cell_updates(sequences, run_cfg);
+        state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+        state.counters["pairs"] = pairs_per_second(sequences.size());
+        state.counters["total"] = total;
+    };
+
+    if (thread_count == 0)
+        run(cfg);
+    else
+        run(cfg | seqan3::align_cfg::parallel{thread_count});
+}
+
+// Sweeps the sequence length and the divergence without seqan3::align_cfg::parallel.
+static void length_and_divergence_arguments(benchmark::internal::Benchmark * b)
+{
+    for (int64_t sequence_length : {100, 250, 1'000, 5'000})
+    {
+        for (int64_t divergence : {1, 5, 15})
+        {
+            b->Args({sequence_length, divergence, 0});
+        }
+    }
+}
+
+// Sweeps the number of threads for a fixed workload, starting with the sequential computation as baseline.
+static void thread_arguments(benchmark::internal::Benchmark * b)
+{
+    int64_t const max_threads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+
+    b->Args({250, 5, 0});
+
+    for (int64_t thread_count = 1; thread_count < max_threads; thread_count *= 2)
+        b->Args({250, 5, thread_count});
+
+    b->Args({250, 5, max_threads});
+}
+
+// ============================================================================
+//  global; score vs. trace; unbanded vs. banded; scalar
+// ============================================================================
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, unbanded, scalar, score)->Apply(length_and_divergence_arguments);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, unbanded, scalar, trace)->Apply(length_and_divergence_arguments);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, banded, scalar, score)->Apply(length_and_divergence_arguments);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, banded, scalar, trace)->Apply(length_and_divergence_arguments);
+
+// ============================================================================
+//  local; score vs. trace; unbanded vs. banded; scalar
+// ============================================================================
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, local, unbanded, scalar, score)->Apply(length_and_divergence_arguments);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, local, unbanded, scalar, trace)->Apply(length_and_divergence_arguments);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, local, banded, scalar, score)->Apply(length_and_divergence_arguments);
+
+// ============================================================================
+//  global; score; unbanded; vectorised
+// ============================================================================
+
+// The vectorised alignment only supports the unbanded score computation.
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, unbanded, vectorised, score)->Apply(length_and_divergence_arguments);
+
+// ============================================================================
+//  thread scaling
+// ============================================================================
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, unbanded, scalar, score)->Apply(thread_arguments)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, unbanded, scalar, trace)->Apply(thread_arguments)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, global, unbanded, vectorised, score)->Apply(thread_arguments)->UseRealTime();
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,209 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#ifdef SEQAN3_HAS_BZIP2
+    #include <seqan3/contrib/stream/bz2_istream.hpp>
+    #include <seqan3/contrib/stream/bz2_ostream.hpp>
+#endif
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+    #include <seqan3/contrib/stream/gz_istream.hpp>
+    #include <seqan3/contrib/stream/gz_ostream.hpp>
+#endif
+
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_istream.hpp>
+    #include <seqan3/contrib/stream/zstd_ostream.hpp>
+#endif
+
+#include <seqan3/test/performance/file_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3::test;
+
+// About 34 MiB of Illumina-like FASTQ records.
+std::string const input = generate_fastq_file(100'000);
+
+// Writes the input to the compression stream and returns the compressed data.
+template <typename ostream_t, typename ...args_t>
+std::string compress(args_t && ...args)
+{
+    std::ostringstream out{};
+
+    {
+        ostream_t compressed_stream{out, std::forward<args_t>(args)...};
+        compressed_stream.write(input.data(), input.size());
+    }
+
+    return out.str();
+}
+
+// Reads the complete decompression stream.
+template <typename istream_t>
+void decompress(std::string const & compressed)
+{
+    std::istringstream in{compressed};
+    istream_t decompressed_stream{in};
+    std::string buffer(1 << 16, '\0');
+
+    while (decompressed_stream.read(buffer.data(), buffer.size()))
+        benchmark::DoNotOptimize(buffer.data());
+}
+
+// ============================================================================
+//  GZip
+// ============================================================================
+
+#ifdef SEQAN3_HAS_ZLIB
+void gz_compress(benchmark::State & state)
+{
+    size_t const level = state.range(0);
+    size_t compressed_size{};
+
+    for (auto _ : state)
+        compressed_size = compress<seqan3::contrib::gz_ostream>(level).size();
+
+    state.counters["compression_ratio"] = static_cast<double>(input.size()) / compressed_size;
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(gz_compress)->Arg(1)->Arg(6)->Arg(9);
+
+void gz_decompress(benchmark::State & state)
+{
+    std::string const compressed = compress<seqan3::contrib::gz_ostream>();
+
+    for (auto _ : state)
+        decompress<seqan3::contrib::gz_istream>(compressed);
+
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(gz_decompress);
+#endif // SEQAN3_HAS_ZLIB
+
+// ============================================================================
+//  BGZF (zlib or libdeflate)
+// ============================================================================
+
+#ifdef SEQAN3_HAS_ZLIB
+// The first argument is the compression level, the second the number of threads.
+void bgzf_arguments(benchmark::internal::Benchmark * b)
+{
+    for (int level : {0, 1, 6, 9})
+        for (int threads : {1, 4})
+            b->Args({level, threads});
+}
+
+void bgzf_compress(benchmark::State & state)
+{
+    int const level = state.range(0);
+    size_t const threads = state.range(1);
+    size_t compressed_size{};
+
+    for (auto _ : state)
+        compressed_size = compress<seqan3::contrib::bgzf_ostream>(level, threads).size();
+
+    state.counters["compression_ratio"] = static_cast<double>(input.size()) / compressed_size;
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(bgzf_compress)->Apply(bgzf_arguments)->UseRealTime();
+
+void bgzf_decompress(benchmark::State & state)
+{
+    size_t const threads = state.range(0);
+    std::string const compressed = compress<seqan3::contrib::bgzf_ostream>();
+    size_t const default_thread_count = seqan3::contrib::bgzf_thread_count;
+    seqan3::contrib::bgzf_thread_count = threads; // the decompression stream has no thread argument
+
+    for (auto _ : state)
+        decompress<seqan3::contrib::bgzf_istream>(compressed);
+
+    seqan3::contrib::bgzf_thread_count = default_thread_count;
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(bgzf_decompress)->Arg(1)->Arg(4)->UseRealTime();
+#endif // SEQAN3_HAS_ZLIB
+
+// ============================================================================
+//  zstd
+// ============================================================================
+
+#ifdef SEQAN3_HAS_ZSTD
+// The first argument is the compression level, the second the number of threads.
+void zstd_arguments(benchmark::internal::Benchmark * b)
+{
+    for (int level : {1, 3, 9, 19})
+        for (int threads : {1, 4})
+            b->Args({level, threads});
+}
+
+void zstd_compress(benchmark::State & state)
+{
+    int const level = state.range(0);
+    size_t const threads = state.range(1);
+    size_t compressed_size{};
+
+    for (auto _ : state)
+        compressed_size = compress<seqan3::contrib::zstd_ostream>(level, threads).size();
+
+    state.counters["compression_ratio"] = static_cast<double>(input.size()) / compressed_size;
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(zstd_compress)->Apply(zstd_arguments)->UseRealTime();
+
+void zstd_decompress(benchmark::State & state)
+{
+    std::string const compressed = compress<seqan3::contrib::zstd_ostream>();
+
+    for (auto _ : state)
+        decompress<seqan3::contrib::zstd_istream>(compressed);
+
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(zstd_decompress)->UseRealTime();
+#endif // SEQAN3_HAS_ZSTD
+
+// ============================================================================
+//  BZip2
+// ============================================================================
+
+#ifdef SEQAN3_HAS_BZIP2
+// The argument is the block size in units of 100 kB.
+void bz2_compress(benchmark::State & state)
+{
+    size_t const block_size = state.range(0);
+    size_t compressed_size{};
+
+    for (auto _ : state)
+        compressed_size = compress<seqan3::contrib::bz2_ostream>(block_size).size();
+
+    state.counters["compression_ratio"] = static_cast<double>(input.size()) / compressed_size;
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(bz2_compress)->Arg(1)->Arg(9);
+
+void bz2_decompress(benchmark::State & state)
+{
+    std::string const compressed = compress<seqan3::contrib::bz2_ostream>();
+
+    for (auto _ : state)
+        decompress<seqan3::contrib::bz2_istream>(compressed);
+
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+BENCHMARK(bz2_decompress);
+#endif // SEQAN3_HAS_BZIP2
+
+BENCHMARK_MAIN();
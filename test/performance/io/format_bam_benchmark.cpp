@@ -0,0 +1,258 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/io/alignment_file/bam_packed_sequence.hpp>
+#include <seqan3/io/alignment_file/format_bam.hpp>
+#include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/file_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3::test;
+
+inline constexpr size_t iterations_per_run = 1024;
+
+using bam_fields = seqan3::fields<seqan3::field::id, seqan3::field::seq, seqan3::field::qual>;
+
+inline std::string const bam_seq{
+    "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"
+    "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"};
+inline std::string const bam_qual = [] ()
+{
+    std::string qual{};
+    for (size_t i = 0; i < bam_seq.size(); ++i)
+        qual.push_back(static_cast<char>('!' + (i * 7) % 42));
+    return qual;
+}();
+
+// The packed bases and the Phred scores of iterations_per_run records, as stored in a BAM file.
+inline std::string const packed_bases = [] ()
+{
+    std::string packed{};
+    for (size_t i = 0; i < iterations_per_run; ++i)
+        seqan3::detail::encode_bam_bases(bam_seq | seqan3::views::char_to<seqan3::dna5>, bam_seq.size(), packed);
+    return packed;
+}();
+
+inline std::string const phred_scores = [] ()
+{
+    std::string scores{};
+    for (size_t i = 0; i < iterations_per_run; ++i)
+        for (char chr : bam_qual)
+            scores.push_back(static_cast<char>(chr - '!'));
+    return scores;
+}();
+
+// Converts the packed bases of all records to the given alphabet.
+template <typename alphabet_t>
+void decode_bases(benchmark::State & state)
+{
+    std::vector<alphabet_t> bases(packed_bases.size() * 2);
+
+    for (auto _ : state)
+    {
+        seqan3::detail::decode_bam_bases<alphabet_t>(packed_bases.data(), 0, bases.size(), bases.data());
+        benchmark::DoNotOptimize(bases.data());
+    }
+
+    state.counters["bytes_per_run"] = packed_bases.size();
+    state.counters["bytes_per_second"] = bytes_per_second(packed_bases.size());
+}
+BENCHMARK_TEMPLATE(decode_bases, seqan3::dna4);
+BENCHMARK_TEMPLATE(decode_bases, seqan3::dna5);
+BENCHMARK_TEMPLATE(decode_bases, seqan3::dna15);
+BENCHMARK_TEMPLATE(decode_bases, seqan3::sam_dna16);
+
+// Packs the bases of all records.
+template <typename alphabet_t>
+void encode_bases(benchmark::State & state)
+{
+    std::vector<alphabet_t> bases(packed_bases.size() * 2);
+    seqan3::detail::decode_bam_bases<alphabet_t>(packed_bases.data(), 0, bases.size(), bases.data());
+    std::string packed{};
+
+    for (auto _ : state)
+    {
+        packed.clear();
+        seqan3::detail::encode_bam_bases(bases, bases.size(), packed);
+        benchmark::DoNotOptimize(packed.data());
+    }
+
+    state.counters["bytes_per_run"] = packed_bases.size();
+    state.counters["bytes_per_second"] = bytes_per_second(packed_bases.size());
+}
+BENCHMARK_TEMPLATE(encode_bases, seqan3::dna4);
+BENCHMARK_TEMPLATE(encode_bases, seqan3::dna5);
+BENCHMARK_TEMPLATE(encode_bases, seqan3::dna15);
+BENCHMARK_TEMPLATE(encode_bases, seqan3::sam_dna16);
+
+// Converts the Phred scores of all records to qualities.
+void decode_qualities(benchmark::State & state)
+{
+    std::vector<seqan3::phred42> qualities(phred_scores.size());
+
+    for (auto _ : state)
+    {
+        seqan3::detail::decode_bam_qualities<seqan3::phred42>(phred_scores.data(), qualities.size(), qualities.data());
+        benchmark::DoNotOptimize(qualities.data());
+    }
+
+    state.counters["bytes_per_run"] = phred_scores.size();
+    state.counters["bytes_per_second"] = bytes_per_second(phred_scores.size());
+}
+BENCHMARK(decode_qualities);
+
+// Writes records that only store an id, a sequence and qualities.
+void write_bam(benchmark::State & state)
+{
+    std::ostringstream ostream;
+    seqan3::alignment_file_output fout{ostream, seqan3::format_bam{}, bam_fields{}};
+
+    auto seq = bam_seq | seqan3::views::char_to<seqan3::dna5> | seqan3::views::to<std::vector>;
+    auto qual = bam_qual | seqan3::views::char_to<seqan3::phred42> | seqan3::views::to<std::vector>;
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            fout.emplace_back("read", seq, qual);
+    }
+
+    ostream = std::ostringstream{};
+    fout.emplace_back("read", seq, qual); // the header has already been written
+    size_t bytes_per_run = ostream.str().size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = records_per_second(iterations_per_run);
+}
+BENCHMARK(write_bam);
+
+// Reads the records written by write_bam.
+void read_bam(benchmark::State & state)
+{
+    std::ostringstream ostream;
+
+    {
+        seqan3::alignment_file_output fout{ostream, seqan3::format_bam{}, bam_fields{}};
+        auto seq = bam_seq | seqan3::views::char_to<seqan3::dna5> | seqan3::views::to<std::vector>;
+        auto qual = bam_qual | seqan3::views::char_to<seqan3::phred42> | seqan3::views::to<std::vector>;
+
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            fout.emplace_back("read", seq, qual);
+    }
+
+    std::string const bam_file = ostream.str();
+
+    for (auto _ : state)
+    {
+        std::istringstream istream{bam_file};
+        seqan3::alignment_file_input fin{istream, seqan3::format_bam{}, bam_fields{}};
+
+        auto it = fin.begin();
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            it++;
+    }
+
+    size_t bytes_per_run = bam_file.size();
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = records_per_second(iterations_per_run);
+}
+BENCHMARK(read_bam);
+
+// ============================================================================
+//  BWA-like records
+// ============================================================================
+
+inline constexpr size_t generated_records = 100'000;
+
+using alignment_fields = seqan3::fields<seqan3::field::header_ptr,
+                                        seqan3::field::id,
+                                        seqan3::field::flag,
+                                        seqan3::field::ref_id,
+                                        seqan3::field::ref_offset,
+                                        seqan3::field::mapq,
+                                        seqan3::field::cigar,
+                                        seqan3::field::mate,
+                                        seqan3::field::seq,
+                                        seqan3::field::qual,
+                                        seqan3::field::tags>;
+
+// Converts a generated SAM file to BAM; the BAM file is not compressed to measure the format alone.
+std::string generate_bam_file(bool const with_tags)
+{
+    std::istringstream istream{generate_sam_file(generated_records, with_tags)};
+    seqan3::alignment_file_input fin{istream, seqan3::format_sam{}, alignment_fields{}};
+    std::ostringstream ostream{};
+
+    {
+        seqan3::alignment_file_output fout{ostream, seqan3::format_bam{}, alignment_fields{}};
+        fout = fin;
+    }
+
+    return ostream.str();
+}
+
+// Reads a generated file; the argument selects whether the records have tags.
+void read_bam_records(benchmark::State & state)
+{
+    std::string const bam_file = generate_bam_file(state.range(0) != 0);
+
+    for (auto _ : state)
+    {
+        std::istringstream istream{bam_file};
+        seqan3::alignment_file_input fin{istream, seqan3::format_bam{}, alignment_fields{}};
+
+        for (auto & record : fin)
+            benchmark::DoNotOptimize(record);
+    }
+
+    state.counters["bytes_per_second"] = bytes_per_second(bam_file.size());
+    state.counters["records_per_second"] = records_per_second(generated_records);
+}
+BENCHMARK(read_bam_records)->Arg(0)->Arg(1);
+
+// Writes the records of a generated file; the argument selects whether the records have tags.
+void write_bam_records(benchmark::State & state)
+{
+    std::string const bam_file = generate_bam_file(state.range(0) != 0);
+    std::istringstream istream{bam_file};
+    seqan3::alignment_file_input fin{istream, seqan3::format_bam{}, alignment_fields{}}; // owns the header
+    std::vector<typename decltype(fin)::record_type> records{};
+
+    for (auto & record : fin)
+        records.push_back(std::move(record));
+
+    for (auto _ : state)
+    {
+        std::ostringstream ostream{};
+        seqan3::alignment_file_output fout{ostream, seqan3::format_bam{}, alignment_fields{}};
+        fout = records;
+        benchmark::DoNotOptimize(ostream.tellp());
+    }
+
+    state.counters["bytes_per_second"] = bytes_per_second(bam_file.size());
+    state.counters["records_per_second"] = records_per_second(generated_records);
+}
+BENCHMARK(write_bam_records)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
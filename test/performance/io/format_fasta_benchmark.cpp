@@ -41,7 +41,6 @@ inline std::string const fasta_seq{
     "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"
     "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"
     "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"};
-//TODO: benchmark with spaces/newlines
 
 static std::string fasta_file = []()
 {
@@ -51,6 +50,19 @@ static std::string fasta_file = []()
     return file;
 }();
 
+// The same records, but the sequences are wrapped after 70 characters as written by most tools.
+static std::string fasta_file_wrapped = []()
+{
+    std::string wrapped_seq{};
+    for (size_t pos = 0; pos < fasta_seq.size(); pos += 70)
+        wrapped_seq += fasta_seq.substr(pos, 70) + "\n";
+
+    std::string file{};
+    for (size_t idx = 0; idx < iterations_per_run; idx++)
+        file += "> " + fasta_hdr + "\n" + wrapped_seq;
+    return file;
+}();
+
 void write3(benchmark::State & state)
 {
     std::ostringstream ostream;
@@ -120,6 +132,28 @@ void read3(benchmark::State & state)
 }
 BENCHMARK(read3);
 
+void read3_wrapped(benchmark::State & state)
+{
+    std::istringstream istream{fasta_file_wrapped};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fasta{}};
+
+    for (auto _ : state)
+    {
+        istream.clear();
+        istream.seekg(0, std::ios::beg);
+
+        auto it = fin.begin();
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            it++;
+    }
+
+    size_t bytes_per_run = fasta_file_wrapped.size();
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(read3_wrapped);
+
 #if __has_include(<seqan/seq_io.h>)
 
 #include <fstream>
@@ -0,0 +1,185 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#if __has_include(<seqan/seq_io.h>)
+    #include <seqan/seq_io.h>
+#endif
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/io/sequence_file/format_fastq.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/io/sequence_file/output.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/file_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3::test;
+
+inline constexpr size_t iterations_per_run = 1024;
+
+inline std::string const fastq_hdr{"seq foobar blobber"};
+inline std::string const fastq_seq{
+    "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"
+    "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"};
+inline std::string const fastq_qual = [] ()
+{
+    std::string qual{};
+    for (size_t i = 0; i < fastq_seq.size(); ++i)
+        qual.push_back(static_cast<char>('!' + (i * 7) % 42));
+    return qual;
+}();
+
+static std::string fastq_file = []()
+{
+    std::string file{};
+    for (size_t idx = 0; idx < iterations_per_run; idx++)
+        file += "@" + fastq_hdr + "\n" + fastq_seq + "\n+\n" + fastq_qual + "\n";
+    return file;
+}();
+
+void write3(benchmark::State & state)
+{
+    std::ostringstream ostream;
+    seqan3::sequence_file_output fout{ostream, seqan3::format_fastq{}};
+    auto seq = fastq_seq | seqan3::views::char_to<seqan3::dna5> | seqan3::views::to<std::vector>;
+    auto qual = fastq_qual | seqan3::views::char_to<seqan3::phred42> | seqan3::views::to<std::vector>;
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            fout.emplace_back(seq, fastq_hdr, qual);
+    }
+
+    ostream = std::ostringstream{};
+    fout.emplace_back(seq, fastq_hdr, qual);
+    size_t bytes_per_run = ostream.str().size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = records_per_second(iterations_per_run);
+}
+BENCHMARK(write3);
+
+void read3(benchmark::State & state)
+{
+    std::istringstream istream{fastq_file};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
+
+    for (auto _ : state)
+    {
+        istream.clear();
+        istream.seekg(0, std::ios::beg);
+
+        auto it = fin.begin();
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            it++;
+    }
+
+    size_t bytes_per_run = fastq_file.size();
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = records_per_second(iterations_per_run);
+}
+BENCHMARK(read3);
+
+// ============================================================================
+//  Illumina-like reads
+// ============================================================================
+
+inline constexpr size_t generated_records = 100'000;
+
+inline std::string const generated_fastq_file = generate_fastq_file(generated_records);
+
+// Reads the generated file record by record.
+void read_fastq(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        std::istringstream istream{generated_fastq_file};
+        seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
+
+        for (auto & record : fin)
+            benchmark::DoNotOptimize(record);
+    }
+
+    state.counters["bytes_per_second"] = bytes_per_second(generated_fastq_file.size());
+    state.counters["records_per_second"] = records_per_second(generated_records);
+}
+BENCHMARK(read_fastq);
+
+// Writes the records of the generated file; the argument selects seqan3::sequence_file_output_options::async_write.
+void write_fastq(benchmark::State & state)
+{
+    std::istringstream istream{generated_fastq_file};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
+    std::vector<typename decltype(fin)::record_type> records{};
+
+    for (auto & record : fin)
+        records.push_back(std::move(record));
+
+    for (auto _ : state)
+    {
+        std::ostringstream ostream{};
+        seqan3::sequence_file_output fout{ostream, seqan3::format_fastq{}};
+        fout.options.async_write = state.range(0) != 0;
+
+        for (auto & record : records)
+            fout.push_back(record);
+
+        fout.flush();
+        benchmark::DoNotOptimize(ostream.tellp());
+    }
+
+    state.counters["bytes_per_second"] = bytes_per_second(generated_fastq_file.size());
+    state.counters["records_per_second"] = records_per_second(generated_records);
+}
+BENCHMARK(write_fastq)->Arg(0)->Arg(1)->UseRealTime();
+
+#if __has_include(<seqan/seq_io.h>)
+
+void read2(benchmark::State & state)
+{
+    seqan::CharString id;
+    seqan::Dna5String seq;
+    seqan::CharString qual;
+
+    std::istringstream istream{fastq_file};
+
+    for (auto _ : state)
+    {
+        istream.clear();
+        istream.seekg(0, std::ios::beg);
+        auto it = seqan::Iter<std::istringstream, seqan::StreamIterator<seqan::Input> >(istream);
+
+        for (size_t i = 0; i < iterations_per_run; ++i)
+        {
+            readRecord(id, seq, qual, it, seqan::Fastq{});
+            clear(id);
+            clear(seq);
+            clear(qual);
+        }
+    }
+
+    size_t bytes_per_run = fastq_file.size();
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = records_per_second(iterations_per_run);
+}
+BENCHMARK(read2);
+#endif
+
+BENCHMARK_MAIN();
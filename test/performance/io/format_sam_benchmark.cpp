@@ -0,0 +1,161 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <optional>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/file_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3::test;
+
+inline constexpr size_t iterations_per_run = 1024;
+
+inline std::string const sam_id{"read_1234567/1"};
+inline std::string const sam_seq{
+    "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"
+    "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGAACTAGACTAGCTACGATACTAGACTAGCTACGATCAGCTACGA"};
+inline std::string const sam_qual = [] ()
+{
+    std::string qual{};
+    for (size_t i = 0; i < sam_seq.size(); ++i)
+        qual.push_back(static_cast<char>('!' + (i * 7) % 42));
+    return qual;
+}();
+
+// Writes records whose fields are mostly numbers, i.e. the positions, cigar, mate and tags.
+void write_sam(benchmark::State & state)
+{
+    using seqan3::operator""_cigar_op;
+    using seqan3::operator""_tag;
+
+    std::ostringstream ostream;
+    seqan3::alignment_file_header<> header{std::vector<std::string>{"chr1"}};
+    header.ref_id_info.emplace_back(248'956'422, "");
+    header.ref_dict[header.ref_ids()[0]] = 0;
+
+    seqan3::alignment_file_output fout{ostream, seqan3::format_sam{},
+                                       seqan3::fields<seqan3::field::header_ptr,
+                                                      seqan3::field::id,
+                                                      seqan3::field::flag,
+                                                      seqan3::field::ref_id,
+                                                      seqan3::field::ref_offset,
+                                                      seqan3::field::mapq,
+                                                      seqan3::field::cigar,
+                                                      seqan3::field::mate,
+                                                      seqan3::field::seq,
+                                                      seqan3::field::qual,
+                                                      seqan3::field::tags>{}};
+
+    auto seq = sam_seq | seqan3::views::char_to<seqan3::dna5> | seqan3::views::to<std::vector>;
+    auto qual = sam_qual | seqan3::views::char_to<seqan3::phred42> | seqan3::views::to<std::vector>;
+    std::vector<seqan3::cigar> const cigar_vector{{3, 'S'_cigar_op}, {97, 'M'_cigar_op}, {2, 'I'_cigar_op},
+                                                  {58, 'M'_cigar_op}};
+    auto mate = std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>{0, 123'456'789, -350};
+    seqan3::sam_tag_dictionary tags{};
+    tags["NM"_tag] = 3;
+    tags["AS"_tag] = 147;
+    tags["XS"_tag] = 98;
+    tags["MD"_tag] = std::string{"50A46C59"};
+
+    auto write_record = [&] ()
+    {
+        fout.emplace_back(&header, sam_id, seqan3::sam_flag::paired | seqan3::sam_flag::proper_pair, 0,
+                          123'456'000, uint8_t{60}, cigar_vector, mate, seq, qual, tags);
+    };
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            write_record();
+    }
+
+    ostream = std::ostringstream{};
+    write_record();
+    size_t bytes_per_run = ostream.str().size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = records_per_second(iterations_per_run);
+}
+BENCHMARK(write_sam);
+
+// ============================================================================
+//  BWA-like records
+// ============================================================================
+
+inline constexpr size_t generated_records = 100'000;
+
+using alignment_fields = seqan3::fields<seqan3::field::header_ptr,
+                                        seqan3::field::id,
+                                        seqan3::field::flag,
+                                        seqan3::field::ref_id,
+                                        seqan3::field::ref_offset,
+                                        seqan3::field::mapq,
+                                        seqan3::field::cigar,
+                                        seqan3::field::mate,
+                                        seqan3::field::seq,
+                                        seqan3::field::qual,
+                                        seqan3::field::tags>;
+
+// Reads a generated file; the argument selects whether the records have tags.
+void read_sam(benchmark::State & state)
+{
+    std::string const sam_file = generate_sam_file(generated_records, state.range(0) != 0);
+
+    for (auto _ : state)
+    {
+        std::istringstream istream{sam_file};
+        seqan3::alignment_file_input fin{istream, seqan3::format_sam{}, alignment_fields{}};
+
+        for (auto & record : fin)
+            benchmark::DoNotOptimize(record);
+    }
+
+    state.counters["bytes_per_second"] = bytes_per_second(sam_file.size());
+    state.counters["records_per_second"] = records_per_second(generated_records);
+}
+BENCHMARK(read_sam)->Arg(0)->Arg(1);
+
+// Writes the records of a generated file; the argument selects whether the records have tags.
+void write_sam_records(benchmark::State & state)
+{
+    std::string const sam_file = generate_sam_file(generated_records, state.range(0) != 0);
+    std::istringstream istream{sam_file};
+    seqan3::alignment_file_input fin{istream, seqan3::format_sam{}, alignment_fields{}}; // owns the header
+    std::vector<typename decltype(fin)::record_type> records{};
+
+    for (auto & record : fin)
+        records.push_back(std::move(record));
+
+    for (auto _ : state)
+    {
+        std::ostringstream ostream{};
+        seqan3::alignment_file_output fout{ostream, seqan3::format_sam{}, alignment_fields{}};
+        fout = records;
+        benchmark::DoNotOptimize(ostream.tellp());
+    }
+
+    state.counters["bytes_per_second"] = bytes_per_second(sam_file.size());
+    state.counters["records_per_second"] = records_per_second(generated_records);
+}
+BENCHMARK(write_sam_records)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
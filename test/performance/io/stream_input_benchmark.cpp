@@ -11,6 +11,7 @@
 #include <memory>
 #include <sstream>
 
+#include <seqan3/io/detail/async_istream.hpp>
 #include <seqan3/io/stream/iterator.hpp>
 
 #ifdef SEQAN3_HAS_ZLIB
@@ -181,6 +182,37 @@ BENCHMARK_TEMPLATE(compressed, seqan3::contrib::bgzf_istream);
 BENCHMARK_TEMPLATE(compressed, seqan3::contrib::bz2_istream);
 #endif
 
+// ============================================================================
+//  compression applied, decompressed on a background thread
+// ============================================================================
+
+#ifdef SEQAN3_HAS_ZLIB
+void compressed_async_gz(benchmark::State & state)
+{
+    using compressed_istream_t = seqan3::contrib::gz_istream;
+    std::istringstream s{input_comp<compressed_istream_t>};
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        s.clear();
+        s.seekg(0, std::ios::beg);
+        seqan3::detail::basic_async_istream<char> comp{std::make_unique<compressed_istream_t>(s)};
+        seqan3::detail::fast_istreambuf_iterator<char> it{*comp.rdbuf()};
+
+        for (size_t v = 0; v < input_comp<compressed_istream_t>.size(); ++v)
+        {
+            i += *it;
+            ++it;
+        }
+    }
+
+    state.counters["iterations_per_run"] = i;
+}
+
+BENCHMARK(compressed_async_gz);
+#endif
+
 // ============================================================================
 //  compression applied, but stuffed into plain istream
 // ============================================================================
@@ -0,0 +1,27 @@
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{
+        {"ACGTGCGACTAG"_dna4, "ACGTCGACTAG"_dna4},
+        {"ACGTGCGACTAG"_dna4, "TTTTTTTT"_dna4}};
+
+    // Only report alignments with a score of at least 20.
+    auto config = seqan3::align_cfg::mode{seqan3::local_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::min_score{20};
+
+    // The second pair does not reach the minimal score and gets the lowest possible score.
+    for (auto const & res : seqan3::align_pairwise(sequences, config))
+        seqan3::debug_stream << "The score: " << res.score() << "\n";
+}
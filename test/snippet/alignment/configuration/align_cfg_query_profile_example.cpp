@@ -0,0 +1,32 @@
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/std/ranges>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    seqan3::dna4_vector query = "AGTGCTACG"_dna4;
+    std::vector targets{"ACGTGCGACTAG"_dna4, "ACGTACGACACG"_dna4, "AGTAGCGATCG"_dna4};
+
+    // Pair the query with every target. The query must be the first sequence of the pair.
+    auto query_vs_targets = targets | std::views::transform([&query] (auto & target)
+    {
+        return std::tie(query, target);
+    });
+
+    // Enable the query profile such that the scores of the query are computed only once.
+    auto config = seqan3::align_cfg::mode{seqan3::local_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::query_profile;
+
+    for (auto const & res : seqan3::align_pairwise(query_vs_targets, config))
+        seqan3::debug_stream << "The score: " << res.score() << "\n";
+}
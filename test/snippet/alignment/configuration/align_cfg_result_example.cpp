@@ -16,6 +16,9 @@ int main()
     // Compute the score, the back coordinate, the front coordinate and the alignment.
     seqan3::align_cfg::result cfg_alignment{seqan3::with_alignment};
 
+    // Compute the score, the back coordinate, the front coordinate and the alignment as CIGAR sequence.
+    seqan3::align_cfg::result cfg_cigar{seqan3::with_cigar};
+
     // You can also change the score type:
 
     // Compute only the score given a specific score_type.
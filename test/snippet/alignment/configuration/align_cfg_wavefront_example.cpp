@@ -0,0 +1,34 @@
+#include <utility>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    // Build two long sequences.
+    seqan3::dna4_vector sequence1{};
+    seqan3::dna4_vector sequence2{};
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        auto part1 = "ACGTGCGACTAG"_dna4;
+        auto part2 = "ACGTCGACTAG"_dna4;
+        sequence1.insert(sequence1.end(), part1.begin(), part1.end());
+        sequence2.insert(sequence2.end(), part2.begin(), part2.end());
+    }
+
+    // Compute the score and the back coordinate of a single long alignment with 4 threads.
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::result{seqan3::with_back_coordinate} |
+                  seqan3::align_cfg::wavefront{4};
+
+    for (auto const & res : seqan3::align_pairwise(std::pair{sequence1, sequence2}, config))
+        seqan3::debug_stream << "Score: " << res.score() << ", end: " << res.back_coordinate() << "\n";
+}
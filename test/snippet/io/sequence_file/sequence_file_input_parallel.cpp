@@ -0,0 +1,29 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+auto input = R"(@read1
+ACGT
++
+##!#
+@read2
+AGGCTGA
++
+##!#!!!
+@read3
+GGAGTATAATATATATATATATAT
++
+##!###!###!###!###!###!#
+)";
+
+int main()
+{
+    using seqan3::get;
+
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fastq{}};
+    fin.options.threads = 4; // Parse the records with 4 threads.
+
+    for (auto & rec : fin)
+        seqan3::debug_stream << "ID:  " << get<seqan3::field::id>(rec) << '\n';
+}
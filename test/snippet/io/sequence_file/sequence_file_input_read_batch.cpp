@@ -0,0 +1,40 @@
+#include <sstream>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/range/views/pairwise_combine.hpp>
+
+auto input = R"(> TEST1
+ACGT
+> Test2
+AGGCTGA
+> Test3
+GGAGTATAATATATATATATATAT
+> Test4
+GGAGTATAATATA)";
+
+int main()
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}} |
+                  seqan3::align_cfg::result{seqan3::with_score};
+
+    // Read two records at a time; the memory of the batch is reused by every call.
+    while (true)
+    {
+        auto & batch = fin.read_batch(2);
+
+        if (batch.empty())
+            break;
+
+        seqan3::debug_stream << "IDs: " << batch.ids() << '\n';
+
+        // The sequence column can be passed as a whole to the alignment.
+        for (auto const & res : seqan3::align_pairwise(seqan3::views::pairwise_combine(batch.sequences()), config))
+            seqan3::debug_stream << "Score: " << res.score() << '\n';
+    }
+}
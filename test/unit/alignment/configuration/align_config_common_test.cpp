@@ -23,12 +23,15 @@ using test_types = ::testing::Types<align_cfg::aligned_ends<std::remove_const_t<
                                     align_cfg::band<static_band>,
                                     align_cfg::gap<gap_scheme<>>,
                                     align_cfg::max_error,
+                                    align_cfg::min_score,
                                     align_cfg::mode<detail::global_alignment_type>,
                                     align_cfg::mode<detail::local_alignment_type>,
                                     align_cfg::parallel,
+                                    detail::query_profile_tag,
                                     align_cfg::result<>,
                                     align_cfg::scoring<nucleotide_scoring_scheme<int8_t>>,
-                                    detail::vectorise_tag>;
+                                    detail::vectorise_tag,
+                                    align_cfg::wavefront>;
 
 TYPED_TEST_SUITE(alignment_configuration_test, test_types, );
 
@@ -53,7 +56,7 @@ TEST(alignment_configuration_test, symmetric_configuration)
 TEST(alignment_configuration_test, number_of_configs)
 {
     // NOTE(rrahn): You must update this test if you add a new value to align_cfg::id
-    EXPECT_EQ(static_cast<uint8_t>(detail::align_config_id::SIZE), 11);
+    EXPECT_EQ(static_cast<uint8_t>(detail::align_config_id::SIZE), 14);
 }
 
 TYPED_TEST(alignment_configuration_test, config_element)
@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_min_score, config_element)
+{
+    EXPECT_TRUE((detail::config_element<align_cfg::min_score>));
+}
+
+TEST(align_config_min_score, configuration)
+{
+    {
+        align_cfg::min_score elem{-10};
+        configuration cfg{elem};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::min_score>(cfg).value)>,
+                                  int32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::min_score>(cfg).value, -10);
+    }
+
+    {
+        configuration cfg{align_cfg::min_score{10}};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::min_score>(cfg).value)>,
+                                  int32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::min_score>(cfg).value, 10);
+    }
+}
+
+TEST(align_config_min_score, incompatible_configurations)
+{
+    EXPECT_FALSE((detail::compatibility_table<detail::align_config_id>
+                    [static_cast<uint8_t>(detail::align_config_id::min_score)]
+                    [static_cast<uint8_t>(detail::align_config_id::max_error)]));
+    EXPECT_FALSE((detail::compatibility_table<detail::align_config_id>
+                    [static_cast<uint8_t>(detail::align_config_id::min_score)]
+                    [static_cast<uint8_t>(detail::align_config_id::vectorise)]));
+}
@@ -0,0 +1,29 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_query_profile, config_element)
+{
+    configuration cfg{seqan3::align_cfg::query_profile};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::detail::query_profile_tag>());
+}
+
+TEST(align_config_query_profile, incompatible_with_vectorise)
+{
+    EXPECT_FALSE((detail::compatibility_table<detail::align_config_id>
+                    [static_cast<uint8_t>(detail::align_config_id::query_profile)]
+                    [static_cast<uint8_t>(detail::align_config_id::vectorise)]));
+}
@@ -21,7 +21,8 @@ struct align_cfg_result_test : public ::testing::Test
 using test_types = ::testing::Types<detail::with_score_type,
                                     detail::with_back_coordinate_type,
                                     detail::with_front_coordinate_type,
-                                    detail::with_alignment_type>;
+                                    detail::with_alignment_type,
+                                    detail::with_cigar_type>;
 
 TYPED_TEST_SUITE(align_cfg_result_test, test_types, );
 
@@ -47,10 +48,14 @@ auto type_to_variable()
     {
         return with_front_coordinate;
     }
-    else
+    else if constexpr (std::is_same_v<type, detail::with_alignment_type>)
     {
         return with_alignment;
     }
+    else
+    {
+        return with_cigar;
+    }
 }
 
 TYPED_TEST(align_cfg_result_test, configuration)
@@ -0,0 +1,46 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_wavefront, config_element)
+{
+    EXPECT_TRUE((detail::config_element<align_cfg::wavefront>));
+}
+
+TEST(align_config_wavefront, configuration)
+{
+    configuration cfg{align_cfg::wavefront{4}};
+    EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::wavefront>(cfg).value)>,
+                              uint32_t>), true);
+
+    EXPECT_EQ(get<align_cfg::wavefront>(cfg).value, 4u);
+}
+
+TEST(align_config_wavefront, incompatible_configurations)
+{
+    auto is_compatible = [] (detail::align_config_id const id)
+    {
+        return detail::compatibility_table<detail::align_config_id>
+                   [static_cast<uint8_t>(detail::align_config_id::wavefront)]
+                   [static_cast<uint8_t>(id)];
+    };
+
+    EXPECT_FALSE(is_compatible(detail::align_config_id::aligned_ends));
+    EXPECT_FALSE(is_compatible(detail::align_config_id::local));
+    EXPECT_FALSE(is_compatible(detail::align_config_id::parallel));
+    EXPECT_FALSE(is_compatible(detail::align_config_id::vectorise));
+    EXPECT_TRUE(is_compatible(detail::align_config_id::band));
+    EXPECT_TRUE(is_compatible(detail::align_config_id::global));
+}
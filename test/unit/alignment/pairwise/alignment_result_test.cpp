@@ -14,6 +14,7 @@
 #include <vector>
 
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/all.hpp>
 #include <seqan3/core/type_traits/template_inspection.hpp>
@@ -203,6 +204,21 @@ TEST(alignment_result_test, reduced_type)
     }
 }
 
+TEST(alignment_result_test, cigar_sequence)
+{
+    using coord_t = std::pair<int, int>;
+    using cigar_sequence_t = std::vector<cigar>;
+
+    cigar_sequence_t cigar_sequence{{4, 'M'_cigar_op}, {2, 'I'_cigar_op}, {5, 'M'_cigar_op}, {1, 'D'_cigar_op}};
+    detail::alignment_result_value_type<int, int, coord_t, coord_t, std::nullopt_t *, std::nullopt_t *,
+                                        std::nullopt_t *, cigar_sequence_t> tr{2, 5, {11, 12}, {0, 0}};
+    tr.cigar_sequence = cigar_sequence;
+
+    alignment_result tmp(tr);
+    EXPECT_TRUE((std::is_same_v<decltype(tmp.cigar_sequence()), cigar_sequence_t const &>));
+    EXPECT_EQ(tmp.cigar_sequence(), cigar_sequence);
+}
+
 TEST(alignment_result_test, type_deduction)
 {
     {
@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/range/views/to.hpp>
+
+using seqan3::operator""_cigar_op;
+using seqan3::operator""_dna4;
+
+inline constexpr auto gap_cfg = seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1},
+                                                                          seqan3::gap_open_score{-10}}};
+inline constexpr auto dna_scoring_cfg =
+    seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+
+std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> const sequences
+{
+    {"AACCGGTTTAACCGGTTAGCTAGCTA"_dna4, "AACCGGTTAACCGTTTTAGCTAGCTA"_dna4},
+    {"AACCGGTTTAACCGGTTAGCTAGCTA"_dna4, "ACGTCTACGTA"_dna4},
+    {"ACGTCTACGTA"_dna4, "GGGGTTTTACGTACGATCGACTAGCTAGCATCGACTAGCTCAT"_dna4},
+    {"ATGGCGTAGAGC"_dna4, "ATGCCCCGTTGC"_dna4}
+};
+
+// The CIGAR sequence must equal the one converted from the aligned sequences.
+template <typename config_t>
+void expect_same_cigar(config_t const & cfg)
+{
+    auto expected = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::result{seqan3::with_alignment})
+                  | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::result{seqan3::with_cigar})
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].id(), expected[i].id());
+        EXPECT_EQ(actual[i].score(), expected[i].score());
+        EXPECT_EQ(actual[i].back_coordinate(), expected[i].back_coordinate());
+        EXPECT_EQ(actual[i].front_coordinate(), expected[i].front_coordinate());
+        EXPECT_EQ(actual[i].cigar_sequence(), seqan3::detail::get_cigar_vector(expected[i].alignment()));
+    }
+}
+
+TEST(cigar_sequence, global)
+{
+    expect_same_cigar(seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg);
+}
+
+TEST(cigar_sequence, semi_global)
+{
+    expect_same_cigar(seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg |
+                      seqan3::align_cfg::aligned_ends{seqan3::free_ends_first});
+}
+
+TEST(cigar_sequence, local)
+{
+    expect_same_cigar(seqan3::align_cfg::mode{seqan3::local_alignment} | gap_cfg | dna_scoring_cfg);
+}
+
+TEST(cigar_sequence, banded)
+{
+    expect_same_cigar(seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg |
+                      seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-40},
+                                                                  seqan3::upper_bound{40}}});
+}
+
+TEST(cigar_sequence, edit_distance)
+{
+    expect_same_cigar(seqan3::align_cfg::edit);
+}
+
+TEST(cigar_sequence, semi_global_edit_distance)
+{
+    expect_same_cigar(seqan3::align_cfg::edit | seqan3::align_cfg::aligned_ends{seqan3::free_ends_first});
+}
+
+TEST(cigar_sequence, operations)
+{
+    // First sequence is the reference, second sequence is the query.
+    std::pair sequence_pair{"ACGTACGT"_dna4, "ACGTGGACGT"_dna4};
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg |
+               seqan3::align_cfg::result{seqan3::with_cigar};
+
+    auto res = *std::ranges::begin(seqan3::align_pairwise(sequence_pair, cfg));
+
+    std::vector<seqan3::cigar> expected{{4, 'M'_cigar_op}, {2, 'I'_cigar_op}, {4, 'M'_cigar_op}};
+    EXPECT_EQ(res.cigar_sequence(), expected);
+
+    sequence_pair = std::pair{"ACGTGGACGT"_dna4, "ACGTACGT"_dna4};
+    res = *std::ranges::begin(seqan3::align_pairwise(sequence_pair, cfg));
+
+    expected = std::vector<seqan3::cigar>{{4, 'M'_cigar_op}, {2, 'D'_cigar_op}, {4, 'M'_cigar_op}};
+    EXPECT_EQ(res.cigar_sequence(), expected);
+}
@@ -0,0 +1,125 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/ranges>
+
+using seqan3::operator""_dna4;
+
+inline constexpr auto gap_cfg = seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1},
+                                                                          seqan3::gap_open_score{-10}}};
+inline constexpr auto dna_scoring_cfg =
+    seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+
+std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> const sequences
+{
+    {"AACCGGTTTAACCGGTTAGCTAGCTA"_dna4, "AACCGGTTAACCGTTTTAGCTAGCTA"_dna4},
+    {"AACCGGTTTAACCGGTTAGCTAGCTA"_dna4, "ACGTCTACGTA"_dna4},
+    {"AACCGGTTTAACCGGTTAGCTAGCTA"_dna4, "GGGGTTTTACGTACGATCGACTAGCTAGCATCGACTAGCTCAT"_dna4},
+    {"AAAAAAAAAAAAAAAAAAAAAAAAAA"_dna4, "TTTTTTTTTTTTTTTTTTTTTTTTTT"_dna4},
+    {"TTAACCGGT"_dna4, ""_dna4}
+};
+
+// Results reaching the minimal score must be unchanged, all others must be reported as invalid.
+template <typename config_t>
+void expect_min_score_results(config_t const & cfg, int32_t const min_score)
+{
+    auto expected = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::result{seqan3::with_alignment})
+                  | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::result{seqan3::with_alignment}
+                                                        | seqan3::align_cfg::min_score{min_score})
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].id(), expected[i].id());
+
+        auto && [actual_gapped1, actual_gapped2] = actual[i].alignment();
+        auto && [expected_gapped1, expected_gapped2] = expected[i].alignment();
+        auto to_string = [] (auto && gapped)
+        {
+            return gapped | seqan3::views::to_char | seqan3::views::to<std::string>;
+        };
+
+        if (expected[i].score() >= min_score)
+        {
+            EXPECT_EQ(actual[i].score(), expected[i].score());
+            EXPECT_EQ(actual[i].back_coordinate(), expected[i].back_coordinate());
+            EXPECT_EQ(actual[i].front_coordinate(), expected[i].front_coordinate());
+            EXPECT_EQ(to_string(actual_gapped1), to_string(expected_gapped1));
+            EXPECT_EQ(to_string(actual_gapped2), to_string(expected_gapped2));
+        }
+        else
+        {
+            auto const & [sequence1, sequence2] = sequences[i];
+            seqan3::alignment_coordinate invalid_coordinate{seqan3::detail::column_index_type{sequence1.size()},
+                                                            seqan3::detail::row_index_type{sequence2.size()}};
+
+            EXPECT_EQ(actual[i].score(), std::numeric_limits<int32_t>::lowest());
+            EXPECT_EQ(actual[i].back_coordinate(), invalid_coordinate);
+            EXPECT_EQ(actual[i].front_coordinate(), invalid_coordinate);
+            EXPECT_TRUE(std::ranges::empty(actual_gapped1));
+            EXPECT_TRUE(std::ranges::empty(actual_gapped2));
+        }
+    }
+}
+
+TEST(min_score, global)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg;
+
+    for (int32_t min_score : {-1000, -50, 0, 50, 1000})
+        expect_min_score_results(cfg, min_score);
+}
+
+TEST(min_score, semi_global)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg |
+               seqan3::align_cfg::aligned_ends{seqan3::free_ends_first};
+
+    for (int32_t min_score : {-1000, -50, 0, 50, 1000})
+        expect_min_score_results(cfg, min_score);
+}
+
+TEST(min_score, local)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::local_alignment} | gap_cfg | dna_scoring_cfg;
+
+    for (int32_t min_score : {0, 1, 20, 50, 1000})
+        expect_min_score_results(cfg, min_score);
+}
+
+TEST(min_score, banded)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg |
+               seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-30}, seqan3::upper_bound{30}}};
+
+    for (int32_t min_score : {-1000, -50, 0, 50, 1000})
+        expect_min_score_results(cfg, min_score);
+}
+
+TEST(min_score, edit_distance)
+{
+    auto cfg = seqan3::align_cfg::edit | seqan3::align_cfg::result{seqan3::with_score} |
+               seqan3::align_cfg::min_score{-5};
+
+    EXPECT_THROW(seqan3::align_pairwise(sequences[0], cfg), seqan3::invalid_alignment_configuration);
+}
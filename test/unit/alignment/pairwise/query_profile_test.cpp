@@ -0,0 +1,137 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/ranges>
+
+using seqan3::operator""_aa27;
+using seqan3::operator""_dna4;
+
+inline constexpr auto gap_cfg = seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1},
+                                                                          seqan3::gap_open_score{-10}}};
+inline constexpr auto dna_scoring_cfg =
+    seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+
+seqan3::dna4_vector const query{"AACCGGTTTAACCGGTTAGCTAGCTA"_dna4};
+std::vector<seqan3::dna4_vector> const targets{"ACGTCTACGTA"_dna4,
+                                               "AACCGGTTAACCGTTTTAGCTAGCTA"_dna4,
+                                               "GGGGTTTTACGTACGATCGACTAGCTAGCATCGACTAGCTCAT"_dna4,
+                                               ""_dna4,
+                                               "TTAACCGGT"_dna4};
+
+// Computes all pairs with and without the query profile and compares the results.
+template <typename sequences_t, typename config_t>
+void expect_same_results(sequences_t const & sequences, config_t const & cfg)
+{
+    auto expected = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::result{seqan3::with_alignment})
+                  | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::result{seqan3::with_alignment}
+                                                        | seqan3::align_cfg::query_profile)
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].id(), expected[i].id());
+        EXPECT_EQ(actual[i].score(), expected[i].score());
+        EXPECT_EQ(actual[i].back_coordinate(), expected[i].back_coordinate());
+        EXPECT_EQ(actual[i].front_coordinate(), expected[i].front_coordinate());
+
+        auto && [actual_gapped1, actual_gapped2] = actual[i].alignment();
+        auto && [expected_gapped1, expected_gapped2] = expected[i].alignment();
+        EXPECT_EQ(actual_gapped1 | seqan3::views::to_char | seqan3::views::to<std::string>,
+                  expected_gapped1 | seqan3::views::to_char | seqan3::views::to<std::string>);
+        EXPECT_EQ(actual_gapped2 | seqan3::views::to_char | seqan3::views::to<std::string>,
+                  expected_gapped2 | seqan3::views::to_char | seqan3::views::to<std::string>);
+    }
+}
+
+// Pairs the query with every target.
+template <typename query_t, typename targets_t>
+auto one_vs_many(query_t const & query, targets_t const & targets)
+{
+    std::vector<std::pair<query_t, std::ranges::range_value_t<targets_t>>> sequences{};
+    for (auto const & target : targets)
+        sequences.emplace_back(query, target);
+
+    return sequences;
+}
+
+TEST(query_profile, global)
+{
+    expect_same_results(one_vs_many(query, targets),
+                        seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg);
+}
+
+TEST(query_profile, semi_global)
+{
+    expect_same_results(one_vs_many(query, targets),
+                        seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg |
+                        seqan3::align_cfg::aligned_ends{seqan3::free_ends_first});
+}
+
+TEST(query_profile, local)
+{
+    expect_same_results(one_vs_many(query, targets),
+                        seqan3::align_cfg::mode{seqan3::local_alignment} | gap_cfg | dna_scoring_cfg);
+}
+
+TEST(query_profile, parallel)
+{
+    expect_same_results(one_vs_many(query, targets),
+                        seqan3::align_cfg::mode{seqan3::local_alignment} | gap_cfg | dna_scoring_cfg |
+                        seqan3::align_cfg::parallel{2});
+}
+
+TEST(query_profile, banded)
+{
+    std::vector<seqan3::dna4_vector> similar_targets{"AACCGGTTAACCGTTTTAGCTAGCTA"_dna4,
+                                                     "AACCGGTTTAACCGGTTAGCTAGCTA"_dna4};
+
+    expect_same_results(one_vs_many(query, similar_targets),
+                        seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg |
+                        seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-5},
+                                                                    seqan3::upper_bound{5}}});
+}
+
+TEST(query_profile, changing_query)
+{
+    // The profile must be rebuilt whenever the first sequence changes between two pairs.
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{};
+    for (auto const & target : targets)
+    {
+        sequences.emplace_back(query, target);
+        sequences.emplace_back(target, query);
+    }
+
+    expect_same_results(sequences, seqan3::align_cfg::mode{seqan3::global_alignment} | gap_cfg | dna_scoring_cfg);
+}
+
+TEST(query_profile, aminoacid)
+{
+    seqan3::aa27_vector aa_query{"FNQSAEYPDISHCGVMQLKWRATLGT"_aa27};
+    std::vector<seqan3::aa27_vector> aa_targets{"EIKSDVRMLCEQRYHLEEAHVSWCPPC"_aa27,
+                                                "FNQSAEYPDISHCGLMQLKWRATLGT"_aa27};
+
+    expect_same_results(one_vs_many(aa_query, aa_targets),
+                        seqan3::align_cfg::mode{seqan3::local_alignment} | gap_cfg |
+                        seqan3::align_cfg::scoring{seqan3::aminoacid_scoring_scheme{
+                            seqan3::aminoacid_similarity_matrix::BLOSUM62}});
+}
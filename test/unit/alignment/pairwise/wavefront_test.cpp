@@ -0,0 +1,158 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+
+using seqan3::operator""_dna4;
+
+inline constexpr auto gap_cfg = seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1},
+                                                                          seqan3::gap_open_score{-10}}};
+inline constexpr auto dna_scoring_cfg =
+    seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+inline constexpr auto global_cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | dna_scoring_cfg | gap_cfg;
+
+// Generates a sequence and a mutated copy of it, such that the optimal alignment is not trivial.
+std::pair<seqan3::dna4_vector, seqan3::dna4_vector> generate_sequence_pair(size_t const size, unsigned const seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int> rank_distribution{0, 3};
+    std::uniform_int_distribution<int> mutation_distribution{0, 19};
+
+    seqan3::dna4_vector sequence1{};
+    seqan3::dna4_vector sequence2{};
+    for (size_t i = 0; i < size; ++i)
+    {
+        seqan3::dna4 value = seqan3::assign_rank_to(rank_distribution(generator), seqan3::dna4{});
+        sequence1.push_back(value);
+
+        switch (mutation_distribution(generator))
+        {
+            case 0: break; // deletion
+            case 1: sequence2.push_back(value); sequence2.push_back(value); break; // insertion
+            case 2: sequence2.push_back(seqan3::assign_rank_to(rank_distribution(generator), seqan3::dna4{})); break;
+            default: sequence2.push_back(value);
+        }
+    }
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+// The wavefront alignment must compute the same results as the standard alignment algorithm.
+template <typename sequences_t, typename config_t>
+void expect_same_results(sequences_t const & sequences, config_t const & cfg)
+{
+    auto expected = seqan3::align_pairwise(sequences, cfg) | seqan3::views::to<std::vector>;
+
+    for (uint32_t thread_count : {1u, 2u, 4u})
+    {
+        auto actual = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::wavefront{thread_count})
+                    | seqan3::views::to<std::vector>;
+
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_EQ(actual[i].id(), expected[i].id());
+            EXPECT_EQ(actual[i].score(), expected[i].score());
+        }
+    }
+}
+
+std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> const sequences
+{
+    generate_sequence_pair(1000, 1),
+    generate_sequence_pair(777, 2),
+    generate_sequence_pair(256, 3),
+    {"AACCGGTTTAACCGGTTAGCTAGCTA"_dna4, "ACGTCTACGTA"_dna4},
+    {"TTAACCGGT"_dna4, ""_dna4},
+    {""_dna4, "TTAACCGGT"_dna4}
+};
+
+TEST(wavefront, score)
+{
+    expect_same_results(sequences, global_cfg | seqan3::align_cfg::result{seqan3::with_score});
+}
+
+TEST(wavefront, linear_gaps)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} |
+               dna_scoring_cfg |
+               seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-2}}} |
+               seqan3::align_cfg::result{seqan3::with_score};
+    expect_same_results(sequences, cfg);
+}
+
+TEST(wavefront, back_coordinate)
+{
+    auto cfg = global_cfg | seqan3::align_cfg::result{seqan3::with_back_coordinate};
+
+    auto expected = seqan3::align_pairwise(sequences, cfg) | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::wavefront{4})
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].score(), expected[i].score());
+        EXPECT_EQ(actual[i].back_coordinate(), expected[i].back_coordinate());
+    }
+}
+
+TEST(wavefront, banded)
+{
+    for (size_t i = 0; i < 3; ++i)
+    {
+        // The band must contain the begin and the end of both sequences.
+        int64_t const size_difference = static_cast<int64_t>(sequences[i].first.size()) -
+                                        static_cast<int64_t>(sequences[i].second.size());
+
+        for (int64_t const width : {5, 100, 600})
+        {
+            auto cfg = global_cfg |
+                       seqan3::align_cfg::band{seqan3::static_band{
+                           seqan3::lower_bound{std::min<int64_t>(0, size_difference) - width},
+                           seqan3::upper_bound{std::max<int64_t>(0, size_difference) + width}}} |
+                       seqan3::align_cfg::result{seqan3::with_score};
+            expect_same_results(std::vector{sequences[i]}, cfg);
+        }
+    }
+}
+
+TEST(wavefront, invalid_configuration)
+{
+    auto sequence_pair = sequences[0];
+
+    // The band does not contain the end of both sequences.
+    auto banded_cfg = global_cfg |
+                      seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-2}, seqan3::upper_bound{2}}} |
+                      seqan3::align_cfg::wavefront{2};
+    seqan3::dna4_vector shorter_sequence{sequence_pair.first.begin(), sequence_pair.first.begin() + 100};
+    EXPECT_THROW((seqan3::align_pairwise(std::pair{sequence_pair.first, shorter_sequence}, banded_cfg)
+                  | seqan3::views::to<std::vector>),
+                 seqan3::invalid_alignment_configuration);
+
+    // The number of threads must be greater than 0.
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pair, global_cfg | seqan3::align_cfg::wavefront{0}),
+                 seqan3::invalid_alignment_configuration);
+
+    // The traceback is not supported.
+    auto alignment_cfg = global_cfg |
+                         seqan3::align_cfg::result{seqan3::with_alignment} |
+                         seqan3::align_cfg::wavefront{2};
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pair, alignment_cfg), seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/bgzf_index.hpp>
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
+
+using namespace seqan3;
+
+// "The quick brown fox jumps over the lazy dog" in one block followed by the end-of-file marker.
+std::string const compressed
+{
+    '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\xFF', '\x06', '\x00', '\x42', '\x43',
+    '\x02', '\x00', '\x45', '\x00', '\x0B', '\xC9', '\x48', '\x55', '\x28', '\x2C', '\xCD', '\x4C', '\xCE', '\x56',
+    '\x48', '\x2A', '\xCA', '\x2F', '\xCF', '\x53', '\x48', '\xCB', '\xAF', '\x50', '\xC8', '\x2A', '\xCD', '\x2D',
+    '\x28', '\x56', '\xC8', '\x2F', '\x4B', '\x2D', '\x52', '\x28', '\x01', '\x4A', '\xE7', '\x24', '\x56', '\x55',
+    '\x2A', '\xA4', '\xE4', '\xA7', '\x03', '\x00', '\x39', '\xA3', '\x4F', '\x41', '\x2B', '\x00', '\x00', '\x00',
+    '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\xFF', '\x06', '\x00', '\x42', '\x43',
+    '\x02', '\x00', '\x1B', '\x00', '\x03', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
+};
+
+// The .gzi file that `bgzip --index` writes for the file above: no entries, because the first block always starts at
+// offset 0 and the end-of-file marker is not indexed.
+std::string const gzi(8, '\x00');
+
+// The same text in two blocks followed by the end-of-file marker, written with bgzf_ostream.
+std::string make_two_block_file()
+{
+    std::ostringstream compressed_output{};
+    {
+        contrib::bgzf_ostream bgzf_stream{compressed_output};
+        bgzf_stream << "The quick brown fox jumps over the lazy dog";
+        bgzf_stream.flush(); // ends the block
+        bgzf_stream << "The quick brown fox jumps over the lazy dog";
+    }
+    return compressed_output.str();
+}
+
+std::string make_uncompressed()
+{
+    std::string uncompressed{};
+    for (size_t i = 0; i < 100000; ++i)
+        uncompressed += std::to_string(i) + '\n';
+    return uncompressed;
+}
+
+TEST(bgzf_index, virtual_offset)
+{
+    EXPECT_EQ(contrib::bgzf_virtual_offset(0, 0), 0u);
+    EXPECT_EQ(contrib::bgzf_virtual_offset(70, 3), (70u << 16) + 3u);
+}
+
+TEST(bgzf_index, build)
+{
+    std::istringstream compressed_stream{compressed};
+    contrib::bgzf_index index = contrib::bgzf_index::build(compressed_stream);
+
+    EXPECT_TRUE(index.blocks().empty()); // the end-of-file marker is not indexed
+
+    EXPECT_EQ(index.virtual_offset(0), 0u);
+    EXPECT_EQ(index.virtual_offset(42), 42u);
+    EXPECT_EQ(index.virtual_offset(43), 43u); // the end of the last block
+}
+
+TEST(bgzf_index, build_two_blocks)
+{
+    std::string const two_blocks = make_two_block_file();
+    std::istringstream compressed_stream{two_blocks};
+    contrib::bgzf_index index = contrib::bgzf_index::build(compressed_stream);
+
+    // Only the second block is indexed, as by bgzip.
+    ASSERT_EQ(index.blocks().size(), 1u);
+    uint64_t const second_block = index.blocks()[0].compressed_offset;
+    EXPECT_EQ(index.blocks()[0].uncompressed_offset, 43u);
+    EXPECT_LT(second_block, two_blocks.size());
+
+    EXPECT_EQ(index.virtual_offset(43), contrib::bgzf_virtual_offset(second_block, 0));
+    EXPECT_EQ(index.virtual_offset(86), contrib::bgzf_virtual_offset(second_block, 43));
+}
+
+TEST(bgzf_index, build_invalid)
+{
+    std::istringstream truncated_header{compressed.substr(0, 10)};
+    EXPECT_THROW(contrib::bgzf_index::build(truncated_header), io_error);
+
+    std::istringstream truncated_block{compressed.substr(0, 50)};
+    EXPECT_THROW(contrib::bgzf_index::build(truncated_block), io_error);
+
+    std::istringstream no_bgzf{std::string(100, 'A')};
+    EXPECT_THROW(contrib::bgzf_index::build(no_bgzf), io_error);
+}
+
+TEST(bgzf_index, read)
+{
+    std::istringstream gzi_stream{gzi};
+    contrib::bgzf_index index{};
+    index.read(gzi_stream);
+
+    std::istringstream compressed_stream{compressed};
+    EXPECT_EQ(index, contrib::bgzf_index::build(compressed_stream));
+}
+
+TEST(bgzf_index, read_invalid)
+{
+    std::istringstream truncated{std::string{"\x01\0\0\0\0\0\0\0\x46\0", 10}}; // one entry, but only two bytes
+    contrib::bgzf_index index{};
+    EXPECT_THROW(index.read(truncated), io_error);
+}
+
+TEST(bgzf_index, write)
+{
+    std::istringstream compressed_stream{compressed};
+    std::ostringstream gzi_stream{};
+    contrib::bgzf_index::build(compressed_stream).write(gzi_stream);
+
+    EXPECT_EQ(gzi_stream.str(), gzi);
+}
+
+TEST(bgzf_index, seek)
+{
+    std::string const uncompressed = make_uncompressed();
+    std::ostringstream compressed_output{};
+    {
+        contrib::bgzf_ostream bgzf_stream{compressed_output};
+        bgzf_stream << uncompressed;
+    }
+
+    std::istringstream compressed_input{compressed_output.str()};
+    contrib::bgzf_index const index = contrib::bgzf_index::build(compressed_input);
+    EXPECT_GT(index.blocks().size(), 2u);
+
+    compressed_input.clear();
+    compressed_input.seekg(0);
+    contrib::bgzf_istream bgzf_stream{compressed_input};
+
+    // Forward and backward jumps, across and within blocks.
+    for (size_t position : {300000u, 5u, 65500u, 200000u, 200010u, 0u, uncompressed.size() - 4})
+    {
+        bgzf_stream.seekg(index.virtual_offset(position));
+
+        std::string buffer(4, ' ');
+        bgzf_stream.read(buffer.data(), buffer.size());
+        EXPECT_EQ(buffer, uncompressed.substr(position, 4));
+    }
+
+    bgzf_stream.seekg(index.virtual_offset(uncompressed.size()));
+    EXPECT_EQ(bgzf_stream.get(), std::char_traits<char>::eof());
+}
@@ -0,0 +1,98 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#include <seqan3/contrib/stream/zstd_ostream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+
+using namespace seqan3;
+
+// The output of the multi-threaded compression differs from the single-threaded one, so the tests with the default
+// thread count only check that the output can be decompressed again.
+
+std::string const uncompressed{"The quick brown fox jumps over the lazy dog"};
+
+std::string const compressed
+{
+    '\x28','\xB5','\x2F','\xFD','\x00','\x58','\x58','\x01','\x00','\x54','\x68','\x65','\x20','\x71','\x75','\x69',
+    '\x63','\x6B','\x20','\x62','\x72','\x6F','\x77','\x6E','\x20','\x66','\x6F','\x78','\x20','\x6A','\x75','\x6D',
+    '\x70','\x73','\x20','\x6F','\x76','\x65','\x72','\x20','\x74','\x68','\x65','\x20','\x6C','\x61','\x7A','\x79',
+    '\x20','\x64','\x6F','\x67','\x01','\x00','\x00'
+};
+
+std::string decompress(std::string const & input)
+{
+    std::istringstream compressed_stream{input};
+    contrib::zstd_istream decompressed_stream{compressed_stream};
+    return std::string{std::istreambuf_iterator<char>{decompressed_stream}, std::istreambuf_iterator<char>{}};
+}
+
+TEST(zstd_ostream, concept_check)
+{
+    EXPECT_TRUE((output_stream_over<contrib::zstd_ostream, char>));
+}
+
+TEST(zstd_ostream, output_single_thread)
+{
+    std::ostringstream out;
+
+    {
+        contrib::zstd_ostream compressed_stream{out, contrib::zstd_default_compression_level, 1};
+        compressed_stream << uncompressed << std::flush;
+    }
+
+    EXPECT_EQ(out.str(), compressed);
+}
+
+TEST(zstd_ostream, output)
+{
+    std::ostringstream out;
+
+    {
+        contrib::zstd_ostream compressed_stream{out};
+        compressed_stream << uncompressed << std::flush;
+    }
+
+    EXPECT_EQ(decompress(out.str()), uncompressed);
+}
+
+TEST(zstd_ostream, output_type_erased)
+{
+    std::ostringstream out;
+
+    {
+        std::unique_ptr<std::ostream> compressed_stream{new contrib::zstd_ostream{out}};
+        *compressed_stream << uncompressed << std::flush;
+    }
+
+    EXPECT_EQ(decompress(out.str()), uncompressed);
+}
+
+TEST(zstd_ostream, output_large_multi_threaded)
+{
+    std::string input{};
+    for (size_t i = 0; i < 200000; ++i)
+        input += std::to_string(i) + '\n';
+
+    for (size_t thread_count : {1u, 2u, 4u})
+    {
+        std::ostringstream out;
+
+        {
+            contrib::zstd_ostream compressed_stream{out, 1, thread_count};
+            compressed_stream << input;
+        }
+
+        EXPECT_EQ(decompress(out.str()), input);
+    }
+}
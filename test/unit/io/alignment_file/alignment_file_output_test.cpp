@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <limits>
 #include <sstream>
 
 #include <gtest/gtest.h>
@@ -504,6 +505,122 @@ read3	43	ref	3	63	1S1M1D1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
     EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), comp);
 }
 
+TEST(rows, assign_with_threads)
+{
+    std::vector<std::tuple<dna5_vector, std::string, std::optional<int32_t>>> range;
+
+    for (size_t i = 0; i < 5000; ++i) // more than one batch
+        range.emplace_back(seqs[i % 3], ids[i % 3] + "_" + std::to_string(i), static_cast<int32_t>(i));
+
+    auto write = [&range] (size_t const threads)
+    {
+        alignment_file_output fout{std::ostringstream{},
+                                   format_sam{},
+                                   fields<field::seq, field::id, field::ref_offset>{}};
+        fout.options.sam_require_header = false;
+        fout.options.threads = threads;
+        fout = range;
+        fout.get_stream().flush();
+        return reinterpret_cast<std::ostringstream &>(fout.get_stream()).str();
+    };
+
+    std::string const sequential = write(1);
+    EXPECT_EQ(sequential.substr(0, 31), "read1_0\t0\t*\t1\t0\t*\t*\t0\t0\tACGT\t*\n");
+    EXPECT_EQ(write(4), sequential);
+}
+
+TEST(rows, write_sorted_bam)
+{
+    std::vector<std::string> const ref_ids{"ref1", "ref2"};
+    std::vector<int32_t> const ref_lengths{1000, 1000};
+
+    // every fifth record is unplaced; the positions repeat, such that the order of equal coordinates is tested
+    std::vector<std::tuple<std::string, std::optional<int32_t>, std::optional<int32_t>>> records{};
+    for (int32_t i = 0; i < 1000; ++i)
+    {
+        if (i % 5 == 0)
+            records.emplace_back("read" + std::to_string(i), std::nullopt, std::nullopt);
+        else
+            records.emplace_back("read" + std::to_string(i), i % 2, (i * 37) % 200);
+    }
+
+    std::ostringstream stream{};
+
+    {
+        alignment_file_output fout{stream, ref_ids, ref_lengths, format_bam{},
+                                   fields<field::id, field::ref_id, field::ref_offset>{}};
+        fout.options.bam_sort_by_coordinate = true;
+        fout.options.bam_sort_memory_limit = 20'000; // several temporary files
+        fout.options.threads = 2;
+        fout = records;
+    }
+
+    std::stable_sort(records.begin(), records.end(), [] (auto const & lhs, auto const & rhs)
+    {
+        auto key = [] (auto const & record)
+        {
+            return std::pair{get<1>(record).value_or(std::numeric_limits<int32_t>::max()), get<2>(record).value_or(0)};
+        };
+
+        return key(lhs) < key(rhs);
+    });
+
+    alignment_file_input fin{std::istringstream{stream.str()}, format_bam{}, fields<field::id>{}};
+    EXPECT_EQ(fin.header().sorting, "coordinate");
+
+    size_t i = 0;
+    for (auto & [id] : fin)
+        EXPECT_EQ(id, get<0>(records[i++]));
+
+    EXPECT_EQ(i, records.size());
+}
+
+#if SEQAN3_HAS_ZLIB
+TEST(rows, close_sorted_and_indexed_bam)
+{
+    test::tmp_filename const filename{"sorted.bam"};
+    std::filesystem::path index_path = filename.get_path();
+    index_path += ".bai";
+
+    std::vector<std::string> const ref_ids{"ref"};
+    std::vector<int32_t> const ref_lengths{1000};
+    auto write = [] (auto & fout)
+    {
+        fout.options.bam_sort_by_coordinate = true;
+        fout.options.bam_create_index = true;
+        fout.emplace_back(std::string{"read2"}, std::optional<int32_t>{0}, std::optional<int32_t>{200});
+        fout.emplace_back(std::string{"read1"}, std::optional<int32_t>{0}, std::optional<int32_t>{100});
+    };
+
+    {
+        alignment_file_output fout{filename.get_path(), ref_ids, ref_lengths,
+                                   fields<field::id, field::ref_id, field::ref_offset>{}};
+        write(fout);
+        fout.close();
+        fout.close(); // does nothing
+
+        // the file is complete before the destructor is called
+        EXPECT_TRUE(std::filesystem::exists(index_path));
+        alignment_file_input fin{filename.get_path(), fields<field::id>{}};
+        std::vector<std::string> ids{};
+        for (auto & [id] : fin)
+            ids.push_back(id);
+        EXPECT_EQ(ids, (std::vector<std::string>{"read1", "read2"}));
+    }
+
+    // the index cannot be written, because a directory has its name
+    std::filesystem::remove(index_path);
+    std::filesystem::create_directory(index_path);
+
+    {
+        alignment_file_output fout{filename.get_path(), ref_ids, ref_lengths,
+                                   fields<field::id, field::ref_id, field::ref_offset>{}};
+        write(fout);
+        EXPECT_THROW(fout.close(), file_open_error);
+        EXPECT_NO_THROW(fout.close()); // the file is closed, also after an error
+    } // and the destructor does not try again
+}
+
 #if SEQAN3_HAS_ZLIB
 TEST(rows, write_bam_file)
 {
@@ -655,6 +772,26 @@ TEST(compression, by_stream_bgzf)
     buffer[9] = '\x00'; // zero out OS byte.
     EXPECT_EQ(buffer, expected_bgzf);
 }
+
+TEST(compression, options_gz)
+{
+    test::tmp_filename filename{"alignment_file_output_test.sam.gz"};
+
+    {
+        alignment_file_output fout{filename.get_path(), fields<field::seq, field::id>{}};
+        fout.options.compression_level = 0; // the blocks are stored uncompressed
+        fout.options.compression_threads = 2;
+
+        for (size_t i = 0; i < 3; ++i)
+            fout.emplace_back(seqs[i], ids[i]);
+    }
+
+    std::ifstream fi{filename.get_path(), std::ios::binary};
+    std::string buffer{std::istreambuf_iterator<char>{fi}, std::istreambuf_iterator<char>{}};
+
+    for (std::string const & id : ids)
+        EXPECT_NE(buffer.find(id), std::string::npos);
+}
 #endif
 
 #ifdef SEQAN3_HAS_BZIP2
@@ -0,0 +1,233 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/std/filesystem>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+// The offsets passed to the builder are used as virtual offsets.
+auto identity = [] (uint64_t const offset) { return offset; };
+
+// Three records on the first reference and one unplaced record; each record occupies 10 bytes of the file.
+bam_index build_index(uint64_t const maximal_reference_length = 100'000)
+{
+    detail::bam_index_builder builder{2, maximal_reference_length};
+    builder.push(0, 100, 200, true, 0, 10);
+    builder.push(0, 150, 250, true, 10, 20);
+    builder.push(0, 40'000, 40'100, false, 20, 30);
+    builder.push(-1, -1, -1, false, 30, 40);
+    return builder.finish(identity);
+}
+
+TEST(bam_index, reg2bin)
+{
+    EXPECT_EQ(bam_index::reg2bin(0, 1, 14, 5), 4681u);
+    EXPECT_EQ(bam_index::reg2bin(16'384, 16'385, 14, 5), 4682u);
+    EXPECT_EQ(bam_index::reg2bin(0, 16'385, 14, 5), 585u);
+    EXPECT_EQ(bam_index::reg2bin(0, 1 << 29, 14, 5), 0u);
+}
+
+TEST(bam_index, reg2bins)
+{
+    EXPECT_EQ(bam_index::reg2bins(0, 1, 14, 5), (std::vector<uint32_t>{0, 1, 9, 73, 585, 4681}));
+    EXPECT_EQ(bam_index::reg2bins(0, 16'385, 14, 5), (std::vector<uint32_t>{0, 1, 9, 73, 585, 4681, 4682}));
+    EXPECT_TRUE(bam_index::reg2bins(10, 10, 14, 5).empty());
+}
+
+TEST(bam_index, query)
+{
+    bam_index const index = build_index();
+
+    EXPECT_FALSE(index.is_csi());
+    EXPECT_EQ(index.reference_count(), 2u);
+
+    // The first two records share a bin and are merged into one chunk.
+    EXPECT_EQ(index.query(0, 0, 1'000), (std::vector<bam_index::chunk>{{0, 20}}));
+    EXPECT_EQ(index.query(0, 40'050, 40'051), (std::vector<bam_index::chunk>{{20, 30}}));
+    EXPECT_EQ(index.query(0, 0, 100'000), (std::vector<bam_index::chunk>{{0, 30}}));
+    EXPECT_TRUE(index.query(0, 60'000, 70'000).empty());
+    EXPECT_TRUE(index.query(1, 0, 100'000).empty());
+    EXPECT_TRUE(index.query(2, 0, 100'000).empty());
+    EXPECT_TRUE(index.query(0, 200, 100).empty());
+}
+
+TEST(bam_index, query_csi)
+{
+    bam_index const index = build_index(uint64_t{1} << 30);
+
+    EXPECT_TRUE(index.is_csi());
+    EXPECT_EQ(index.query(0, 0, 1'000), (std::vector<bam_index::chunk>{{0, 20}}));
+    EXPECT_EQ(index.query(0, 40'050, 40'051), (std::vector<bam_index::chunk>{{20, 30}}));
+    EXPECT_TRUE(index.query(0, 60'000, 70'000).empty());
+}
+
+TEST(bam_index, unsorted)
+{
+    detail::bam_index_builder builder{2, 100'000};
+    builder.push(1, 100, 200, true, 0, 10);
+
+    EXPECT_THROW(builder.push(1, 50, 200, true, 10, 20), format_error);
+    EXPECT_THROW(builder.push(0, 500, 600, true, 10, 20), format_error);
+    EXPECT_THROW(builder.push(2, 500, 600, true, 10, 20), format_error);
+}
+
+TEST(bam_index, record_without_position)
+{
+    // Records with a reference, but without a position, come first within their reference, like in samtools' output.
+    detail::bam_index_builder builder{2, 100'000};
+    builder.push(0, -1, -1, false, 0, 10);
+    builder.push(0, 100, 200, true, 10, 20);
+    builder.push(1, -1, -1, false, 20, 30);
+    builder.push(1, 50, 150, true, 30, 40);
+    EXPECT_THROW(builder.push(0, -1, -1, false, 40, 50), format_error); // reference 0 after reference 1
+    builder.push(-1, -1, -1, false, 40, 50);
+
+    bam_index const index = builder.finish(identity);
+    EXPECT_EQ(index.query(0, 0, 1'000), (std::vector<bam_index::chunk>{{10, 20}}));
+    EXPECT_EQ(index.query(1, 0, 1'000), (std::vector<bam_index::chunk>{{30, 40}}));
+}
+
+TEST(bam_index, write_read)
+{
+    for (uint64_t const maximal_reference_length : {uint64_t{100'000}, uint64_t{1} << 30})
+    {
+        bam_index const index = build_index(maximal_reference_length);
+
+        std::stringstream stream{};
+        index.write(stream);
+        EXPECT_EQ(stream.str().substr(0, 4), index.is_csi() ? "CSI\1" : "BAI\1");
+
+        bam_index read_index{};
+        read_index.read(stream);
+        EXPECT_EQ(read_index, index);
+    }
+}
+
+TEST(bam_index, read_invalid)
+{
+    bam_index index{};
+
+    std::istringstream wrong_magic{"BAM\1"};
+    EXPECT_THROW(index.read(wrong_magic), format_error);
+
+    std::istringstream truncated{std::string{"BAI\1\2\0\0\0", 8}};
+    EXPECT_THROW(index.read(truncated), format_error);
+}
+
+#if SEQAN3_HAS_ZLIB
+// Writes the SAM records to a BAM file with an index, sorted by the file if `sort` is set, and returns the ids of the
+// records in the file and of the records overlapping the regions.
+using region_t = std::tuple<int32_t, int64_t, int64_t>;
+
+std::vector<std::vector<std::string>> write_and_query(std::string const & sam,
+                                                      bool const sort,
+                                                      std::vector<region_t> const & regions)
+{
+    test::tmp_filename const filename{"bam_index.bam"};
+
+    {
+        alignment_file_input fin{std::istringstream{sam}, format_sam{}};
+        alignment_file_output fout{filename.get_path()};
+        fout.options.bam_create_index = true;
+        fout.options.bam_sort_by_coordinate = sort;
+
+        fin | fout;
+    }
+
+    std::filesystem::path index_path = filename.get_path();
+    index_path += ".bai";
+    EXPECT_TRUE(std::filesystem::exists(index_path));
+
+    alignment_file_input fin{filename.get_path(), fields<field::id>{}};
+    std::vector<std::vector<std::string>> result(1);
+
+    for (auto & record : fin)
+        result[0].push_back(get<field::id>(record));
+
+    for (auto const & [ref_id, begin, end] : regions)
+    {
+        fin.set_region(ref_id, begin, end);
+        result.emplace_back();
+
+        for (auto & record : fin)
+            result.back().push_back(get<field::id>(record));
+    }
+
+    return result;
+}
+
+TEST(bam_index, set_region)
+{
+    // Sorted records of length 100 every 100 positions, i.e. several BGZF blocks.
+    std::string const header{"@HD\tVN:1.6\tSO:coordinate\n@SQ\tSN:ref\tLN:200000\n"};
+    std::vector<std::string> records{};
+    for (int32_t position = 0; position < 200'000; position += 100)
+    {
+        records.push_back("read" + std::to_string(position) + "\t0\tref\t" + std::to_string(position + 1) +
+                          "\t60\t100M\t*\t0\t0\t" + std::string(100, 'A') + "\t*\n");
+    }
+
+    std::vector<std::string> expected{};
+    for (int32_t position = 50'000; position < 60'000; position += 100)
+        expected.push_back("read" + std::to_string(position));
+
+    for (bool const sort : {false, true})
+    {
+        std::string sam = header;
+        if (sort) // the file sorts the records
+            std::for_each(records.rbegin(), records.rend(), [&sam] (std::string const & record) { sam += record; });
+        else
+            std::for_each(records.begin(), records.end(), [&sam] (std::string const & record) { sam += record; });
+
+        auto const ids = write_and_query(sam, sort, {{0, 50'050, 60'000}, {0, 200'000, 300'000}});
+        EXPECT_EQ(ids[0].size(), records.size());
+        EXPECT_EQ(ids[1], expected);
+        EXPECT_TRUE(ids[2].empty()); // a region without records
+    }
+}
+
+TEST(bam_index, record_without_position_in_file)
+{
+    std::string const header{"@HD\tVN:1.6\tSO:coordinate\n@SQ\tSN:ref\tLN:1000\n@SQ\tSN:ref2\tLN:1000\n"};
+    std::vector<std::string> const records{"no_pos1\t4\tref\t0\t0\t*\t*\t0\t0\tACGT\t*\n",
+                                           "read100\t0\tref\t101\t60\t4M\t*\t0\t0\tACGT\t*\n",
+                                           "no_pos2\t4\tref2\t0\t0\t*\t*\t0\t0\tACGT\t*\n",
+                                           "read50\t0\tref2\t51\t60\t4M\t*\t0\t0\tACGT\t*\n",
+                                           "unplaced\t4\t*\t0\t0\t*\t*\t0\t0\tACGT\t*\n"};
+    std::vector<std::string> const expected{"no_pos1", "read100", "no_pos2", "read50", "unplaced"};
+
+    // sorted like samtools sorts
+    std::string sam = header;
+    for (std::string const & record : records)
+        sam += record;
+
+    auto ids = write_and_query(sam, false, {{0, 0, 1'000}, {1, 0, 1'000}});
+    EXPECT_EQ(ids[0], expected);
+    EXPECT_EQ(ids[1], (std::vector<std::string>{"read100"}));
+    EXPECT_EQ(ids[2], (std::vector<std::string>{"read50"}));
+
+    // sorted by the file
+    sam = header + records[4] + records[3] + records[1] + records[2] + records[0];
+
+    ids = write_and_query(sam, true, {{0, 0, 1'000}, {1, 0, 1'000}});
+    EXPECT_EQ(ids[0], expected);
+    EXPECT_EQ(ids[1], (std::vector<std::string>{"read100"}));
+    EXPECT_EQ(ids[2], (std::vector<std::string>{"read50"}));
+}
+#endif // SEQAN3_HAS_ZLIB
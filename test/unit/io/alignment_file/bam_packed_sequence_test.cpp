@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/io/alignment_file/bam_packed_sequence.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+
+using namespace seqan3;
+
+TEST(bam_packed_sequence, encode)
+{
+    std::string packed{"x"};
+    detail::encode_bam_bases("ACGTN"_dna15, 5, packed);
+    EXPECT_EQ(packed, (std::string{'x', '\x12', '\x48', '\xF0'}));
+
+    packed.clear();
+    detail::encode_bam_bases("ACGT"_dna4, 4, packed);
+    EXPECT_EQ(packed, (std::string{'\x12', '\x48'}));
+
+    packed.clear();
+    detail::encode_bam_bases("ACGT"_dna4, 0, packed);
+    EXPECT_TRUE(packed.empty());
+}
+
+TEST(bam_packed_sequence, decode)
+{
+    dna15_vector const sequence{"ACGTNRYACGT"_dna15};
+    std::string packed{};
+    detail::encode_bam_bases(sequence, sequence.size(), packed);
+
+    for (size_t begin = 0; begin <= sequence.size(); ++begin)
+    {
+        for (size_t end = begin; end <= sequence.size(); ++end)
+        {
+            dna15_vector const expected(sequence.begin() + begin, sequence.begin() + end);
+
+            dna15_vector contiguous{};
+            detail::append_decoded(contiguous, end - begin, [&] (auto it)
+            {
+                detail::decode_bam_bases<dna15>(packed.data(), begin, end, it);
+            });
+            EXPECT_EQ(contiguous, expected);
+
+            std::list<dna15> list{};
+            detail::append_decoded(list, end - begin, [&] (auto it)
+            {
+                detail::decode_bam_bases<dna15>(packed.data(), begin, end, it);
+            });
+            EXPECT_TRUE(std::ranges::equal(list, expected));
+        }
+    }
+
+    // converts to the target alphabet
+    std::vector<dna4> dna4_sequence(sequence.size());
+    detail::decode_bam_bases<dna4>(packed.data(), 0, sequence.size(), dna4_sequence.data());
+    EXPECT_EQ(dna4_sequence, "ACGTAACACGT"_dna4);
+
+    std::vector<sam_dna16> sam_dna16_sequence(sequence.size());
+    detail::decode_bam_bases<sam_dna16>(packed.data(), 0, sequence.size(), sam_dna16_sequence.data());
+    EXPECT_EQ(sam_dna16_sequence, "ACGTNRYACGT"_sam_dna16);
+}
+
+TEST(bam_packed_sequence, decode_qualities)
+{
+    std::string const phred_scores{'\x00', '\x09', '\x28', '\x32'};
+
+    std::vector<phred42> qualities{};
+    detail::append_decoded(qualities, phred_scores.size(), [&] (auto it)
+    {
+        detail::decode_bam_qualities<phred42>(phred_scores.data(), phred_scores.size(), it);
+    });
+    EXPECT_EQ(qualities, "!*IJ"_phred42); // scores above 41 are clamped
+}
+
+TEST(bam_packed_sequence, read_qualities)
+{
+    std::ostringstream bam_stream{};
+
+    {
+        alignment_file_output fout{bam_stream, format_bam{}, fields<field::seq, field::qual>{}};
+        fout.emplace_back("ACG"_dna5, "*!#"_phred42); // '*' is the SAM character for missing qualities
+        fout.emplace_back("ACGTA"_dna5, std::vector<phred42>{});
+    }
+
+    alignment_file_input fin{std::istringstream{bam_stream.str()}, format_bam{}, fields<field::seq, field::qual>{}};
+    auto it = fin.begin();
+    EXPECT_EQ(get<field::seq>(*it), "ACG"_dna5);
+    EXPECT_EQ(get<field::qual>(*it), "*!#"_phred42);
+    ++it;
+    EXPECT_EQ(get<field::seq>(*it), "ACGTA"_dna5);
+    EXPECT_TRUE(get<field::qual>(*it).empty()); // stored as 0xFF
+}
@@ -0,0 +1,126 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/alignment_file/bam_record_sorter.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using seqan3::detail::bam_record_sorter;
+
+// Creates a record that consists of block_size, refID, pos and the number as payload.
+std::string make_record(int32_t const ref_id, int32_t const pos, uint32_t const number)
+{
+    std::string record(16, '\0');
+    int32_t const block_size = 12;
+    std::memcpy(record.data(), &block_size, 4);
+    std::memcpy(record.data() + 4, &ref_id, 4);
+    std::memcpy(record.data() + 8, &pos, 4);
+    std::memcpy(record.data() + 12, &number, 4);
+    return record;
+}
+
+uint32_t number_of(std::string_view const record)
+{
+    uint32_t number{};
+    std::memcpy(&number, record.data() + 12, 4);
+    return number;
+}
+
+std::vector<uint32_t> sort_records(size_t const memory_limit, size_t const thread_count)
+{
+    seqan3::test::tmp_filename const tmp_directory{"bam_sort"};
+    std::filesystem::create_directory(tmp_directory.get_path());
+
+    bam_record_sorter sorter{memory_limit, thread_count, tmp_directory.get_path()};
+
+    for (uint32_t i = 0; i < 5000; ++i)
+    {
+        if (i % 7 == 0)
+            sorter.push(make_record(-1, -1, i)); // unplaced
+        else
+            sorter.push(make_record(i % 3, (i * 37) % 100, i));
+    }
+
+    std::vector<uint32_t> numbers{};
+    sorter.finish([&] (std::string_view const record)
+    {
+        EXPECT_EQ(record.size(), 16u);
+        numbers.push_back(number_of(record));
+    });
+
+    // all run files are removed
+    EXPECT_TRUE(std::filesystem::is_empty(tmp_directory.get_path()));
+    return numbers;
+}
+
+std::vector<uint32_t> expected_numbers()
+{
+    std::vector<uint32_t> numbers(5000);
+    for (uint32_t i = 0; i < 5000; ++i)
+        numbers[i] = i;
+
+    std::stable_sort(numbers.begin(), numbers.end(), [] (uint32_t const lhs, uint32_t const rhs)
+    {
+        return bam_record_sorter::sort_key(make_record(lhs % 7 ? lhs % 3 : -1, lhs % 7 ? (lhs * 37) % 100 : -1, lhs)) <
+               bam_record_sorter::sort_key(make_record(rhs % 7 ? rhs % 3 : -1, rhs % 7 ? (rhs * 37) % 100 : -1, rhs));
+    });
+
+    return numbers;
+}
+
+TEST(bam_record_sorter, sort_key)
+{
+    EXPECT_LT(bam_record_sorter::sort_key(make_record(0, 5, 0)), bam_record_sorter::sort_key(make_record(0, 6, 0)));
+    EXPECT_LT(bam_record_sorter::sort_key(make_record(0, 6, 0)), bam_record_sorter::sort_key(make_record(1, 0, 0)));
+    EXPECT_LT(bam_record_sorter::sort_key(make_record(1, 0, 0)), bam_record_sorter::sort_key(make_record(-1, -1, 0)));
+    EXPECT_LT(bam_record_sorter::sort_key(make_record(0, -1, 0)), bam_record_sorter::sort_key(make_record(0, 0, 0)));
+    EXPECT_LT(bam_record_sorter::sort_key(make_record(0, 99, 0)), bam_record_sorter::sort_key(make_record(1, -1, 0)));
+    EXPECT_LT(bam_record_sorter::sort_key(make_record(1, std::numeric_limits<int32_t>::max(), 0)),
+              bam_record_sorter::sort_key(make_record(-1, -1, 0)));
+}
+
+TEST(bam_record_sorter, reference_without_position)
+{
+    bam_record_sorter sorter{1000, 2, {}};
+    sorter.push(make_record(-1, -1, 0));
+    sorter.push(make_record(1, 10, 1));
+    sorter.push(make_record(0, 5, 2));
+    sorter.push(make_record(0, -1, 3)); // first within reference 0
+    sorter.push(make_record(1, -1, 4)); // first within reference 1, before the unplaced record
+
+    std::vector<uint32_t> numbers{};
+    sorter.finish([&] (std::string_view const record) { numbers.push_back(number_of(record)); });
+    EXPECT_EQ(numbers, (std::vector<uint32_t>{3, 2, 4, 1, 0}));
+}
+
+TEST(bam_record_sorter, in_memory)
+{
+    EXPECT_EQ(sort_records(1ull << 30, 1), expected_numbers());
+    EXPECT_EQ(sort_records(1ull << 30, 4), expected_numbers());
+}
+
+TEST(bam_record_sorter, temporary_files)
+{
+    EXPECT_EQ(sort_records(4000, 1), expected_numbers()); // 125 records per temporary file
+    EXPECT_EQ(sort_records(4000, 4), expected_numbers());
+}
+
+TEST(bam_record_sorter, no_records)
+{
+    bam_record_sorter sorter{1000, 2, {}};
+
+    size_t count = 0;
+    sorter.finish([&] (std::string_view) { ++count; });
+    EXPECT_EQ(count, 0u);
+}
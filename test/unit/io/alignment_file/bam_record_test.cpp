@@ -0,0 +1,120 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+
+using namespace seqan3;
+
+std::string const sam
+{
+    "@HD\tVN:1.6\n"
+    "@SQ\tSN:ref\tLN:34\n"
+    "read1\t41\tref\t1\t61\t1S1M1D1M1I\tref\t10\t300\tACGT\t!##$\tAS:i:2\tNM:i:7\n"
+    "read2\t42\tref\t2\t62\t1H7M1D1M1S2H\tref\t10\t300\tAGGCTGNAG\t!##$&'()*\txy:B:S,3,4,5\n"
+    "read3\t4\t*\t0\t0\t*\t*\t0\t0\tAGG\t*\n"
+};
+
+// Converts the SAM records above to BAM.
+std::string to_bam(std::string const & sam_input)
+{
+    std::ostringstream bam_stream{};
+
+    {
+        alignment_file_input fin{std::istringstream{sam_input}, format_sam{}};
+        alignment_file_output fout{bam_stream, format_bam{}};
+        fin | fout;
+    }
+
+    return bam_stream.str();
+}
+
+TEST(bam_record, fields)
+{
+    std::istringstream stream{to_bam(sam)};
+    alignment_file_input fin{stream, format_bam{}};
+
+    bam_record record{};
+    ASSERT_TRUE(fin.read_raw_record(record));
+
+    ASSERT_EQ(fin.header().ref_ids().size(), 1u);
+    EXPECT_EQ(fin.header().ref_ids()[0], "ref");
+    EXPECT_EQ(record.id(), "read1");
+    EXPECT_EQ(record.ref_id(), 0);
+    EXPECT_EQ(record.ref_offset(), 0);
+    EXPECT_EQ(record.flag(), sam_flag{41u});
+    EXPECT_EQ(record.mapq(), 61u);
+    EXPECT_EQ(record.mate(), (std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>{0, 9, 300}));
+    EXPECT_EQ(record.cigar_vector(), (std::vector<cigar>{{1, 'S'_cigar_op}, {1, 'M'_cigar_op}, {1, 'D'_cigar_op},
+                                                         {1, 'M'_cigar_op}, {1, 'I'_cigar_op}}));
+    EXPECT_EQ(record.sequence_size(), 4u);
+    EXPECT_EQ(record.sequence(), "ACGT"_dna5);
+    EXPECT_EQ(record.sequence<dna4>(), "ACGT"_dna4);
+    EXPECT_EQ(record.quality(), "!##$"_phred42);
+    EXPECT_EQ(record.tags(), (sam_tag_dictionary{{"AS"_tag, 2}, {"NM"_tag, 7}}));
+
+    ASSERT_TRUE(fin.read_raw_record(record));
+    EXPECT_EQ(record.id(), "read2");
+    EXPECT_EQ(record.sequence(), "AGGCTGNAG"_dna5); // odd length
+    sam_tag_dictionary const tags = record.tags();
+    EXPECT_EQ(tags.at("xy"_tag), (sam_tag_dictionary::variant_type{std::vector<uint16_t>{3, 4, 5}}));
+
+    ASSERT_TRUE(fin.read_raw_record(record));
+    EXPECT_EQ(record.id(), "read3");
+    EXPECT_FALSE(record.ref_id().has_value());
+    EXPECT_FALSE(record.ref_offset().has_value());
+    EXPECT_TRUE(record.cigar_vector().empty());
+    EXPECT_TRUE(record.quality().empty());
+    EXPECT_TRUE(record.tags().empty());
+
+    EXPECT_FALSE(fin.read_raw_record(record));
+    EXPECT_FALSE(fin.read_raw_record(record));
+}
+
+TEST(bam_record, assign)
+{
+    std::istringstream stream{to_bam(sam)};
+    alignment_file_input fin{stream, format_bam{}};
+
+    bam_record record{};
+    ASSERT_TRUE(fin.read_raw_record(record));
+
+    bam_record const copy{record.bytes()};
+    EXPECT_EQ(copy.id(), "read1");
+    EXPECT_EQ(copy.sequence(), "ACGT"_dna5);
+
+    // the lengths of the fields exceed the record
+    EXPECT_THROW(bam_record{record.bytes().substr(0, 40)}, format_error);
+    EXPECT_THROW(bam_record{record.bytes().substr(0, 10)}, format_error);
+}
+
+TEST(bam_record, mixed_reading)
+{
+    {
+        std::istringstream stream{to_bam(sam)};
+        alignment_file_input fin{stream, format_bam{}};
+        fin.begin();
+
+        bam_record record{};
+        EXPECT_THROW(fin.read_raw_record(record), std::logic_error);
+    }
+
+    {
+        alignment_file_input fin{std::istringstream{sam}, format_sam{}};
+
+        bam_record record{};
+        EXPECT_THROW(fin.read_raw_record(record), std::logic_error);
+    }
+}
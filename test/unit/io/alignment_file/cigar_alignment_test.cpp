@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+
+template <typename row_t>
+std::string to_string(row_t && row)
+{
+    return row | views::to_char | views::to<std::string>;
+}
+
+TEST(lazy_alignment_from_cigar, rows)
+{
+    std::vector<cigar> const cigar_vector{{1, 'S'_cigar_op}, {2, 'M'_cigar_op}, {1, 'I'_cigar_op}, {1, 'P'_cigar_op},
+                                          {2, 'M'_cigar_op}, {1, 'D'_cigar_op}, {1, 'M'_cigar_op}, {2, 'H'_cigar_op}};
+    dna5_vector const reference{"ACTAGC"_dna5};
+    dna5_vector const query{"TACGTAC"_dna5};
+
+    auto [reference_row, query_row] = lazy_alignment_from_cigar(cigar_vector, reference, query);
+
+    EXPECT_TRUE(std::ranges::forward_range<decltype(reference_row)>);
+    EXPECT_TRUE(std::ranges::view<decltype(reference_row)>);
+    EXPECT_TRUE(std::ranges::sized_range<decltype(query_row)>);
+
+    EXPECT_EQ(reference_row.size(), 8u);
+    EXPECT_EQ(query_row.size(), 8u);
+    EXPECT_EQ(to_string(reference_row), "AC--TAGC");
+    EXPECT_EQ(to_string(query_row), "ACG-TA-C");
+    EXPECT_EQ(to_string(std::as_const(reference_row)), "AC--TAGC");
+}
+
+TEST(lazy_alignment_from_cigar, no_columns)
+{
+    std::vector<cigar> const empty{};
+    std::vector<cigar> const clipped{{3, 'S'_cigar_op}, {2, 'H'_cigar_op}};
+    dna5_vector const query{"ACG"_dna5};
+
+    auto [empty_reference, empty_query] = lazy_alignment_from_cigar(empty, dna5_vector{}, query);
+    EXPECT_TRUE(std::ranges::empty(empty_reference));
+    EXPECT_TRUE(std::ranges::empty(empty_query));
+
+    auto [clipped_reference, clipped_query] = lazy_alignment_from_cigar(clipped, dna5_vector{}, query);
+    EXPECT_EQ(clipped_query.size(), 0u);
+    EXPECT_TRUE(clipped_query.begin() == clipped_query.end());
+}
+
+TEST(lazy_alignment_from_cigar, same_as_field_alignment)
+{
+    std::string const sam
+    {
+        "@SQ\tSN:ref\tLN:34\n"
+        "read1\t41\tref\t1\t61\t1S1M1D1M1I\t*\t0\t0\tACGT\t*\n"
+        "read2\t42\tref\t2\t62\t1H7M1D1M1S2H\t*\t0\t0\tAGGCTGNAG\t*\n"
+        "read3\t43\tref\t3\t63\t1S1M1P1M1I1M1I1D1M1S\t*\t0\t0\tGGAGTATA\t*\n"
+    };
+    std::vector<std::string> const ref_ids{"ref"};
+    std::vector<dna5_vector> const ref_seqs{"AGAGTATCGATGTACGATAGCTAGCTAGCTAGCT"_dna5};
+
+    alignment_file_input fin{std::istringstream{sam}, ref_ids, ref_seqs, format_sam{},
+                             fields<field::seq, field::ref_offset, field::alignment, field::cigar>{}};
+
+    for (auto & [seq, ref_offset, alignment, cigar_vector] : fin)
+    {
+        auto [reference_row, query_row] = lazy_alignment_from_cigar(cigar_vector,
+                                                                    ref_seqs[0] | std::views::drop(*ref_offset),
+                                                                    seq);
+        EXPECT_EQ(to_string(reference_row), to_string(std::get<0>(alignment)));
+        EXPECT_EQ(to_string(query_row), to_string(std::get<1>(alignment)));
+    }
+}
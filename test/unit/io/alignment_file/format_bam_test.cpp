@@ -271,6 +271,38 @@ TEST_F(bam_format, unknown_ref_in_header)
     EXPECT_THROW(fin.begin(), format_error);
 }
 
+TEST_F(bam_format, references_only_in_binary_header)
+{
+    std::string no_sq_lines{ // no header text; the references chr1 (LN:34) and chr2 (LN:30) are in the binary block
+        '\x42', '\x41', '\x4D', '\x01', '\x00', '\x00', '\x00', '\x00', '\x02', '\x00', '\x00', '\x00', '\x05',
+        '\x00', '\x00', '\x00', '\x63', '\x68', '\x72', '\x31', '\x00', '\x22', '\x00', '\x00', '\x00', '\x05',
+        '\x00', '\x00', '\x00', '\x63', '\x68', '\x72', '\x32', '\x00', '\x1E', '\x00', '\x00', '\x00'
+    };
+
+    std::istringstream stream{no_sq_lines};
+    alignment_file_input fin{stream, format_bam{}};
+    EXPECT_TRUE(fin.begin() == fin.end());
+
+    auto & header = fin.header();
+    EXPECT_EQ(header.ref_ids(), (std::deque<std::string>{"chr1", "chr2"}));
+    EXPECT_EQ(header.ref_id_info, (std::vector<std::tuple<int32_t, std::string>>{{34, ""}, {30, ""}}));
+    ASSERT_EQ(header.ref_dict.size(), 2u);
+    EXPECT_EQ(header.ref_dict[header.ref_ids()[0]], 0);
+    EXPECT_EQ(header.ref_dict[header.ref_ids()[1]], 1);
+}
+
+TEST_F(bam_format, header_text_with_padding)
+{
+    // @SQ     SN:ref  LN:34, followed by three NUL characters that are part of l_text
+    std::string const padded_text{"BAM\1\x14\0\0\0@SQ\tSN:ref\tLN:34\n\0\0\0\1\0\0\0\4\0\0\0ref\0\x22\0\0\0", 44};
+
+    std::istringstream stream{padded_text};
+    alignment_file_input fin{stream, format_bam{}};
+    EXPECT_TRUE(fin.begin() == fin.end());
+    EXPECT_EQ(fin.header().ref_ids(), (std::deque<std::string>{"ref"}));
+    EXPECT_EQ(fin.header().ref_id_info, (std::vector<std::tuple<int32_t, std::string>>{{34, ""}}));
+}
+
 TEST_F(bam_format, wrong_ref_length_in_header)
 {
     std::string wrong_ref_length{ // 33 instead of 34
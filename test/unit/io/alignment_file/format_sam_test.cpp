@@ -187,6 +187,16 @@ TEST_F(sam_format, windows_file)
     EXPECT_EQ(get<field::id>(*fin.begin()), std::string{"read1"});
 }
 
+TEST_F(sam_format, hex_string_tag)
+{
+    std::istringstream istream(std::string("read1\t4\t*\t0\t0\t*\t*\t0\t0\tACGT\t*\tXH:H:1AE3\tNM:i:1\n"));
+    alignment_file_input fin{istream, format_sam{}, fields<field::tags>{}};
+
+    auto & tags = get<field::tags>(*fin.begin());
+    EXPECT_EQ(std::get<std::string>(tags["XH"_tag]), "1AE3");
+    EXPECT_EQ(tags.get<"NM"_tag>(), 1);
+}
+
 TEST_F(sam_format, format_error_illegal_character_in_seq)
 {
     std::istringstream istream(std::string("*\t0\t*\t0\t0\t*\t*\t0\t0\tAC!T\t*\n"));
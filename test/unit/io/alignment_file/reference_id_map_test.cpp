@@ -0,0 +1,117 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/alignment_file/header.hpp>
+#include <seqan3/io/alignment_file/reference_id_map.hpp>
+#include <seqan3/range/hash.hpp>
+#include <seqan3/range/views/type_reduce.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+using namespace seqan3;
+
+using key_type = std::span<char const>;
+
+TEST(reference_id_map, insert_and_find)
+{
+    std::deque<std::string> ids{"chr1", "chr2", "chrX"};
+    detail::reference_id_map<key_type> map{};
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.find(ids[0]) == map.end());
+
+    for (size_t i = 0; i < ids.size(); ++i)
+        map[ids[i]] = i;
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map[std::string{"chr2"}], 1);
+    EXPECT_EQ(map.count(std::string{"chrX"}), 1u);
+    EXPECT_EQ(map.count(std::string{"chrY"}), 0u);
+    EXPECT_TRUE(map.find(std::string{"chr"}) == map.end());
+
+    auto it = map.find(std::string{"chr1"});
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(it->second, 0);
+    EXPECT_EQ(map.size(), 3u); // lookups do not insert
+
+    // entries are iterated in the order of their insertion
+    std::vector<int32_t> positions{};
+    for (auto const & [id, pos] : map)
+    {
+        EXPECT_TRUE(std::ranges::equal(id, ids[pos]));
+        positions.push_back(pos);
+    }
+    EXPECT_EQ(positions, (std::vector<int32_t>{0, 1, 2}));
+}
+
+TEST(reference_id_map, many_references)
+{
+    std::deque<std::string> ids{};
+    for (size_t i = 0; i < 10'000; ++i)
+        ids.push_back("scaffold_" + std::to_string(i));
+
+    detail::reference_id_map<key_type> grown{};
+    detail::reference_id_map<key_type> reserved{};
+    reserved.reserve(ids.size());
+
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        grown[ids[i]] = i;
+        reserved[ids[i]] = i;
+    }
+
+    EXPECT_EQ(grown.size(), ids.size());
+    EXPECT_EQ(reserved.size(), ids.size());
+
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        ASSERT_TRUE(grown.find(ids[i]) != grown.end());
+        EXPECT_EQ(grown.find(ids[i])->second, static_cast<int32_t>(i));
+        EXPECT_EQ(reserved.find(ids[i])->second, static_cast<int32_t>(i));
+    }
+
+    EXPECT_TRUE(grown.find(std::string{"scaffold_10000"}) == grown.end());
+}
+
+TEST(reference_id_map, copy_and_clear)
+{
+    std::deque<std::string> ids{"chr1", "chr2"};
+    detail::reference_id_map<key_type> map{};
+    map[ids[0]] = 0;
+    map[ids[1]] = 1;
+
+    detail::reference_id_map<key_type> copy{map};
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.find(ids[0]) == map.end());
+
+    EXPECT_EQ(copy.size(), 2u);
+    EXPECT_EQ(copy.find(ids[1])->second, 1);
+
+    map[ids[1]] = 0; // the table is reused after clear()
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(map.find(ids[1])->second, 0);
+}
+
+TEST(reference_id_map, non_contiguous_ids)
+{
+    using ids_type = std::deque<std::deque<dna4>>;
+    ids_type ids{{'A'_dna4, 'C'_dna4}, {'G'_dna4, 'T'_dna4}};
+
+    alignment_file_header<ids_type> header{ids};
+    header.ref_dict[header.ref_ids()[0]] = 0;
+    header.ref_dict[header.ref_ids()[1]] = 1;
+
+    EXPECT_EQ(header.ref_dict.count(header.ref_ids()[1]), 1u);
+    EXPECT_EQ(header.ref_dict.find(header.ref_ids()[1])->second, 1);
+}
@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
 #include <seqan3/std/concepts>
@@ -159,3 +163,105 @@ TEST(sam_tag_dictionary, get_function_temporary_const)
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CO"_tag>())>));
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CG"_tag>())>));
 }
+
+TEST(sam_tag_dictionary, map_interface)
+{
+    sam_tag_dictionary dict{{"NM"_tag, 3}, {"AS"_tag, 2}, {"NM"_tag, 4}}; // for duplicates the first value is kept
+
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_FALSE(dict.empty());
+    EXPECT_EQ(dict.at("NM"_tag), sam_tag_dictionary::variant_type{3});
+    EXPECT_THROW(dict.at("XY"_tag), std::out_of_range);
+    EXPECT_TRUE(dict.contains("AS"_tag));
+    EXPECT_EQ(dict.count("XY"_tag), 0u);
+    EXPECT_TRUE(dict.find("XY"_tag) == dict.end());
+
+    EXPECT_FALSE(dict.emplace("NM"_tag, 5).second);
+    EXPECT_TRUE(dict.insert({"CO"_tag, std::string{"comment"}}).second);
+
+    // the tags are sorted by their id
+    std::vector<uint16_t> tags{};
+    for (auto & [tag, value] : dict)
+        tags.push_back(tag);
+    EXPECT_EQ(tags, (std::vector<uint16_t>{"AS"_tag, "CO"_tag, "NM"_tag}));
+
+    EXPECT_EQ(dict.erase("CO"_tag), 1u);
+    EXPECT_EQ(dict.erase("CO"_tag), 0u);
+    dict.erase(dict.find("AS"_tag));
+    EXPECT_EQ(dict, (sam_tag_dictionary{{"NM"_tag, 3}}));
+    EXPECT_NE(dict, sam_tag_dictionary{});
+
+    dict = {};
+    EXPECT_TRUE(dict.empty());
+}
+
+TEST(sam_tag_dictionary, const_keys)
+{
+    // like for std::map, tag ids cannot be changed through an iterator, which would break the order of the tags
+    static_assert(!std::is_assignable_v<decltype((std::declval<sam_tag_dictionary::iterator &>()->first)), uint16_t>);
+    static_assert(std::is_assignable_v<decltype((std::declval<sam_tag_dictionary::iterator &>()->second)), int32_t>);
+
+    sam_tag_dictionary dict{{"NM"_tag, 3}, {"XS"_tag, 1}};
+    dict["AS"_tag] = 2;                             // insert at the front
+    dict.emplace("CO"_tag, std::string{"comment"}); // insert in the middle
+    dict.erase("NM"_tag);                           // erase in the middle
+
+    std::vector<uint16_t> tags{};
+    for (auto & [tag, value] : dict)
+        tags.push_back(tag);
+    EXPECT_EQ(tags, (std::vector<uint16_t>{"AS"_tag, "CO"_tag, "XS"_tag}));
+    EXPECT_EQ(dict.at("CO"_tag), sam_tag_dictionary::variant_type{std::string{"comment"}});
+
+    sam_tag_dictionary copy{{"RG"_tag, std::string{"group1"}}};
+    copy = dict;
+    EXPECT_EQ(copy, dict);
+}
+
+TEST(sam_tag_dictionary, bam_tags)
+{
+    using namespace std::string_literals;
+
+    // NM:C:5, AS:s:-300, CO:Z:hi, XH:H:1A, FZ:B:S,1,2
+    std::string const binary{"NMC\x05"
+                             "ASs\xd4\xfe"
+                             "COZhi\0"
+                             "XHH1A\0"
+                             "FZBS\x02\0\0\0\x01\0\x02\0"s};
+
+    sam_tag_dictionary dict{};
+    dict.assign_bam_tags(binary);
+    EXPECT_EQ(dict.bam_tags(), binary);
+    EXPECT_FALSE(dict.empty());
+
+    // decoded on first access
+    EXPECT_EQ(dict.get<"NM"_tag>(), 5);
+    EXPECT_TRUE(dict.bam_tags().empty());
+    EXPECT_EQ(dict.size(), 5u);
+    EXPECT_EQ(dict.get<"AS"_tag>(), -300);
+    EXPECT_EQ(dict.get<"CO"_tag>(), "hi");
+    EXPECT_EQ(dict.get<"FZ"_tag>(), (std::vector<uint16_t>{1, 2}));
+    EXPECT_EQ(std::get<std::string>(dict["XH"_tag]), "1A"); // hex strings are read as strings, like in SAM files
+
+    // the tags are sorted by their id
+    std::vector<uint16_t> tags{};
+    for (auto const & [tag, value] : dict)
+        tags.push_back(tag);
+    EXPECT_TRUE(std::is_sorted(tags.begin(), tags.end()));
+
+    // const access decodes as well
+    dict.assign_bam_tags(binary);
+    sam_tag_dictionary const & const_dict = dict;
+    EXPECT_EQ(const_dict.get<"NM"_tag>(), 5);
+
+    // the last value of a duplicated tag is kept
+    dict.assign_bam_tags("NMC\x05" "ASC\x01" "NMC\x07"s);
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 7);
+    EXPECT_EQ(dict.get<"AS"_tag>(), 1);
+
+    // malformed tags are reported on access
+    dict.assign_bam_tags("NMi\x05"s);
+    EXPECT_THROW(dict.size(), format_error);
+    dict.assign_bam_tags("NMx\x05"s);
+    EXPECT_THROW(dict.find("NM"_tag), format_error);
+}
@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <seqan3/io/detail/async_istream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+
+using seqan3::detail::basic_async_istream;
+
+// A stream buffer that throws after a few characters to simulate a decompression error.
+class failing_stream_buffer : public std::streambuf
+{
+protected:
+    int_type underflow() override
+    {
+        if (calls++ > 3)
+            throw std::runtime_error{"decompression failed"};
+
+        setg(&character, &character, &character + 1);
+        return traits_type::to_int_type(character);
+    }
+
+private:
+    char character{'a'};
+    size_t calls{0};
+};
+
+// A stream that owns its failing stream buffer.
+class failing_stream : public std::istream
+{
+public:
+    failing_stream() : std::istream{nullptr}
+    {
+        init(&buffer);
+    }
+
+private:
+    failing_stream_buffer buffer{};
+};
+
+std::string make_input()
+{
+    std::string input{};
+    for (size_t i = 0; i < 100000; ++i)
+        input += std::to_string(i);
+    return input;
+}
+
+TEST(async_istream, concept_check)
+{
+    EXPECT_TRUE((seqan3::input_stream_over<basic_async_istream<char>, char>));
+}
+
+TEST(async_istream, read)
+{
+    std::string const input = make_input();
+
+    for (size_t block_size : {1u, 7u, 1000u, 1000000u})
+    {
+        basic_async_istream<char> stream{std::make_unique<std::istringstream>(input), block_size, 2};
+        std::string buffer{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+
+        EXPECT_EQ(buffer, input);
+    }
+}
+
+TEST(async_istream, empty_input)
+{
+    basic_async_istream<char> stream{std::make_unique<std::istringstream>(std::string{})};
+    std::string buffer{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(async_istream, destroy_before_end)
+{
+    basic_async_istream<char> stream{std::make_unique<std::istringstream>(make_input()), 3, 2};
+    char c{};
+    stream.get(c);
+
+    EXPECT_EQ(c, '0');
+} // must not block
+
+TEST(async_istream, exception)
+{
+    basic_async_istream<char> stream{std::make_unique<failing_stream>(), 2, 2};
+
+    EXPECT_THROW((std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}}),
+                 std::runtime_error);
+}
@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/detail/async_record_writer.hpp>
+
+using seqan3::detail::async_record_writer;
+
+TEST(async_record_writer, order)
+{
+    std::string output{};
+    std::string expected{};
+
+    {
+        async_record_writer writer{4, 2};
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            writer.push(i, [&output] (size_t & number) { output += std::to_string(number) + "\n"; });
+            expected += std::to_string(i) + "\n";
+        }
+
+        writer.finish();
+    }
+
+    EXPECT_EQ(output, expected);
+}
+
+TEST(async_record_writer, different_record_types)
+{
+    std::string output{};
+
+    {
+        async_record_writer writer{4, 2};
+        auto write = [&output] (auto & record) { output += record; };
+
+        writer.push(std::string{"a"}, write);
+        writer.push('b', write); // starts a new batch
+        writer.push(std::string{"c"}, write);
+        writer.push(std::string{"d"}, write);
+    } // the destructor writes the remaining records
+
+    EXPECT_EQ(output, "abcd");
+}
+
+TEST(async_record_writer, exception)
+{
+    async_record_writer writer{1, 1};
+    auto write = [] (size_t & number)
+    {
+        if (number == 3)
+            throw std::runtime_error{"disk full"};
+    };
+
+    EXPECT_THROW(
+    {
+        for (size_t i = 0; i < 100000; ++i) // propagated by one of the following calls to push()
+            writer.push(i, write);
+    }, std::runtime_error);
+
+    EXPECT_THROW(writer.push(size_t{0}, write), std::runtime_error); // the writer stays stopped
+    EXPECT_THROW(writer.finish(), std::runtime_error);
+}
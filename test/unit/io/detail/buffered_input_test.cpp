@@ -0,0 +1,126 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/char_operations/predicate.hpp>
+#include <seqan3/io/detail/buffered_input.hpp>
+
+using seqan3::operator""_dna4;
+
+// A stream buffer that only exposes a few characters at a time to test the handling of the buffer boundaries.
+class small_stream_buffer : public std::streambuf
+{
+public:
+    small_stream_buffer(std::string input, size_t const chunk_size) : data{std::move(input)}, chunk_size{chunk_size}
+    {}
+
+protected:
+    int_type underflow() override
+    {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+
+        if (position == data.size())
+            return traits_type::eof();
+
+        size_t const count = std::min(chunk_size, data.size() - position);
+        setg(data.data() + position, data.data() + position, data.data() + position + count);
+        position += count;
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    std::string data;
+    size_t chunk_size;
+    size_t position{};
+};
+
+TEST(char_conversion_table, category_and_value)
+{
+    seqan3::detail::char_conversion_table<seqan3::dna4> table{seqan3::is_space,
+                                                              seqan3::is_in_alphabet<seqan3::dna4>};
+
+    EXPECT_EQ(table.category('A'), seqan3::detail::char_category::take);
+    EXPECT_EQ(table.category('g'), seqan3::detail::char_category::take);
+    EXPECT_EQ(table.category('\n'), seqan3::detail::char_category::skip);
+    EXPECT_EQ(table.category(' '), seqan3::detail::char_category::skip);
+    EXPECT_EQ(table.category('!'), seqan3::detail::char_category::reject);
+    EXPECT_EQ(table.category(static_cast<char>(200)), seqan3::detail::char_category::reject);
+
+    EXPECT_EQ(table.value('A'), 'A'_dna4);
+    EXPECT_EQ(table.value('g'), 'G'_dna4);
+    EXPECT_EQ(table.value('U'), 'T'_dna4);
+}
+
+TEST(find_first_delimiter, basic)
+{
+    EXPECT_EQ((seqan3::detail::find_first_delimiter<'>', ';'>("ACGT\n>ID;")), 5u);
+    EXPECT_EQ((seqan3::detail::find_first_delimiter<'>', ';'>("ACGT;>ID")), 4u);
+    EXPECT_EQ((seqan3::detail::find_first_delimiter<'>', ';'>("ACGT")), 4u);
+    EXPECT_EQ((seqan3::detail::find_first_delimiter<'>'>("")), 0u);
+}
+
+TEST(consume_buffered_until, buffer_boundaries)
+{
+    for (size_t chunk_size : {1u, 2u, 3u, 7u, 100u})
+    {
+        small_stream_buffer buffer{"ACGT\nACGT\n>ID", chunk_size};
+        seqan3::detail::fast_istreambuf_iterator<char> it{buffer};
+
+        std::string consumed{};
+        EXPECT_TRUE(seqan3::detail::consume_buffered_until<'>'>(it, [&] (std::string_view const chunk)
+        {
+            EXPECT_LE(chunk.size(), chunk_size);
+            consumed.append(chunk);
+        }));
+
+        EXPECT_EQ(consumed, "ACGT\nACGT\n");
+        EXPECT_EQ(*it, '>');
+        ++it;
+        EXPECT_EQ(*it, 'I');
+    }
+}
+
+TEST(consume_buffered_until, end_of_input)
+{
+    std::istringstream stream{"ACGT\nACGT\n"};
+    seqan3::detail::fast_istreambuf_iterator<char> it{*stream.rdbuf()};
+
+    std::string consumed{};
+    EXPECT_FALSE(seqan3::detail::consume_buffered_until<'>'>(it, [&] (std::string_view const chunk)
+    {
+        consumed.append(chunk);
+    }));
+
+    EXPECT_EQ(consumed, "ACGT\nACGT\n");
+    EXPECT_TRUE(it == std::ranges::default_sentinel);
+}
+
+TEST(consume_buffered, stop_within_chunk)
+{
+    small_stream_buffer buffer{"0123456789", 4};
+    seqan3::detail::fast_istreambuf_iterator<char> it{buffer};
+
+    // Consume exactly six characters.
+    size_t remaining = 6;
+    EXPECT_TRUE(seqan3::detail::consume_buffered(it, [&] (std::string_view const chunk)
+    {
+        size_t const consumed = std::min(remaining, chunk.size());
+        remaining -= consumed;
+        return consumed;
+    }));
+
+    EXPECT_EQ(remaining, 0u);
+    EXPECT_EQ(*it, '6');
+}
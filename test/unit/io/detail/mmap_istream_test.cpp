@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/mmap_istream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#ifdef SEQAN3_HAS_MMAP
+
+using seqan3::detail::basic_mmap_istream;
+
+std::string const input{"@read1\nACGT\n+\nIIII\n@read2\nTTTT\n+\n!!!!\n"};
+
+void write_file(std::filesystem::path const & path, std::string const & content)
+{
+    std::ofstream file{path, std::ios_base::out | std::ios::binary};
+    file << content;
+}
+
+TEST(mmap_istream, concept_check)
+{
+    EXPECT_TRUE((seqan3::input_stream_over<basic_mmap_istream<char>, char>));
+}
+
+TEST(mmap_istream, read)
+{
+    seqan3::test::tmp_filename filename{"mmap.fq"};
+    write_file(filename.get_path(), input);
+
+    basic_mmap_istream<char> stream{filename.get_path()};
+    ASSERT_TRUE(stream.is_open());
+    EXPECT_EQ(stream.view(), input);
+
+    std::string buffer{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(buffer, input);
+}
+
+TEST(mmap_istream, getline_unget_and_seek)
+{
+    seqan3::test::tmp_filename filename{"mmap.fq"};
+    write_file(filename.get_path(), input);
+
+    basic_mmap_istream<char> stream{filename.get_path()};
+    std::string line{};
+
+    std::getline(stream, line);
+    EXPECT_EQ(line, "@read1");
+    EXPECT_EQ(stream.tellg(), 7);
+
+    stream.unget();
+    EXPECT_EQ(stream.get(), '\n');
+
+    stream.seekg(19);
+    std::getline(stream, line);
+    EXPECT_EQ(line, "@read2");
+
+    stream.seekg(-5, std::ios_base::end);
+    std::getline(stream, line);
+    EXPECT_EQ(line, "!!!!");
+
+    stream.seekg(-100, std::ios_base::cur); // before the beginning
+    EXPECT_TRUE(stream.fail());
+}
+
+TEST(mmap_istream, empty_file)
+{
+    seqan3::test::tmp_filename filename{"empty.fq"};
+    write_file(filename.get_path(), std::string{});
+
+    // files of size 0 are not mapped, but read through std::ifstream
+    basic_mmap_istream<char> stream{filename.get_path()};
+    EXPECT_FALSE(stream.is_open());
+
+    auto fallback = seqan3::detail::make_primary_istream<char>(filename.get_path());
+    EXPECT_EQ(dynamic_cast<basic_mmap_istream<char> *>(fallback.get()), nullptr);
+    EXPECT_TRUE(fallback->good());
+    EXPECT_EQ(fallback->get(), std::char_traits<char>::eof());
+}
+
+TEST(mmap_istream, file_reporting_size_zero)
+{
+    if (!std::filesystem::exists("/proc/self/status")) // no procfs
+        return;
+
+    // procfs reports size 0, but the file has content
+    auto stream = seqan3::detail::make_primary_istream<char>("/proc/self/status");
+    EXPECT_EQ(dynamic_cast<basic_mmap_istream<char> *>(stream.get()), nullptr);
+    EXPECT_FALSE((std::string{std::istreambuf_iterator<char>{*stream}, std::istreambuf_iterator<char>{}}).empty());
+}
+
+TEST(mmap_istream, not_a_regular_file)
+{
+    seqan3::test::tmp_filename filename{"does_not_exist.fq"};
+
+    basic_mmap_istream<char> missing{filename.get_path()};
+    EXPECT_FALSE(missing.is_open());
+    EXPECT_TRUE(missing.fail());
+
+    basic_mmap_istream<char> directory{filename.get_path().parent_path()};
+    EXPECT_FALSE(directory.is_open());
+}
+
+TEST(mmap_istream, make_primary_istream)
+{
+    seqan3::test::tmp_filename filename{"mmap.fq"};
+    write_file(filename.get_path(), input);
+
+    auto stream = seqan3::detail::make_primary_istream<char>(filename.get_path());
+    EXPECT_NE(dynamic_cast<basic_mmap_istream<char> *>(stream.get()), nullptr);
+    EXPECT_EQ((std::string{std::istreambuf_iterator<char>{*stream}, std::istreambuf_iterator<char>{}}), input);
+
+    // fall back to std::ifstream which fails to open non-existing files
+    seqan3::test::tmp_filename missing{"does_not_exist.fq"};
+    EXPECT_FALSE(seqan3::detail::make_primary_istream<char>(missing.get_path())->good());
+}
+
+#endif // SEQAN3_HAS_MMAP
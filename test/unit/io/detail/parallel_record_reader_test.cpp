@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/detail/parallel_record_reader.hpp>
+
+using seqan3::detail::find_last_fasta_record_start;
+using seqan3::detail::find_last_fastq_record_start;
+using seqan3::detail::parallel_record_reader;
+
+TEST(find_last_fasta_record_start, basic)
+{
+    EXPECT_EQ(find_last_fasta_record_start(""), std::string_view::npos);
+    EXPECT_EQ(find_last_fasta_record_start(">ID\nACGT\n"), std::string_view::npos);
+    EXPECT_EQ(find_last_fasta_record_start(">ID\nACGT\n>ID2\nAC"), 9u);
+    EXPECT_EQ(find_last_fasta_record_start(">ID\nACGT\n;ID2\nAC"), 9u);
+    EXPECT_EQ(find_last_fasta_record_start(">ID\nACGT\n>ID2\nAC\nGT\n>"), 20u);
+}
+
+TEST(find_last_fastq_record_start, basic)
+{
+    EXPECT_EQ(find_last_fastq_record_start(""), std::string_view::npos);
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nACGT\n+\n!!!!\n"), std::string_view::npos);
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nACGT\n+\n!!!!\n@ID2\nACGT\n+\n!!"), 16u);
+    // The record start is only recognised if the '+' line is contained.
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nACGT\n+\n!!!!\n@ID2\nACGT\n"), std::string_view::npos);
+}
+
+TEST(find_last_fastq_record_start, quality_begins_with_at)
+{
+    // The quality line "@@@@" is not a record start, because the line after the next one does not begin with '+'.
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nACGT\n+\n@@@@\n@ID2\nACGT\n+\n@@@@\n"), 16u);
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nACGT\n+\n@@@@\n@ID2\nACGT\n+\n@@@@\n@ID3\nAC"), 16u);
+}
+
+TEST(find_last_fastq_record_start, wrapped_records)
+{
+    // Records with wrapped sequences are not used as split points, but stay in one chunk.
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nACGT\n+\n!!!!\n@ID2\nAC\nGT\n+\n!!\n!!\n"), std::string_view::npos);
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nAC\nGT\n+\n@@\n@@\n@ID2\nACGT\n+\n!!!!\n"), 18u);
+
+    // Limitation: if the qualities are wrapped, a quality line beginning with '@' is mistaken for a record start if
+    // the line after the next one begins with '+'. Such files must not be parsed by multiple threads.
+    EXPECT_EQ(find_last_fastq_record_start("@ID\nACG\nTAC\nGTA\n+\n@@@\n!!!\n+++\n"), 18u);
+}
+
+// Every line is a record; parsing fails on a line containing "error".
+void parse_lines(std::istream & stream, std::vector<std::string> & batch)
+{
+    for (std::string line; std::getline(stream, line);)
+    {
+        if (line == "error")
+            throw std::runtime_error{"parse error"};
+
+        batch.push_back(line);
+    }
+}
+
+size_t find_last_line_start(std::string_view const buffer)
+{
+    size_t const position = buffer.rfind('\n', buffer.size() - std::min<size_t>(buffer.size(), 2));
+    return (position == std::string_view::npos) ? position : position + 1;
+}
+
+TEST(parallel_record_reader, order)
+{
+    std::string input{};
+    for (size_t i = 0; i < 1000; ++i)
+        input += std::to_string(i) + "\n";
+
+    std::istringstream stream{input};
+    parallel_record_reader<std::string> reader{stream, 4, find_last_line_start, parse_lines, 16};
+
+    std::string record{};
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        ASSERT_TRUE(reader.next(record));
+        EXPECT_EQ(record, std::to_string(i));
+    }
+
+    EXPECT_FALSE(reader.next(record));
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST(parallel_record_reader, record_bigger_than_chunk)
+{
+    std::string const long_record(100, 'A');
+    std::istringstream stream{"short\n" + long_record + "\nshort\n"};
+    parallel_record_reader<std::string> reader{stream, 2, find_last_line_start, parse_lines, 8};
+
+    std::string record{};
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record, "short");
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record, long_record);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record, "short");
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST(parallel_record_reader, empty_input)
+{
+    std::istringstream stream{};
+    parallel_record_reader<std::string> reader{stream, 2, find_last_line_start, parse_lines};
+
+    std::string record{};
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST(parallel_record_reader, exception)
+{
+    std::string input{};
+    for (size_t i = 0; i < 100; ++i)
+        input += std::to_string(i) + "\n";
+    input += "error\n";
+
+    std::istringstream stream{input};
+    parallel_record_reader<std::string> reader{stream, 4, find_last_line_start, parse_lines, 16};
+
+    std::string record{};
+    EXPECT_THROW(while (reader.next(record)); , std::runtime_error);
+}
@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/detail/parallel_record_writer.hpp>
+
+using seqan3::detail::parallel_record_writer;
+
+// Writes every number of the batch on its own line.
+auto write_lines(std::vector<size_t> batch)
+{
+    return [batch = std::move(batch)] (std::ostream & stream)
+    {
+        for (size_t number : batch)
+            stream << number << '\n';
+    };
+}
+
+TEST(parallel_record_writer, order)
+{
+    std::ostringstream stream{};
+    std::string expected{};
+
+    {
+        parallel_record_writer writer{stream, 4};
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            std::vector<size_t> batch{};
+            for (size_t j = 0; j < 10; ++j)
+            {
+                batch.push_back(i * 10 + j);
+                expected += std::to_string(i * 10 + j) + "\n";
+            }
+
+            writer.push(write_lines(std::move(batch)));
+        }
+
+        writer.finish();
+    }
+
+    EXPECT_EQ(stream.str(), expected);
+}
+
+TEST(parallel_record_writer, no_batches)
+{
+    std::ostringstream stream{};
+
+    {
+        parallel_record_writer writer{stream, 2};
+        writer.finish();
+    }
+
+    EXPECT_TRUE(stream.str().empty());
+}
+
+TEST(parallel_record_writer, exception)
+{
+    std::ostringstream stream{};
+    parallel_record_writer writer{stream, 2};
+
+    writer.push(write_lines({1, 2}));
+    writer.push([] (std::ostream &) { throw std::runtime_error{"serialisation error"}; });
+    writer.push(write_lines({3, 4}));
+
+    EXPECT_THROW(writer.finish(), std::runtime_error);
+    EXPECT_EQ(stream.str(), "1\n2\n"); // the batches are written up to the failing one
+}
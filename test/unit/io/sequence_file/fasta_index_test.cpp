@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+
+using namespace seqan3;
+
+std::string const fasta
+{
+    ">seq1 a description\n"
+    "ACGTACGTAC\n"
+    "GTACGTACGT\n"
+    "ACG\n"
+    ">seq2\r\n"
+    "AAAAA\r\n"
+    "CC\r\n"
+    ">empty\n"
+    ">seq3\n"
+    "TTTT"
+};
+
+// The output of `samtools faidx`.
+std::string const fai
+{
+    "seq1\t23\t20\t10\t11\n"
+    "seq2\t7\t53\t5\t7\n"
+    "empty\t0\t71\t0\t0\n"
+    "seq3\t4\t77\t4\t4\n"
+};
+
+TEST(fasta_index, build)
+{
+    std::istringstream stream{fasta};
+    fasta_index const index = fasta_index::build(stream);
+
+    std::ostringstream written{};
+    index.write(written);
+    EXPECT_EQ(written.str(), fai);
+}
+
+TEST(fasta_index, build_invalid)
+{
+    std::istringstream longer_line{">seq\nACG\nACGT\n"};
+    EXPECT_THROW(fasta_index::build(longer_line), format_error);
+
+    std::istringstream shorter_line{">seq\nACGT\nAC\nACGT\n"};
+    EXPECT_THROW(fasta_index::build(shorter_line), format_error);
+
+    std::istringstream no_header{"ACGT\n"};
+    EXPECT_THROW(fasta_index::build(no_header), format_error);
+
+    std::istringstream duplicate{">seq\nACGT\n>seq\nACGT\n"};
+    EXPECT_THROW(fasta_index::build(duplicate), format_error);
+}
+
+TEST(fasta_index, read)
+{
+    std::istringstream fasta_stream{fasta};
+    std::istringstream index_stream{fai};
+
+    fasta_index index{};
+    index.read(index_stream);
+
+    EXPECT_EQ(index, fasta_index::build(fasta_stream));
+    ASSERT_EQ(index.sequences().size(), 4u);
+    EXPECT_EQ(index.sequences()[1], (fasta_index::entry{"seq2", 7, 53, 5, 7}));
+}
+
+TEST(fasta_index, read_invalid)
+{
+    fasta_index index{};
+
+    std::istringstream missing_column{"seq1\t23\t20\t10\n"};
+    EXPECT_THROW(index.read(missing_column), format_error);
+
+    std::istringstream no_number{"seq1\t23\t20\tten\t11\n"};
+    EXPECT_THROW(index.read(no_number), format_error);
+}
+
+TEST(fasta_index, find)
+{
+    std::istringstream stream{fai};
+    fasta_index index{};
+    index.read(stream);
+
+    ASSERT_NE(index.find("seq3"), nullptr);
+    EXPECT_EQ(index.find("seq3")->offset, 77u);
+    EXPECT_EQ(index.find("seq4"), nullptr);
+    EXPECT_EQ(index.find("seq1 a description"), nullptr);
+}
+
+TEST(fasta_index, offset)
+{
+    fasta_index::entry const seq1{"seq1", 23, 20, 10, 11};
+
+    EXPECT_EQ(fasta_index::offset(seq1, 0), 20u);
+    EXPECT_EQ(fasta_index::offset(seq1, 9), 29u);
+    EXPECT_EQ(fasta_index::offset(seq1, 10), 31u);
+    EXPECT_EQ(fasta_index::offset(seq1, 22), 44u);
+    EXPECT_EQ(fasta[fasta_index::offset(seq1, 22)], 'G');
+}
@@ -0,0 +1,115 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna5.hpp>
+#include <seqan3/io/sequence_file/indexed_fasta_file.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+    #include <seqan3/contrib/stream/gz_ostream.hpp>
+#endif
+
+using namespace seqan3;
+
+std::string const fasta
+{
+    ">seq1 a description\n"
+    "ACGTACGTAC\n"
+    "GTACGTACGT\n"
+    "ACN\n"
+    ">seq2\r\n"
+    "AAAAA\r\n"
+    "CC\r\n"
+    ">seq3\n"
+    "TTTT"
+};
+
+void write_file(std::filesystem::path const & path, std::string const & content)
+{
+    std::ofstream stream{path, std::ios::binary};
+    stream << content;
+}
+
+void check_windows(indexed_fasta_file & file)
+{
+    EXPECT_EQ(file.sequence("seq1", 0, 23), "ACGTACGTACGTACGTACGTACN"_dna5);
+    EXPECT_EQ(file.sequence("seq1", 8, 12), "ACGT"_dna5);  // spans a line break
+    EXPECT_EQ(file.sequence("seq1", 20, 100), "ACN"_dna5); // end is reduced to the length
+    EXPECT_EQ(file.sequence("seq2", 3, 7), "AACC"_dna5);   // \r\n line endings
+    EXPECT_EQ(file.sequence("seq3", 1, 3), "TT"_dna5);
+    EXPECT_EQ(file.sequence<dna4>("seq1", 0, 4), "ACGT"_dna4);
+    EXPECT_EQ(file.sequence<rna5>("seq3", 0, 4), "UUUU"_rna5);
+    EXPECT_TRUE(file.sequence("seq1", 5, 5).empty());
+    EXPECT_TRUE(file.sequence("seq1", 30, 40).empty());
+    EXPECT_THROW(file.sequence("seq4", 0, 1), std::out_of_range);
+}
+
+TEST(indexed_fasta_file, build_index)
+{
+    test::tmp_filename const filename{"indexed.fa"};
+    write_file(filename.get_path(), fasta);
+
+    indexed_fasta_file file{filename.get_path()};
+    EXPECT_EQ(file.index().sequences().size(), 3u);
+    check_windows(file);
+}
+
+TEST(indexed_fasta_file, read_index)
+{
+    test::tmp_filename const filename{"indexed.fa"};
+    write_file(filename.get_path(), fasta);
+
+    std::filesystem::path fai_path = filename.get_path();
+    fai_path += ".fai";
+    write_file(fai_path, "seq1\t23\t20\t10\t11\nseq2\t7\t53\t5\t7\nseq3\t4\t70\t4\t4\n");
+
+    indexed_fasta_file file{filename.get_path()};
+    check_windows(file);
+    std::filesystem::remove(fai_path);
+}
+
+TEST(indexed_fasta_file, open_error)
+{
+    EXPECT_THROW(indexed_fasta_file{"/i/do/not/exist.fa"}, file_open_error);
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+TEST(indexed_fasta_file, bgzf)
+{
+    test::tmp_filename const filename{"indexed.fa.gz"};
+
+    {
+        std::ofstream out{filename.get_path(), std::ios::binary};
+        contrib::bgzf_ostream compressed{out};
+        compressed << fasta;
+    }
+
+    indexed_fasta_file file{filename.get_path()};
+    check_windows(file);
+}
+
+TEST(indexed_fasta_file, gzip)
+{
+    test::tmp_filename const filename{"indexed.fa.gz"};
+
+    {
+        std::ofstream out{filename.get_path(), std::ios::binary};
+        contrib::gz_ostream compressed{out};
+        compressed << fasta;
+    }
+
+    EXPECT_THROW(indexed_fasta_file{filename.get_path()}, file_open_error);
+}
+#endif // SEQAN3_HAS_ZLIB
@@ -11,6 +11,7 @@
 
 #include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/range/views/convert.hpp>
+#include <seqan3/range/views/to_rank.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
@@ -315,6 +316,136 @@ TEST_F(sequence_file_input_f, file_view)
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(sequence_file_input_f, record_reading_parallel)
+{
+    sequence_file_input fin{std::istringstream{input}, format_fasta{}};
+    fin.options.threads = 4;
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::seq>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::id>(rec),  id_comp[counter])));
+        EXPECT_TRUE(empty(get<field::qual>(rec)));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sequence_file_input_f, read_batch)
+{
+    sequence_file_input fin{std::istringstream{input}, format_fasta{}};
+
+    auto & batch = fin.read_batch(2);
+    EXPECT_EQ(batch.size(), 2u);
+    ASSERT_EQ(batch.sequences().size(), 2u);
+    ASSERT_EQ(batch.ids().size(), 2u);
+    ASSERT_EQ(batch.qualities().size(), 2u); // FASTA has no qualities, but the field is selected
+    EXPECT_TRUE(batch.qualities()[0].empty());
+    EXPECT_TRUE((std::ranges::equal(batch.sequences()[0], seq_comp[0])));
+    EXPECT_TRUE((std::ranges::equal(batch.sequences()[1], seq_comp[1])));
+    EXPECT_TRUE((std::ranges::equal(batch.ids()[0], id_comp[0])));
+    EXPECT_TRUE((std::ranges::equal(batch.ids()[1], id_comp[1])));
+
+    // the batch is reused and only the remaining record is read
+    auto & batch2 = fin.read_batch(2);
+    EXPECT_EQ(&batch, &batch2);
+    EXPECT_EQ(batch2.size(), 1u);
+    EXPECT_TRUE((std::ranges::equal(batch2.sequences()[0], seq_comp[2])));
+    EXPECT_TRUE((std::ranges::equal(batch2.ids()[0], id_comp[2])));
+
+    EXPECT_TRUE(fin.read_batch(2).empty());
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+TEST_F(sequence_file_input_f, read_batch_mixed_with_iterator)
+{
+    sequence_file_input fin{std::istringstream{input}, format_fasta{}};
+
+    auto it = fin.begin();
+    EXPECT_TRUE((std::ranges::equal(get<field::id>(*it), id_comp[0])));
+    ++it;
+
+    auto & batch = fin.read_batch(1);
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_TRUE((std::ranges::equal(batch.ids()[0], id_comp[1])));
+
+    // the iterator points to the record behind the batch
+    EXPECT_TRUE((std::ranges::equal(get<field::id>(*fin.begin()), id_comp[2])));
+}
+
+TEST(sequence_file_input, read_batch_seq_qual)
+{
+    sequence_file_input fin{std::istringstream{std::string{"@ID1\nACGT\n+\n!!!!\n@ID2\nAC\n+\n##\n"}},
+                            format_fastq{},
+                            fields<field::seq_qual, field::id>{}};
+
+    auto & batch = fin.read_batch(10);
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_TRUE((std::ranges::equal(batch.sequences()[0] | views::convert<dna5>, "ACGT"_dna5)));
+    EXPECT_TRUE((std::ranges::equal(batch.sequences()[1] | views::convert<dna5>, "AC"_dna5)));
+    EXPECT_TRUE((std::ranges::equal(batch.ids()[1], std::string{"ID2"})));
+    EXPECT_TRUE(batch.qualities().empty());
+}
+
+TEST(sequence_file_input, read_batch_fastq)
+{
+    std::string const fastq_input{"@ID1\nACGT\n+\n!!!!\n@ID2\nAC\n+\n##\n@ID3\nGG\n+\n$$\n"};
+
+    for (size_t const threads : {1, 2})
+    {
+        sequence_file_input fin{std::istringstream{fastq_input}, format_fastq{}};
+        fin.options.threads = threads;
+
+        auto & batch = fin.read_batch(2);
+        ASSERT_EQ(batch.size(), 2u);
+        ASSERT_EQ(batch.qualities().size(), 2u);
+        EXPECT_TRUE((std::ranges::equal(batch.sequences()[0], "ACGT"_dna5)));
+        EXPECT_TRUE((std::ranges::equal(batch.sequences()[1], "AC"_dna5)));
+        EXPECT_TRUE((std::ranges::equal(batch.ids()[1], std::string{"ID2"})));
+        EXPECT_TRUE((std::ranges::equal(batch.qualities()[1] | views::to_rank, std::vector{2, 2})));
+
+        ASSERT_EQ(fin.read_batch(2).size(), 1u);
+        EXPECT_TRUE((std::ranges::equal(batch.ids()[0], std::string{"ID3"})));
+        EXPECT_TRUE((std::ranges::equal(batch.qualities()[0] | views::to_rank, std::vector{3, 3})));
+        EXPECT_TRUE(fin.read_batch(2).empty());
+    }
+}
+
+TEST(sequence_file_input, record_reading_parallel_multiple_chunks)
+{
+    // Big enough to be split into several chunks; the quality lines begin with '@' to challenge the splitting.
+    std::string fastq_input{};
+    for (size_t i = 0; i < 40000; ++i)
+    {
+        fastq_input += "@read" + std::to_string(i) + "\n";
+        fastq_input += std::string(100, "ACGT"[i % 4]) + "\n+\n";
+        fastq_input += std::string(100, '@') + "\n";
+    }
+
+    sequence_file_input fin_sequential{std::istringstream{fastq_input}, format_fastq{}};
+    sequence_file_input fin_parallel{std::istringstream{fastq_input}, format_fastq{}};
+    fin_parallel.options.threads = 4;
+
+    size_t counter = 0;
+    auto it = fin_sequential.begin();
+    for (auto & rec : fin_parallel)
+    {
+        ASSERT_FALSE(it == fin_sequential.end());
+        EXPECT_EQ(get<field::id>(rec), get<field::id>(*it));
+        EXPECT_TRUE((std::ranges::equal(get<field::seq>(rec), get<field::seq>(*it))));
+        EXPECT_TRUE((std::ranges::equal(get<field::qual>(rec), get<field::qual>(*it))));
+
+        ++it;
+        ++counter;
+    }
+
+    EXPECT_TRUE(it == fin_sequential.end());
+    EXPECT_EQ(counter, 40000u);
+}
+
 // ----------------------------------------------------------------------------
 // decompression
 // ----------------------------------------------------------------------------
@@ -485,3 +616,44 @@ TEST_F(sequence_file_input_f, read_empty_bz2_file)
     EXPECT_TRUE(fin.begin() == fin.end());
 }
 #endif
+
+#ifdef SEQAN3_HAS_ZSTD
+std::string input_zstd
+{
+    '\x28','\xB5','\x2F','\xFD','\x00','\x58','\xBC','\x01','\x00','\x04','\x03','\x3E','\x20','\x54','\x45','\x53',
+    '\x54','\x20','\x31','\x0A','\x41','\x43','\x47','\x54','\x0A','\x3E','\x54','\x65','\x73','\x74','\x32','\x0A',
+    '\x41','\x47','\x47','\x43','\x54','\x47','\x4E','\x0A','\x3E','\x20','\x54','\x65','\x73','\x74','\x33','\x0A',
+    '\x47','\x47','\x41','\x47','\x54','\x41','\x54','\x41','\x41','\x54','\x0A','\x01','\x00','\x4F','\x76','\x65',
+    '\x01','\x00','\x00'
+};
+
+TEST_F(sequence_file_input_f, decompression_by_filename_zstd)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.zst"};
+
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+
+        std::copy(begin(input_zstd), end(input_zstd), std::ostreambuf_iterator<char>{of});
+    }
+
+    sequence_file_input fin{filename.get_path()};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, decompression_by_stream_zstd)
+{
+    sequence_file_input fin{std::istringstream{input_zstd}, format_fasta{}};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, read_empty_zstd_file)
+{
+    std::string empty_zipped_file{'\x28', '\xB5', '\x2F', '\xFD', '\x00', '\x58', '\x01', '\x00', '\x00'};
+    sequence_file_input fin{std::istringstream{empty_zipped_file}, format_fasta{}};
+
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+#endif
@@ -15,9 +15,15 @@
 #include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/io/sequence_file/output.hpp>
 #include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
 #include <seqan3/test/tmp_filename.hpp>
 #include <seqan3/std/iterator>
 
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_istream.hpp>
+#endif
+
 using namespace seqan3;
 
 TEST(sequence_file_output_iterator, concepts)
@@ -425,6 +431,149 @@ TEST(columns, writing_seq_qual)
     EXPECT_EQ(reinterpret_cast<std::ostringstream&>(fout.get_stream()).str(), output_comp);
 }
 
+// ----------------------------------------------------------------------------
+// async
+// ----------------------------------------------------------------------------
+
+TEST(async, push_back)
+{
+    std::ostringstream stream{};
+    sequence_file_output fout{stream, format_fasta{}};
+    fout.options.fasta_letters_per_line = 0;
+    fout.options.async_write = true;
+
+    std::string expected{};
+    dna5_vector seq{};
+    std::string id{};
+
+    for (size_t i = 0; i < 3000; ++i)
+    {
+        seq = seqs[i % 3];
+        id = ids[i % 3];
+        fout.emplace_back(seq, id); // the buffers are overwritten before the record is written
+        expected += "> " + id + "\n" + (seq | views::to_char | views::to<std::string>) + "\n";
+    }
+
+    fout.flush();
+    EXPECT_EQ(stream.str(), expected);
+
+    // the writer is restarted after flush
+    fout.emplace_back(seqs[0], ids[0]);
+    fout.flush();
+    EXPECT_EQ(stream.str(), expected + "> TEST 1\nACGT\n");
+}
+
+TEST(async, seq_qual_and_destructor)
+{
+    test::tmp_filename filename{"sequence_file_output_async.fastq"};
+
+    {
+        sequence_file_output fout{filename.get_path(), fields<field::id, field::seq_qual>{}};
+        fout.options.async_write = true;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            std::vector<qualified<dna5, phred42>> seq_qual(quals[i].size());
+            std::copy(seqs[i].begin(), seqs[i].end(), seq_qual.begin());
+            std::copy(quals[i].begin(), quals[i].end(), seq_qual.begin());
+
+            fout.emplace_back(ids[i], seq_qual);
+        }
+
+        sequence_file_output moved{std::move(fout)}; // moving does not interrupt the writer
+    }
+
+    std::ifstream fin{filename.get_path(), std::ios::binary};
+    std::string const buffer{std::istreambuf_iterator<char>{fin}, std::istreambuf_iterator<char>{}};
+
+    std::string expected{};
+    for (size_t i = 0; i < 3; ++i)
+    {
+        expected += "@" + ids[i] + "\n" + (seqs[i] | views::to_char | views::to<std::string>) + "\n+\n" +
+                    (quals[i] | views::to_char | views::to<std::string>) + "\n";
+    }
+
+    EXPECT_EQ(buffer, expected);
+}
+
+// A stream buffer that fails to write after a few characters.
+class failing_stream_buffer : public std::streambuf
+{
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (written++ > 100)
+            throw std::runtime_error{"disk full"};
+
+        return ch;
+    }
+
+private:
+    size_t written{0};
+};
+
+TEST(async, exception)
+{
+    failing_stream_buffer buffer{};
+    std::ostream stream{&buffer};
+    stream.exceptions(std::ios_base::badbit);
+
+    sequence_file_output fout{stream, format_fasta{}};
+    fout.options.async_write = true;
+
+    EXPECT_THROW(
+    {
+        for (size_t i = 0; i < 100000; ++i) // propagated by one of the following push_back calls
+            fout.emplace_back(seqs[i % 3], ids[i % 3]);
+        fout.flush();
+    }, std::runtime_error);
+}
+
+// A stream buffer that fails once after a few characters and stores everything else.
+class failing_once_stream_buffer : public std::streambuf
+{
+public:
+    std::string data{};
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (written++ == 100)
+            throw std::runtime_error{"disk full"};
+
+        data.push_back(traits_type::to_char_type(ch));
+        return ch;
+    }
+
+private:
+    size_t written{0};
+};
+
+TEST(async, write_after_exception)
+{
+    failing_once_stream_buffer buffer{};
+    std::ostream stream{&buffer};
+    stream.exceptions(std::ios_base::badbit);
+
+    sequence_file_output fout{stream, format_fasta{}};
+    fout.options.async_write = true;
+
+    EXPECT_THROW(
+    {
+        for (size_t i = 0; i < 100000; ++i)
+            fout.emplace_back(seqs[i % 3], ids[i % 3]);
+    }, std::runtime_error);
+
+    // the failed writer is stopped, so the next record starts a new one
+    stream.clear();
+    fout.emplace_back(seqs[0], ids[0]);
+    EXPECT_NO_THROW(fout.flush());
+
+    std::string const last_record{"> TEST 1\nACGT\n"};
+    ASSERT_GE(buffer.data.size(), last_record.size());
+    EXPECT_EQ(buffer.data.substr(buffer.data.size() - last_record.size()), last_record);
+}
+
 // ----------------------------------------------------------------------------
 // compression
 // ----------------------------------------------------------------------------
@@ -536,6 +685,38 @@ TEST(compression, by_stream_bgzf)
     EXPECT_EQ(buffer, expected_bgzf);
 }
 
+TEST(compression, options_gz)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.gz"};
+
+    {
+        sequence_file_output fout{filename.get_path()};
+        fout.options.fasta_letters_per_line = 0;
+        fout.options.compression_level = 0; // the blocks are stored uncompressed
+        fout.options.compression_threads = 1;
+
+        for (size_t i = 0; i < 3; ++i)
+            fout.emplace_back(seqs[i], ids[i]);
+    }
+
+    std::ifstream fi{filename.get_path(), std::ios::binary};
+    std::string buffer{std::istreambuf_iterator<char>{fi}, std::istreambuf_iterator<char>{}};
+    EXPECT_NE(buffer.find(output_comp), std::string::npos);
+}
+
+TEST(compression, empty_gz)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.gz"};
+
+    {
+        sequence_file_output fout{filename.get_path()};
+    }
+
+    std::ifstream fi{filename.get_path(), std::ios::binary};
+    std::string buffer{std::istreambuf_iterator<char>{fi}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(buffer, (std::string{contrib::BGZF_END_OF_FILE_MARKER.begin(), contrib::BGZF_END_OF_FILE_MARKER.end()}));
+}
+
 #endif
 
 #ifdef SEQAN3_HAS_BZIP2
@@ -569,3 +750,33 @@ TEST(compression, by_stream_bz2)
     EXPECT_EQ(out.str(), expected_bz2);
 }
 #endif
+
+#ifdef SEQAN3_HAS_ZSTD
+// The compressed output depends on the number of threads, so it is decompressed again for the comparison.
+std::string decompress_zstd(std::string const & compressed)
+{
+    std::istringstream compressed_stream{compressed};
+    contrib::zstd_istream decompressed_stream{compressed_stream};
+    return std::string{std::istreambuf_iterator<char>{decompressed_stream}, std::istreambuf_iterator<char>{}};
+}
+
+TEST(compression, by_filename_zstd)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.zst"};
+
+    std::string buffer = compression_by_filename_impl(filename);
+    EXPECT_EQ(decompress_zstd(buffer), output_comp);
+}
+
+TEST(compression, by_stream_zstd)
+{
+    std::ostringstream out;
+
+    {
+        contrib::zstd_ostream compout{out};
+        compression_by_stream_impl(compout);
+    }
+
+    EXPECT_EQ(decompress_zstd(out.str()), output_comp);
+}
+#endif